@@ -0,0 +1,120 @@
+"""Compare JSON and MessagePack response size and client-side encode/decode cost.
+
+Usage:
+    PYTHONPATH=src python benchmarks/bench_encoding.py [--rows N] [--live TABLE_PATH]
+
+Without --live a synthetic query_datatable page is generated. With --live the
+page is fetched from a running editor (UDB_HOST / UDB_PORT) in both encodings,
+which also measures the plugin-side encode and transfer time end to end.
+"""
+
+import argparse
+import json
+import os
+import random
+import time
+
+from unreal_data_bridge_mcp.encoding import (
+    ENCODING_JSON,
+    ENCODING_MSGPACK,
+    decode_response,
+    msgpack_available,
+)
+
+try:
+    import msgpack
+except ImportError:
+    msgpack = None
+
+
+def synthetic_page(num_rows: int) -> dict:
+    """A query_datatable-shaped response with float-heavy rows."""
+    rng = random.Random(42)
+    rarities = ["Common", "Rare", "Epic", "Legendary"]
+    rows = []
+    for index in range(num_rows):
+        rows.append({
+            "row_name": f"Row_{index}",
+            "row_data": {
+                "DisplayName": f"Item {index}",
+                "Level": index % 100,
+                "Weight": rng.uniform(0.0, 50.0),
+                "bIsBoss": index % 17 == 0,
+                "Rarity": rarities[index % 4],
+                "SpawnOffset": {"X": rng.uniform(-1e3, 1e3), "Y": rng.uniform(-1e3, 1e3), "Z": 0.0},
+                "Stats": {"Damage": rng.uniform(1.0, 100.0), "Cooldown": rng.uniform(0.1, 5.0)},
+                "Tags": ["Item.Weapon.Sword", "Item.Tier.2"],
+            },
+        })
+    return {
+        "success": True,
+        "data": {"rows": rows, "total_count": num_rows, "offset": 0, "limit": num_rows},
+        "timing_ms": 1.0,
+    }
+
+
+def time_call(fn, repeat: int) -> float:
+    """Best-of-N wall time in milliseconds."""
+    best = float("inf")
+    for _ in range(repeat):
+        start = time.perf_counter()
+        fn()
+        best = min(best, time.perf_counter() - start)
+    return best * 1000.0
+
+
+def bench_local(response: dict, repeat: int) -> None:
+    json_bytes = json.dumps(response, separators=(",", ":")).encode("utf-8")
+    packed = msgpack.packb(response, use_bin_type=True)
+
+    print(f"{'encoding':<10} {'bytes':>12} {'encode ms':>10} {'decode ms':>10}")
+    for name, payload, encode in (
+        (ENCODING_JSON, json_bytes, lambda: json.dumps(response, separators=(",", ":")).encode("utf-8")),
+        (ENCODING_MSGPACK, packed, lambda: msgpack.packb(response, use_bin_type=True)),
+    ):
+        encode_ms = time_call(encode, repeat)
+        decode_ms = time_call(lambda: decode_response(payload, name), repeat)
+        print(f"{name:<10} {len(payload):>12,} {encode_ms:>10.2f} {decode_ms:>10.2f}")
+
+    print(f"msgpack/json size ratio: {len(packed) / len(json_bytes):.2f}")
+
+
+def bench_live(table_path: str, repeat: int) -> None:
+    from unreal_data_bridge_mcp.tcp_client import UEConnection
+
+    host = os.environ.get("UDB_HOST", "127.0.0.1")
+    port = int(os.environ.get("UDB_PORT", "8742"))
+    params = {"table_path": table_path, "limit": 1000}
+
+    print(f"{'encoding':<10} {'round trip ms':>14}")
+    for encoding in (ENCODING_JSON, ENCODING_MSGPACK):
+        connection = UEConnection(host, port, encoding=encoding)
+        connection.connect()
+        if connection.encoding != encoding:
+            print(f"{encoding:<10} {'unsupported':>14}")
+            connection.disconnect()
+            continue
+        elapsed = time_call(lambda: connection.send_command("query_datatable", params), repeat)
+        print(f"{encoding:<10} {elapsed:>14.2f}")
+        connection.disconnect()
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--rows", type=int, default=5000, help="synthetic page size")
+    parser.add_argument("--repeat", type=int, default=5, help="best-of-N repetitions")
+    parser.add_argument("--live", metavar="TABLE_PATH", help="benchmark against a running editor")
+    args = parser.parse_args()
+
+    if not msgpack_available():
+        raise SystemExit("msgpack is not installed: pip install unreal-data-bridge-mcp[msgpack]")
+
+    if args.live:
+        bench_live(args.live, args.repeat)
+    else:
+        print(f"Synthetic query_datatable page, {args.rows} rows")
+        bench_local(synthetic_page(args.rows), args.repeat)
+
+
+if __name__ == "__main__":
+    main()
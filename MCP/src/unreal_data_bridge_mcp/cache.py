@@ -12,12 +12,17 @@ class ResponseCache:
 
     Uses time.monotonic() for TTL (immune to clock changes).
     Cache key: f"{command}:{json.dumps(params, sort_keys=True)}"
+
+    Responses carrying a plugin ``etag`` are kept after they expire so the caller
+    can revalidate them (``get_etag`` + ``revalidate``) instead of re-downloading.
     """
 
-    def __init__(self):
-        self._store: dict[str, tuple[float, dict]] = {}  # key -> (expires_at, value)
+    def __init__(self, max_entries: int = 1024):
+        self._store: dict[str, tuple[float, dict, str | None]] = {}  # key -> (expires_at, value, etag)
+        self._max_entries = max_entries
         self._hits = 0
         self._misses = 0
+        self._revalidations = 0
 
     @property
     def stats(self) -> dict:
@@ -27,6 +32,7 @@ class ResponseCache:
             "hits": self._hits,
             "misses": self._misses,
             "hit_rate": round(self._hits / total, 2) if total > 0 else 0.0,
+            "revalidations": self._revalidations,
             "entries": len(self._store),
         }
 
@@ -44,9 +50,10 @@ class ResponseCache:
             logger.debug("Cache MISS: %s", key)
             return None
 
-        expires_at, value = entry
+        expires_at, value, etag = entry
         if time.monotonic() > expires_at:
-            del self._store[key]
+            if etag is None:
+                del self._store[key]
             self._misses += 1
             logger.debug("Cache EXPIRED: %s", key)
             return None
@@ -55,9 +62,31 @@ class ResponseCache:
         logger.debug("Cache HIT: %s", key)
         return value
 
+    def get_etag(self, key: str) -> str | None:
+        """Return the etag of a cached response (expired or not), if it has one."""
+        entry = self._store.get(key)
+        return entry[2] if entry is not None else None
+
+    def revalidate(self, key: str, ttl: float) -> dict | None:
+        """The plugin confirmed the cached response is current: extend it and return it."""
+        entry = self._store.get(key)
+        if entry is None:
+            return None
+        _, value, etag = entry
+        self._store[key] = (time.monotonic() + ttl, value, etag)
+        self._revalidations += 1
+        logger.debug("Cache REVALIDATED: %s", key)
+        return value
+
     def set(self, key: str, value: dict, ttl: float) -> None:
         """Store a value with TTL in seconds."""
-        self._store[key] = (time.monotonic() + ttl, value)
+        data = value.get("data") if isinstance(value, dict) else None
+        etag = data.get("etag") if isinstance(data, dict) else None
+        self._store.pop(key, None)
+        self._store[key] = (time.monotonic() + ttl, value, etag)
+        if len(self._store) > self._max_entries:
+            # Oldest insertion first; revalidatable entries would otherwise accumulate
+            del self._store[next(iter(self._store))]
         logger.debug("Cache SET: %s (ttl=%.0fs)", key, ttl)
 
     def invalidate(self, pattern: str | None) -> int:
@@ -81,3 +110,4 @@ class ResponseCache:
         """Reset hit/miss counters."""
         self._hits = 0
         self._misses = 0
+        self._revalidations = 0
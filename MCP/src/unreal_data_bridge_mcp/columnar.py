@@ -0,0 +1,66 @@
+"""Helpers for columnar query_datatable results.
+
+A columnar result holds ``row_names`` plus one entry per field in ``columns``.
+Each entry is either a plain list of values in row order, or a
+dictionary-encoded ``{"dict": [...], "codes": [...]}`` for enums, names,
+tags and repetitive strings.
+"""
+
+def is_columnar(data: dict) -> bool:
+    """Return True if a response data dict is in columnar format."""
+    return isinstance(data, dict) and data.get("format") == "columnar"
+
+
+def decode_column(column) -> list:
+    """Return a column's values in row order, resolving dictionary encoding."""
+    if isinstance(column, dict) and "dict" in column and "codes" in column:
+        dictionary = column["dict"]
+        return [dictionary[code] for code in column["codes"]]
+    return list(column)
+
+
+def expand_columnar(data: dict) -> dict:
+    """Convert a columnar result back to the row format.
+
+    Produces the same shape as a ``format: "rows"`` response: ``rows`` is a
+    list of ``{row_name, row_data}`` objects, and every other key is kept.
+    Non-columnar data is returned unchanged.
+    """
+    if not is_columnar(data):
+        return data
+
+    row_names = data.get("row_names", [])
+    columns = {name: decode_column(col) for name, col in data.get("columns", {}).items()}
+
+    rows = [
+        {
+            "row_name": row_name,
+            "row_data": {field: values[index] for field, values in columns.items()},
+        }
+        for index, row_name in enumerate(row_names)
+    ]
+
+    expanded = {}
+    for key, value in data.items():
+        if key == "row_names":
+            expanded["rows"] = rows
+        elif key not in ("format", "columns"):
+            expanded[key] = value
+    return expanded
+
+
+def slice_columnar(data: dict, count: int) -> dict:
+    """Return a columnar result limited to its first ``count`` rows.
+
+    Dictionaries are kept whole; only the codes are sliced.
+    """
+    sliced = dict(data)
+    sliced["row_names"] = data.get("row_names", [])[:count]
+    columns = {}
+    for name, column in data.get("columns", {}).items():
+        if isinstance(column, dict) and "codes" in column:
+            columns[name] = {**column, "codes": column["codes"][:count]}
+        else:
+            columns[name] = column[:count]
+    sliced["columns"] = columns
+    return sliced
@@ -0,0 +1,67 @@
+"""Wire encodings for the UE plugin's TCP protocol.
+
+Requests and responses are either newline-delimited JSON (the default) or
+MessagePack frames: a ``0x01`` marker byte, a big-endian uint32 payload
+length, then the payload. The plugin answers in whichever encoding the
+request used, and advertises what it accepts in ``ping``'s ``encodings``.
+
+MessagePack needs the optional ``msgpack`` package
+(``pip install unreal-data-bridge-mcp[msgpack]``).
+"""
+
+import json
+import struct
+
+try:
+    import msgpack
+except ImportError:  # pragma: no cover - exercised only without the extra installed
+    msgpack = None
+
+ENCODING_JSON = "json"
+ENCODING_MSGPACK = "msgpack"
+
+FRAME_MARKER = 0x01
+_FRAME_HEADER = struct.Struct(">BI")
+
+
+def msgpack_available() -> bool:
+    """Return True if the optional msgpack package is installed."""
+    return msgpack is not None
+
+
+def encode_request(command: str, params: dict | None, encoding: str) -> bytes:
+    """Encode a ``{command, params}`` request for the wire."""
+    request = {"command": command, "params": params or {}}
+    if encoding == ENCODING_MSGPACK:
+        payload = msgpack.packb(request, use_bin_type=True)
+        return _FRAME_HEADER.pack(FRAME_MARKER, len(payload)) + payload
+    return (json.dumps(request) + "\n").encode("utf-8")
+
+
+def split_response(buffer: bytes | bytearray, encoding: str) -> tuple[bytes, bytes] | None:
+    """Split one complete response off the front of ``buffer``.
+
+    Returns ``(payload, remainder)``, or None if more bytes are needed.
+    """
+    if encoding == ENCODING_MSGPACK:
+        if len(buffer) < _FRAME_HEADER.size:
+            return None
+        marker, length = _FRAME_HEADER.unpack_from(buffer)
+        if marker != FRAME_MARKER:
+            raise ValueError(f"Unexpected frame marker 0x{marker:02x}")
+        end = _FRAME_HEADER.size + length
+        if len(buffer) < end:
+            return None
+        return bytes(buffer[_FRAME_HEADER.size:end]), bytes(buffer[end:])
+
+    if b"\n" not in buffer:
+        return None
+    line, remainder = bytes(buffer).split(b"\n", 1)
+    return line, remainder
+
+
+def decode_response(payload: bytes, encoding: str) -> dict:
+    """Decode a response payload produced by split_response."""
+    if encoding == ENCODING_MSGPACK:
+        return msgpack.unpackb(payload, raw=False, strict_map_key=False)
+    return json.loads(payload.decode("utf-8"))
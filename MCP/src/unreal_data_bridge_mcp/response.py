@@ -3,6 +3,8 @@
 import json
 import logging
 
+from .columnar import is_columnar, slice_columnar
+
 logger = logging.getLogger(__name__)
 
 _MAX_RESPONSE_CHARS = 40_000
@@ -38,6 +40,16 @@ def format_response(data: dict, tool_name: str) -> str:
             array_key = key
             break
 
+    if array_key is None and is_columnar(data) and data.get("row_names"):
+        array_key = "row_names"
+
+    def take(count: int) -> dict:
+        if array_key == "row_names":
+            return slice_columnar(data, count)
+        trial = dict(data)
+        trial[array_key] = data[array_key][:count]
+        return trial
+
     if array_key is None:
         logger.warning(
             "Response for %s is %d chars with no truncatable array",
@@ -57,8 +69,7 @@ def format_response(data: dict, tool_name: str) -> str:
     best = 0
     while lo <= hi:
         mid = (lo + hi) // 2
-        trial = dict(data)
-        trial[array_key] = data[array_key][:mid]
+        trial = take(mid)
         trial["_truncated"] = {
             "original_count": original_count,
             "returned_count": mid,
@@ -72,8 +83,7 @@ def format_response(data: dict, tool_name: str) -> str:
         else:
             hi = mid - 1
 
-    truncated = dict(data)
-    truncated[array_key] = data[array_key][:best]
+    truncated = take(best)
     truncated["_truncated"] = {
         "original_count": original_count,
         "returned_count": best,
@@ -27,6 +27,7 @@ mcp = FastMCP("unreal-data-bridge")
 _connection = UEConnection(
     host=os.environ.get("UDB_HOST", "127.0.0.1"),
     port=int(os.environ.get("UDB_PORT", "8742")),
+    encoding=os.environ.get("UDB_ENCODING", "json").lower(),
 )
 
 _TTL_CATALOG = 600  # 10 min
@@ -1,11 +1,18 @@
 """TCP client for communicating with the UE plugin's TCP server."""
 
 import socket
-import json
 import logging
 import time
 
 from .cache import ResponseCache
+from .encoding import (
+    ENCODING_JSON,
+    ENCODING_MSGPACK,
+    decode_response,
+    encode_request,
+    msgpack_available,
+    split_response,
+)
 
 logger = logging.getLogger(__name__)
 
@@ -17,9 +24,13 @@ _RECONNECT_DELAY = 0.5
 class UEConnection:
     """Manages TCP connection to the Unreal Data Bridge plugin."""
 
-    def __init__(self, host: str = "127.0.0.1", port: int = 8742):
+    def __init__(
+        self, host: str = "127.0.0.1", port: int = 8742, encoding: str = ENCODING_JSON
+    ):
         self.host = host
         self.port = port
+        self.requested_encoding = encoding
+        self.encoding = ENCODING_JSON
         self._socket: socket.socket | None = None
         self._cache = ResponseCache()
 
@@ -47,6 +58,30 @@ class UEConnection:
                 f"Is the editor running with UnrealDataBridge plugin enabled? Error: {e}"
             ) from e
 
+        self._negotiate_encoding()
+
+    def _negotiate_encoding(self) -> None:
+        """Switch to the requested wire encoding if both sides support it.
+
+        Every connection starts in JSON; a JSON ping reports the plugin's encodings.
+        """
+        self.encoding = ENCODING_JSON
+        if self.requested_encoding != ENCODING_MSGPACK:
+            return
+
+        if not msgpack_available():
+            logger.warning(
+                "UDB_ENCODING=msgpack but the msgpack package is not installed; using JSON"
+            )
+            return
+
+        pong = self._send_and_receive("ping", None)
+        if ENCODING_MSGPACK in pong.get("data", {}).get("encodings", []):
+            self.encoding = ENCODING_MSGPACK
+            logger.info("Using MessagePack wire encoding")
+        else:
+            logger.warning("Plugin does not support MessagePack; using JSON")
+
     def disconnect(self) -> None:
         """Close the TCP connection."""
         if self._socket:
@@ -93,15 +128,27 @@ class UEConnection:
     ) -> dict:
         """Send a command with response caching.
 
-        Returns cached response if available and not expired.
-        Otherwise sends the command and caches the successful response.
+        Returns cached response if available and not expired. An expired response
+        that carries an ``etag`` is revalidated with ``if_none_match``: if the plugin
+        answers ``not_modified`` the cached copy is reused without re-downloading it.
+        Otherwise sends the command and caches the response.
         """
         key = ResponseCache.make_key(command, params)
         cached = self._cache.get(key)
         if cached is not None:
             return cached
 
-        response = self.send_command(command, params)
+        etag = self._cache.get_etag(key)
+        if etag is not None:
+            response = self.send_command(command, {**(params or {}), "if_none_match": etag})
+            if response.get("success") and response.get("data", {}).get("not_modified"):
+                revalidated = self._cache.revalidate(key, ttl)
+                if revalidated is not None:
+                    return revalidated
+                response = self.send_command(command, params)
+        else:
+            response = self.send_command(command, params)
+
         self._cache.set(key, response, ttl)
         return response
 
@@ -111,14 +158,15 @@ class UEConnection:
 
     def _send_and_receive(self, command: str, params: dict | None = None) -> dict:
         """Send a command and read the response. Internal method, no retry logic."""
-        request = json.dumps({"command": command, "params": params or {}}) + "\n"
+        encoding = self.encoding
+        request = encode_request(command, params, encoding)
         start = time.monotonic()
         try:
-            self._socket.sendall(request.encode("utf-8"))
+            self._socket.sendall(request)
 
-            # Read line-delimited response (buffer until we get \n)
-            buffer = b""
-            while b"\n" not in buffer:
+            # Read one response: a JSON line or a length-prefixed MessagePack frame
+            buffer = bytearray()
+            while (split := split_response(buffer, encoding)) is None:
                 chunk = self._socket.recv(65536)
                 if not chunk:
                     self.disconnect()
@@ -126,10 +174,15 @@ class UEConnection:
                 buffer += chunk
 
             elapsed = time.monotonic() - start
-            logger.debug("Command '%s' completed in %.3fs", command, elapsed)
-
-            line = buffer.split(b"\n", 1)[0]
-            response = json.loads(line.decode("utf-8"))
+            logger.debug(
+                "Command '%s' completed in %.3fs (%s, %d bytes)",
+                command,
+                elapsed,
+                encoding,
+                len(split[0]),
+            )
+
+            response = decode_response(split[0], encoding)
 
             if not response.get("success"):
                 error = response.get("error", {})
@@ -46,7 +46,9 @@ def register_data_asset_tools(mcp, connection: UEConnection):
             return f"Error: {e}"
 
     @mcp.tool()
-    def get_data_asset(asset_path: str) -> str:
+    def get_data_asset(
+        asset_path: str, omit_defaults: bool = False, float_precision: int = -1
+    ) -> str:
         """Read all properties of a DataAsset.
 
         Use list_data_assets to discover available assets and their paths.
@@ -54,6 +56,9 @@ def register_data_asset_tools(mcp, connection: UEConnection):
         Args:
             asset_path: Full asset path to the DataAsset
                         (e.g., '/Game/Ripper/Products/DA_CyberArm_Mk1.DA_CyberArm_Mk1').
+            omit_defaults: If True, leave out properties that equal the class defaults.
+            float_precision: Optional maximum decimal places for float/double values
+                             (e.g., 2 sends 12.35 instead of 12.3456). -1 keeps full precision.
 
         Returns:
             JSON with:
@@ -62,9 +67,12 @@ def register_data_asset_tools(mcp, connection: UEConnection):
             - properties: Object with all property names and values
         """
         try:
-            response = connection.send_command("get_data_asset", {
-                "asset_path": asset_path,
-            })
+            params = {"asset_path": asset_path}
+            if omit_defaults:
+                params["omit_defaults"] = True
+            if float_precision >= 0:
+                params["float_precision"] = float_precision
+            response = connection.send_command("get_data_asset", params)
             return format_response(response.get("data", {}), "get_data_asset")
         except ConnectionError as e:
             return f"Error: {e}"
@@ -10,6 +10,21 @@ logger = logging.getLogger(__name__)
 # Cache TTLs (seconds)
 _TTL_SCHEMA = 1800  # 30 min - schemas require recompile to change
 _TTL_LIST = 300  # 5 min - table list rarely changes during session
+_TTL_REVALIDATE = 0  # row reads: always revalidated by etag, unchanged data costs a tiny round trip
+
+
+def _split_top_level(text: str) -> list[str]:
+    """Split on commas outside parentheses, so 'count,histogram(Level, 5)' stays two items."""
+    items, depth, current = [], 0, []
+    for char in text:
+        if char == "," and depth == 0:
+            items.append("".join(current).strip())
+            current = []
+            continue
+        depth += (char == "(") - (char == ")")
+        current.append(char)
+    items.append("".join(current).strip())
+    return [item for item in items if item]
 
 
 def register_datatable_tools(mcp, connection: UEConnection):
@@ -87,6 +102,13 @@ def register_datatable_tools(mcp, connection: UEConnection):
         fields: str = "",
         limit: int = 25,
         offset: int = 0,
+        omit_defaults: bool = False,
+        format: str = "rows",
+        float_precision: int = -1,
+        where: str = "",
+        order_by: str = "",
+        use_cursor: bool = False,
+        cursor: str = "",
     ) -> str:
         """Query rows from a DataTable with optional filtering, field selection, and pagination.
 
@@ -99,23 +121,58 @@ def register_datatable_tools(mcp, connection: UEConnection):
         Args:
             table_path: Full asset path to the DataTable.
             row_name_pattern: Optional wildcard pattern to filter row names (e.g., 'Quest_*', '*_Boss').
-                              Uses Unreal wildcard matching (* for any chars, ? for single char).
+                              Uses Unreal wildcard matching (* for any chars, ? for single char),
+                              case-insensitive. Without where/order_by, matches are cached in the
+                              editor, so paging through them with offset is cheap.
             row_names: Optional comma-separated list of exact row names to fetch
                        (e.g., 'Quest_Tutorial_01,Quest_Build_01'). When provided,
                        row_name_pattern is ignored. Returns rows in requested order.
                        Missing names are reported in 'missing_rows'.
             fields: Optional comma-separated list of field names to include in results.
                     Leave empty to include all fields. Example: 'Title,QuestType,Priority'.
+                    Nested paths select single leaves: 'Stats.Damage,Abilities[*].Cooldown'.
             limit: Maximum number of rows to return (default: 25). Ignored when row_names is set.
             offset: Number of rows to skip for pagination (default: 0). Ignored when row_names is set.
+            omit_defaults: If True, leave out fields that equal the row struct's defaults
+                           (missing fields mean "default" when written back).
+            format: 'rows' (default) or 'columnar'. Columnar returns 'row_names' plus
+                    'columns' (one array per field; enums, names, tags and repeated
+                    strings as {dict, codes}). Much smaller for bulk analysis.
+            float_precision: Optional maximum decimal places for float/double values
+                             (e.g., 2 sends 12.35 instead of 12.3456). -1 keeps full precision.
+            where: Optional filter evaluated in the editor before serialization, e.g.
+                   'Level >= 10 and Rarity in (Epic, Legendary)',
+                   'Tags matches Enemy.Boss or not bIsBoss', 'DisplayName contains "orc"'.
+                   Operators: == != < <= > >= in contains matches, combined with and/or/not
+                   and parentheses. Paths may be nested ('Stats.Damage') and reach into
+                   arrays ('Abilities.Cooldown > 2' holds if any element does).
+                   Strings compare case-insensitively; 'matches' is a wildcard for strings
+                   and tag-or-child for gameplay tags. total_count counts matching rows.
+            order_by: Optional comma-separated sort keys, each a field path with optional
+                      'asc' (default) or 'desc' (e.g., 'Price desc,Name'). Sorting happens in
+                      the editor and only the requested page is sent, so 'top 20 by X' is one
+                      call with order_by='X desc' and limit=20.
+            use_cursor: If True, the editor snapshots the matching rows in order and the
+                        response carries 'next_cursor' while more rows remain. Use this to
+                        walk a large result: later pages are cheap slices of the snapshot and
+                        never skip or repeat rows, even if the table is edited meanwhile.
+            cursor: A 'next_cursor' from a previous response. Returns the next 'limit' rows
+                    of that snapshot; where, order_by, row_name_pattern and offset are taken
+                    from the snapshot. If the snapshot was dropped (only the most recent ones
+                    are kept), the error is CURSOR_EXPIRED and the query has to start over.
 
         Returns:
             JSON with:
-            - rows: Array of {row_name, row_data} objects
+            - rows: Array of {row_name, row_data} objects (columnar: row_names + columns)
             - total_count: Total matching rows (before pagination)
             - offset: Applied offset
             - limit: Applied limit
             - missing_rows: (when row_names used) Array of names not found in table
+            - index_used: (when an index from create_index served 'where') {field, type, candidates}
+            - next_cursor: (cursor paging) Cursor of the following page, absent on the last one
+            - snapshot_generation: (cursor paging) Table generation the snapshot was taken at
+            - consistency_break: (cursor paging) True when the table changed since the snapshot;
+              rows keep the snapshot order, show current values, and deleted ones are skipped
         """
         try:
             params = {
@@ -129,13 +186,35 @@ def register_datatable_tools(mcp, connection: UEConnection):
                 params["row_name_pattern"] = row_name_pattern
             if fields:
                 params["fields"] = [f.strip() for f in fields.split(",")]
-            response = connection.send_command("query_datatable", params)
+            if omit_defaults:
+                params["omit_defaults"] = True
+            if float_precision >= 0:
+                params["float_precision"] = float_precision
+            if where:
+                params["where"] = where
+            if order_by:
+                params["order_by"] = [k.strip() for k in order_by.split(",")]
+            if cursor:
+                params["cursor"] = cursor
+            elif use_cursor:
+                params["use_cursor"] = True
+
+            if format == "columnar":
+                params["format"] = "columnar"
+
+            # Cursors name editor-side snapshots, so those pages are never answered from the local cache
+            if "cursor" in params or "use_cursor" in params:
+                response = connection.send_command("query_datatable", params)
+            else:
+                response = connection.send_command_cached("query_datatable", params, ttl=_TTL_REVALIDATE)
             return format_response(response.get("data", {}), "query_datatable")
         except ConnectionError as e:
             return f"Error: {e}"
 
     @mcp.tool()
-    def get_datatable_row(table_path: str, row_name: str) -> str:
+    def get_datatable_row(
+        table_path: str, row_name: str, omit_defaults: bool = False, float_precision: int = -1
+    ) -> str:
         """Get a specific row from a DataTable by its row name.
 
         Use list_datatables to find available tables, and query_datatable to discover row names.
@@ -143,6 +222,10 @@ def register_datatable_tools(mcp, connection: UEConnection):
         Args:
             table_path: Full asset path to the DataTable.
             row_name: The row name/key to look up (e.g., 'Quest_Tutorial_01').
+            omit_defaults: If True, leave out fields that equal the row struct's defaults
+                           (missing fields mean "default" when written back).
+            float_precision: Optional maximum decimal places for float/double values
+                             (e.g., 2 sends 12.35 instead of 12.3456). -1 keeps full precision.
 
         Returns:
             JSON with:
@@ -151,10 +234,15 @@ def register_datatable_tools(mcp, connection: UEConnection):
             - row_data: Object with all row field values
         """
         try:
-            response = connection.send_command("get_datatable_row", {
+            params = {
                 "table_path": table_path,
                 "row_name": row_name,
-            })
+            }
+            if omit_defaults:
+                params["omit_defaults"] = True
+            if float_precision >= 0:
+                params["float_precision"] = float_precision
+            response = connection.send_command_cached("get_datatable_row", params, ttl=_TTL_REVALIDATE)
             return format_response(response.get("data", {}), "get_datatable_row")
         except ConnectionError as e:
             return f"Error: {e}"
@@ -312,6 +400,10 @@ def register_datatable_tools(mcp, connection: UEConnection):
         structs. For FText fields, searches the source/invariant string (English during dev).
         Works with both regular and CompositeDataTables (composites search all aggregated rows).
 
+        Large tables (SearchIndexMinRows, default 2000) keep a trigram index of their text fields, so
+        searches of 3+ characters only check rows that can contain the text; the response then
+        reports 'index_used'.
+
         Use this instead of query_datatable when row names are generic (e.g., 'GenericOrder_1')
         and you need to find rows by their content. Prefer composite tables (e.g., CQT_Quests)
         for broad searches across multiple source tables.
@@ -323,19 +415,22 @@ def register_datatable_tools(mcp, connection: UEConnection):
                     Supports dot-paths for nested structs (e.g., 'Message.BodyText').
                     Leave empty to search all string-like fields.
             preview_fields: Optional comma-separated field names to include in each result
-                            for context (e.g., 'QuestTag,QuestType'). Top-level fields only.
-            limit: Maximum number of matching rows to return (default: 20).
+                            for context (e.g., 'QuestTag,QuestType'). Nested paths such as
+                            'Stats.Damage' are supported.
+            limit: Maximum number of matching rows to return (default: 20). Every row is still
+                   checked, in parallel on large tables, so total_matches stays exact.
 
         Returns:
             JSON with:
             - table_path: The searched table
             - search_text: The search term used
-            - total_matches: Number of matching rows found (capped at limit)
+            - total_matches: Exact number of matching rows (results holds the first 'limit')
             - limit: Applied limit
             - results: Array of matching rows, each with:
               - row_name: The row key
               - matches: Array of {field, value} for each matching field
               - preview: (if preview_fields specified) Object with requested field values
+            - index_used: (indexed tables) {type: 'trigram', candidates} rows checked
         """
         try:
             params = {
@@ -352,6 +447,65 @@ def register_datatable_tools(mcp, connection: UEConnection):
         except ConnectionError as e:
             return f"Error: {e}"
 
+    @mcp.tool()
+    def search_all_content(
+        search_text: str,
+        path_filter: str = "",
+        row_struct: str = "",
+        fields: str = "",
+        preview_fields: str = "",
+        limit: int = 50,
+        include_composites: bool = False,
+        load_unloaded: bool = True,
+    ) -> str:
+        """Search the field values of every DataTable for a case-insensitive substring, in one call.
+
+        Use this to find which tables mention something (e.g., 'Fireball') instead of calling
+        search_datatable_content table by table. Unloaded tables are loaded asynchronously first;
+        all rows are then scanned across worker threads.
+
+        Args:
+            search_text: Case-insensitive substring to search for in string field values.
+            path_filter: Only tables whose asset path starts with this (e.g., '/Game/Data/Quests').
+            row_struct: Only tables with this row struct (e.g., 'QuestRow').
+            fields: Optional comma-separated field names to restrict the search to, matched in
+                    every table (nested same-named fields included).
+            preview_fields: Optional comma-separated field names to include with each result.
+            limit: Maximum number of matching rows returned across all tables (default: 50).
+            include_composites: Also search CompositeDataTables (their rows repeat their parents').
+            load_unloaded: Load DataTables that are not in memory yet (default: True).
+
+        Returns:
+            JSON with:
+            - tables_searched, tables_loaded, rows_checked: Scope of the search
+            - total_matches: Exact number of matching rows across all tables
+            - returned, limit: Result rows included and the cap applied
+            - load_ms, elapsed_ms: Time spent loading tables and in total
+            - tables: Tables with matches, in path order, each with:
+              - table_path, row_struct, total_matches, rows_checked
+              - indexed: Whether the table's trigram index narrowed the rows
+              - search_ms: Worker time spent checking the table's rows
+              - results: {row_name, matches: [{field, value}], preview?}
+        """
+        try:
+            params = {"search_text": search_text, "limit": limit}
+            if path_filter:
+                params["path_filter"] = path_filter
+            if row_struct:
+                params["row_struct"] = row_struct
+            if fields:
+                params["fields"] = [f.strip() for f in fields.split(",")]
+            if preview_fields:
+                params["preview_fields"] = [f.strip() for f in preview_fields.split(",")]
+            if include_composites:
+                params["include_composites"] = True
+            if not load_unloaded:
+                params["load_unloaded"] = False
+            response = connection.send_command("search_all_content", params)
+            return format_response(response.get("data", {}), "search_all_content")
+        except ConnectionError as e:
+            return f"Error: {e}"
+
     @mcp.tool()
     def import_datatable_json(table_path: str, rows: str, mode: str = "create", dry_run: bool = False) -> str:
         """Bulk import rows into a DataTable.
@@ -368,8 +522,13 @@ def register_datatable_tools(mcp, connection: UEConnection):
                   or 'replace' (clear table first). Default: 'create'.
             dry_run: If true, validate without writing. Default: false.
 
+        Rows are deserialized in parallel in the editor and written in one pass, so imports of
+        tens of thousands of rows are fine in a single call. Entries repeating a row name apply
+        in order, each on top of the previous one.
+
         Returns:
-            JSON with counts of created, updated, skipped rows, plus any errors/warnings.
+            JSON with counts of created, updated, skipped rows, plus any errors/warnings,
+            stage_ms (prepare/deserialize/validate/commit timings) and deserialize_chunks.
         """
         try:
             rows_data = json.loads(rows)
@@ -416,7 +575,15 @@ def register_datatable_tools(mcp, connection: UEConnection):
             return f"Error: {e}"
 
     @mcp.tool()
-    def resolve_tags(table_path: str, tag_field: str, tags: str, fields: str = "") -> str:
+    def resolve_tags(
+        table_path: str,
+        tag_field: str,
+        tags: str,
+        match_mode: str = "exact",
+        fields: str = "",
+        omit_defaults: bool = False,
+        float_precision: int = -1,
+    ) -> str:
         """Resolve GameplayTags to DataTable rows containing those tags.
 
         Use to follow tag references between tables. Example: quest has
@@ -428,12 +595,21 @@ def register_datatable_tools(mcp, connection: UEConnection):
             tag_field: Name of the FGameplayTag or FGameplayTagContainer field to match against.
             tags: Comma-separated list of GameplayTag strings to resolve
                   (e.g., 'Patient.NPC.Maria,Patient.NPC.Viktor').
+            match_mode: 'exact' (default) matches rows holding one of the tags itself.
+                        'hierarchical' also matches child tags, so 'Patient.NPC'
+                        finds rows tagged 'Patient.NPC.Maria'.
             fields: Optional comma-separated list of field names to include in results.
                     Leave empty for all fields. Example: 'PatientName,PatientTag'.
+                    Nested paths like 'Stats.Damage' are supported.
+            omit_defaults: If True, leave out fields that equal the row struct's defaults
+                           (missing fields mean "default" when written back).
+            float_precision: Optional maximum decimal places for float/double values
+                             (e.g., 2 sends 12.35 instead of 12.3456). -1 keeps full precision.
 
         Returns:
             JSON with:
-            - resolved: Array of {row_name, row_data, matched_tags} for matching rows
+            - resolved: Array of {row_name, row_data, matched_tags} for matching rows,
+              in table order; matched_tags lists the row's own tags that matched
             - resolved_count: Number of rows that matched
             - unresolved_tags: Tags that didn't match any row
         """
@@ -443,9 +619,132 @@ def register_datatable_tools(mcp, connection: UEConnection):
                 "tag_field": tag_field,
                 "tags": [t.strip() for t in tags.split(",")],
             }
+            if match_mode != "exact":
+                params["match_mode"] = match_mode
             if fields:
                 params["fields"] = [f.strip() for f in fields.split(",")]
-            response = connection.send_command("resolve_tags", params)
+            if omit_defaults:
+                params["omit_defaults"] = True
+            if float_precision >= 0:
+                params["float_precision"] = float_precision
+            response = connection.send_command_cached("resolve_tags", params, ttl=_TTL_REVALIDATE)
             return format_response(response.get("data", {}), "resolve_tags")
         except ConnectionError as e:
             return f"Error: {e}"
+
+    @mcp.tool()
+    def get_composite_layout(table_path: str, row_names: str = "", overridden_only: bool = False) -> str:
+        """Show which source table supplies each row of a CompositeDataTable, and what it overrides.
+
+        Use before editing composite rows to see where a write will land, or to audit which
+        rows a patch table overrides.
+
+        Args:
+            table_path: Full asset path to the CompositeDataTable.
+            row_names: Optional comma-separated row names to report. Leave empty for all rows.
+            overridden_only: If True, only report rows present in more than one source table.
+
+        Returns:
+            JSON with:
+            - parent_tables: Direct parents as listed on the composite ({name, path})
+            - sources: Non-composite source tables in override order (nested composites
+              expanded), each with index, name, path, row_count, owned_rows, overridden_rows
+            - row_count, overridden_count: Rows in the composite, and how many are overridden
+            - rows: Array of {row_name, source, chain}; chain lists the indices of every source
+              holding the row, lowest priority first, and source (the last one) is where writes go
+            - missing_rows: Requested row names no source has
+        """
+        try:
+            params = {"table_path": table_path}
+            if row_names:
+                params["row_names"] = [r.strip() for r in row_names.split(",")]
+            if overridden_only:
+                params["overridden_only"] = True
+            response = connection.send_command("get_composite_layout", params)
+            return format_response(response.get("data", {}), "get_composite_layout")
+        except ConnectionError as e:
+            return f"Error: {e}"
+
+    @mcp.tool()
+    def create_index(table_path: str, field: str, type: str = "hash", drop: bool = False) -> str:
+        """Build an in-editor index on a DataTable field so query_datatable 'where' filters skip full scans.
+
+        Worth it for large tables queried repeatedly on the same field. Indexes live in editor
+        memory, stay current across row edits, and are used automatically; query_datatable
+        reports 'index_used' when one served the query.
+
+        Args:
+            table_path: Full asset path to the DataTable.
+            field: Field path to index (e.g., 'Rarity', 'Stats.Damage'). Must not go through arrays.
+            type: 'hash' (default) serves == and in; 'sorted' also serves < <= > >= on numbers and enums;
+                'bitmap' suits enum, bool and gameplay tag fields (including tag containers) with few
+                distinct values, and answers and/or/not combinations of bitmap-indexed fields exactly.
+            drop: If True, remove the index on this field instead of building one.
+
+        Returns:
+            JSON with:
+            - field, type: The index built
+            - row_count, key_count: Rows indexed and distinct keys
+            - build_ms: Build time
+            - indexes: All indexes on the table ({field, type})
+            - dropped: (drop=True) Whether an index was removed
+        """
+        try:
+            params = {"table_path": table_path, "field": field}
+            if drop:
+                response = connection.send_command("drop_index", params)
+                return format_response(response.get("data", {}), "drop_index")
+            params["type"] = type
+            response = connection.send_command("create_index", params)
+            return format_response(response.get("data", {}), "create_index")
+        except ConnectionError as e:
+            return f"Error: {e}"
+
+    @mcp.tool()
+    def aggregate_datatable(
+        table_path: str,
+        metrics: str = "count",
+        group_by: str = "",
+        where: str = "",
+        row_name_pattern: str = "",
+    ) -> str:
+        """Compute counts, sums, averages, distinct counts and histograms over DataTable rows in the editor.
+
+        Only the aggregates travel back, never the rows, so questions like "average damage per
+        rarity" or "how many bosses above level 50" cost one small call regardless of table size.
+
+        Args:
+            table_path: Full asset path to the DataTable.
+            metrics: Comma-separated metrics (default: 'count'):
+                     'count' (rows), 'count(Path)' (values; array paths count elements),
+                     'sum(Path)', 'avg(Path)', 'min(Path)', 'max(Path)' (numbers and bools),
+                     'distinct(Path)', 'histogram(Path)' or 'histogram(Path, N)'
+                     (numbers: N equal-width buckets, default 10; other fields: count per value).
+                     Paths may be nested ('Stats.Damage') and reach into arrays ('Abilities.Damage').
+                     Example: 'count,avg(Stats.Damage),histogram(Level, 5)'.
+            group_by: Optional comma-separated single-valued field paths to group by (e.g., 'Rarity,bIsBoss').
+            where: Optional filter, same syntax as query_datatable (e.g., 'Level >= 10 and not bIsBoss').
+            row_name_pattern: Optional wildcard pattern on row names (e.g., 'Enemy_*').
+
+        Returns:
+            JSON with:
+            - aggregates: {metric: value} (without group_by)
+            - groups: [{group: {field: value}, metric: value, ...}] in order of first appearance,
+              plus group_count (with group_by)
+            - row_count: Rows that passed the filters
+            - aggregate_ms: Time spent reducing
+            - columnar: (large tables) True when the reduction ran on the editor's column copy
+            - index_used: (when an index from create_index served 'where') {field, type, candidates}
+        """
+        try:
+            params = {"table_path": table_path, "metrics": _split_top_level(metrics)}
+            if group_by:
+                params["group_by"] = _split_top_level(group_by)
+            if where:
+                params["where"] = where
+            if row_name_pattern:
+                params["row_name_pattern"] = row_name_pattern
+            response = connection.send_command_cached("aggregate_datatable", params, ttl=_TTL_REVALIDATE)
+            return format_response(response.get("data", {}), "aggregate_datatable")
+        except ConnectionError as e:
+            return f"Error: {e}"
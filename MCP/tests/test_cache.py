@@ -5,6 +5,7 @@ import unittest
 from unittest.mock import patch
 
 from unreal_data_bridge_mcp.cache import ResponseCache
+from unreal_data_bridge_mcp.tcp_client import UEConnection
 
 
 class TestResponseCache(unittest.TestCase):
@@ -126,5 +127,68 @@ class TestResponseCache(unittest.TestCase):
         self.assertEqual(result, {"v": 2})
 
 
+class TestETagRevalidation(unittest.TestCase):
+
+    def setUp(self):
+        self.cache = ResponseCache()
+
+    def test_expired_entry_with_etag_is_kept(self):
+        now = 1000.0
+        with patch("unreal_data_bridge_mcp.cache.time") as mock_time:
+            mock_time.monotonic.return_value = now
+            self.cache.set("key", {"data": {"etag": "abc"}}, ttl=5)
+
+            mock_time.monotonic.return_value = now + 6
+            self.assertIsNone(self.cache.get("key"))
+            self.assertEqual(self.cache.get_etag("key"), "abc")
+
+            revalidated = self.cache.revalidate("key", ttl=5)
+            self.assertEqual(revalidated, {"data": {"etag": "abc"}})
+            self.assertIsNotNone(self.cache.get("key"))
+            self.assertEqual(self.cache.stats["revalidations"], 1)
+
+    def test_max_entries_drops_oldest(self):
+        cache = ResponseCache(max_entries=2)
+        cache.set("a", {"v": 1}, ttl=60)
+        cache.set("b", {"v": 2}, ttl=60)
+        cache.set("c", {"v": 3}, ttl=60)
+        self.assertIsNone(cache.get("a"))
+        self.assertIsNotNone(cache.get("c"))
+
+    def _connection(self, responses):
+        connection = UEConnection()
+        sent = []
+
+        def fake_send(command, params=None):
+            sent.append(params)
+            return responses.pop(0)
+
+        connection.send_command = fake_send
+        return connection, sent
+
+    def test_not_modified_reuses_cached_response(self):
+        full = {"success": True, "data": {"row_data": {"Level": 3}, "etag": "e1"}}
+        not_modified = {"success": True, "data": {"not_modified": True, "etag": "e1"}}
+        connection, sent = self._connection([full, not_modified])
+
+        first = connection.send_command_cached("get_datatable_row", {"row_name": "A"}, ttl=0)
+        second = connection.send_command_cached("get_datatable_row", {"row_name": "A"}, ttl=0)
+
+        self.assertEqual(first, full)
+        self.assertEqual(second, full)
+        self.assertNotIn("if_none_match", sent[0])
+        self.assertEqual(sent[1]["if_none_match"], "e1")
+
+    def test_changed_response_replaces_cached_one(self):
+        old = {"success": True, "data": {"row_data": {"Level": 3}, "etag": "e1"}}
+        new = {"success": True, "data": {"row_data": {"Level": 4}, "etag": "e2"}}
+        connection, sent = self._connection([old, new, dict(new)])
+
+        connection.send_command_cached("get_datatable_row", {"row_name": "A"}, ttl=0)
+        self.assertEqual(connection.send_command_cached("get_datatable_row", {"row_name": "A"}, ttl=0), new)
+        connection.send_command_cached("get_datatable_row", {"row_name": "A"}, ttl=0)
+        self.assertEqual(sent[2]["if_none_match"], "e2")
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,70 @@
+"""Unit tests for columnar result helpers."""
+
+import json
+import unittest
+
+from unreal_data_bridge_mcp.columnar import decode_column, expand_columnar, slice_columnar
+from unreal_data_bridge_mcp.response import format_response
+
+
+def _columnar_page():
+    return {
+        "table_path": "/Game/DT_Test.DT_Test",
+        "format": "columnar",
+        "row_names": ["Row_0", "Row_1", "Row_2"],
+        "columns": {
+            "Level": [1, 2, 3],
+            "Rarity": {"dict": ["Common", "Rare"], "codes": [0, 1, 0]},
+            "Stats": [{"Damage": 1.5}, {"Damage": 2.5}, {"Damage": 3.5}],
+        },
+        "total_count": 3,
+        "offset": 0,
+        "limit": 25,
+    }
+
+
+class TestColumnar(unittest.TestCase):
+
+    def test_decode_plain_column(self):
+        self.assertEqual(decode_column([1, 2, 3]), [1, 2, 3])
+
+    def test_decode_dictionary_column(self):
+        column = {"dict": ["A", "B"], "codes": [1, 0, 1]}
+        self.assertEqual(decode_column(column), ["B", "A", "B"])
+
+    def test_expand_matches_row_format(self):
+        expanded = expand_columnar(_columnar_page())
+        self.assertNotIn("columns", expanded)
+        self.assertNotIn("format", expanded)
+        self.assertEqual(expanded["total_count"], 3)
+        self.assertEqual(expanded["rows"][1], {
+            "row_name": "Row_1",
+            "row_data": {"Level": 2, "Rarity": "Rare", "Stats": {"Damage": 2.5}},
+        })
+        # Key order follows the row-format response
+        self.assertEqual(list(expanded)[:2], ["table_path", "rows"])
+
+    def test_expand_passes_through_row_format(self):
+        data = {"rows": [], "total_count": 0}
+        self.assertIs(expand_columnar(data), data)
+
+    def test_slice_keeps_dictionary(self):
+        sliced = slice_columnar(_columnar_page(), 2)
+        self.assertEqual(sliced["row_names"], ["Row_0", "Row_1"])
+        self.assertEqual(sliced["columns"]["Level"], [1, 2])
+        self.assertEqual(sliced["columns"]["Rarity"], {"dict": ["Common", "Rare"], "codes": [0, 1]})
+
+    def test_format_response_truncates_columnar(self):
+        page = _columnar_page()
+        page["row_names"] = [f"Row_{i}" for i in range(5000)]
+        page["columns"] = {"Name": [f"Some long display name {i}" for i in range(5000)]}
+        result = json.loads(format_response(page, "query_datatable"))
+        returned = result["_truncated"]["returned_count"]
+        self.assertGreater(returned, 0)
+        self.assertLess(returned, 5000)
+        self.assertEqual(len(result["row_names"]), returned)
+        self.assertEqual(len(result["columns"]["Name"]), returned)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,119 @@
+"""Unit tests for wire encodings and MessagePack framing."""
+
+import json
+import socket
+import struct
+import threading
+import unittest
+
+from unreal_data_bridge_mcp.encoding import (
+    ENCODING_JSON,
+    ENCODING_MSGPACK,
+    FRAME_MARKER,
+    decode_response,
+    encode_request,
+    msgpack_available,
+    split_response,
+)
+from unreal_data_bridge_mcp.tcp_client import UEConnection
+
+try:
+    import msgpack
+except ImportError:
+    msgpack = None
+
+
+class TestJsonEncoding(unittest.TestCase):
+
+    def test_request_is_newline_terminated(self):
+        data = encode_request("ping", None, ENCODING_JSON)
+        self.assertTrue(data.endswith(b"\n"))
+        self.assertEqual(split_response(data, ENCODING_JSON)[1], b"")
+
+    def test_partial_line_needs_more(self):
+        self.assertIsNone(split_response(b'{"success": tr', ENCODING_JSON))
+
+
+@unittest.skipUnless(msgpack_available(), "msgpack not installed")
+class TestMsgPackEncoding(unittest.TestCase):
+
+    def test_frame_header(self):
+        data = encode_request("ping", {"a": 1}, ENCODING_MSGPACK)
+        marker, length = struct.unpack_from(">BI", data)
+        self.assertEqual(marker, FRAME_MARKER)
+        self.assertEqual(length, len(data) - 5)
+
+    def test_round_trip_keeps_floats_exact(self):
+        data = encode_request("query", {"value": 0.1, "tags": ["A.B"]}, ENCODING_MSGPACK)
+        payload, remainder = split_response(data, ENCODING_MSGPACK)
+        self.assertEqual(remainder, b"")
+        decoded = decode_response(payload, ENCODING_MSGPACK)
+        self.assertEqual(decoded["params"]["value"], 0.1)
+        self.assertEqual(decoded["params"]["tags"], ["A.B"])
+
+    def test_partial_frame_needs_more(self):
+        data = encode_request("ping", None, ENCODING_MSGPACK)
+        self.assertIsNone(split_response(data[:3], ENCODING_MSGPACK))
+        self.assertIsNone(split_response(data[:-1], ENCODING_MSGPACK))
+
+    def test_bad_marker_raises(self):
+        with self.assertRaises(ValueError):
+            split_response(b"{\x00\x00\x00\x00", ENCODING_MSGPACK)
+
+
+@unittest.skipUnless(msgpack_available(), "msgpack not installed")
+class TestNegotiation(unittest.TestCase):
+    """Runs the client against a minimal fake plugin speaking both encodings."""
+
+    def _serve(self, listener, encodings):
+        conn, _ = listener.accept()
+        buffer = b""
+        with conn:
+            while True:
+                chunk = conn.recv(65536)
+                if not chunk:
+                    return
+                buffer += chunk
+                while buffer:
+                    encoding = ENCODING_MSGPACK if buffer[0] == FRAME_MARKER else ENCODING_JSON
+                    split = split_response(buffer, encoding)
+                    if split is None:
+                        break
+                    payload, buffer = split
+                    request = decode_response(payload, encoding)
+                    data = {"message": "pong", "encodings": encodings}
+                    if request["command"] != "ping":
+                        data = {"encoding": encoding, "echo": request["params"]}
+                    response = {"success": True, "data": data, "timing_ms": 0.0}
+                    if encoding == ENCODING_MSGPACK:
+                        body = msgpack.packb(response, use_bin_type=True)
+                        conn.sendall(struct.pack(">BI", FRAME_MARKER, len(body)) + body)
+                    else:
+                        conn.sendall((json.dumps(response) + "\n").encode("utf-8"))
+
+    def _connect(self, encodings):
+        listener = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        listener.bind(("127.0.0.1", 0))
+        listener.listen(1)
+        self.addCleanup(listener.close)
+        thread = threading.Thread(target=self._serve, args=(listener, encodings), daemon=True)
+        thread.start()
+        connection = UEConnection(port=listener.getsockname()[1], encoding=ENCODING_MSGPACK)
+        self.addCleanup(connection.disconnect)
+        return connection
+
+    def test_switches_to_msgpack_when_supported(self):
+        connection = self._connect(["json", "msgpack"])
+        response = connection.send_command("echo", {"x": 1.5})
+        self.assertEqual(connection.encoding, ENCODING_MSGPACK)
+        self.assertEqual(response["data"], {"encoding": "msgpack", "echo": {"x": 1.5}})
+
+    def test_stays_on_json_for_old_plugins(self):
+        connection = self._connect(["json"])
+        response = connection.send_command("echo", {"x": 1.5})
+        self.assertEqual(connection.encoding, ENCODING_JSON)
+        self.assertEqual(response["data"]["encoding"], "json")
+
+
+if __name__ == "__main__":
+    unittest.main()
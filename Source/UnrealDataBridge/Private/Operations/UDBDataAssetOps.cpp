@@ -109,7 +109,9 @@ FUDBCommandResult FUDBDataAssetOps::GetDataAsset(const TSharedPtr<FJsonObject>&
 
 	UClass* AssetClass = DataAsset->GetClass();
 
-	TSharedPtr<FJsonObject> Properties = FUDBSerializer::StructToJson(AssetClass, DataAsset);
+	// omit_defaults compares against the class default object
+	const FUDBSerializeOptions SerializeOptions = FUDBSerializeOptions::FromParams(Params, AssetClass);
+	TSharedPtr<FJsonObject> Properties = FUDBSerializer::StructToJson(AssetClass, DataAsset, nullptr, SerializeOptions);
 
 	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
 	Data->SetStringField(TEXT("asset_path"), AssetPath);
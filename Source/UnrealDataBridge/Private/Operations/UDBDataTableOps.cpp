@@ -1,6 +1,20 @@
 
 #include "Operations/UDBDataTableOps.h"
 #include "UDBSerializer.h"
+#include "UDBSchemaCache.h"
+#include "UDBRowCache.h"
+#include "UDBTableVersions.h"
+#include "UDBRowFilter.h"
+#include "UDBTableIndexes.h"
+#include "UDBRowOrder.h"
+#include "UDBAggregate.h"
+#include "UDBColumnStore.h"
+#include "UDBTextIndex.h"
+#include "UDBTagIndex.h"
+#include "UDBCompositeLayout.h"
+#include "UDBRowNameIndex.h"
+#include "UDBQueryCursors.h"
+#include "UDBSettings.h"
 #include "Engine/DataTable.h"
 #include "Engine/CompositeDataTable.h"
 #include "UObject/UObjectIterator.h"
@@ -19,6 +33,13 @@
 #include "Engine/DataAsset.h"
 #include "ScopedTransaction.h"
 #include "UDBEditorUtils.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/App.h"
+#include "Misc/MemStack.h"
+#include "Async/ParallelFor.h"
+#include "AssetRegistry/ARFilter.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/PlatformTime.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUDBDataTableOps, Log, All);
 
@@ -35,91 +56,137 @@ UDataTable* FUDBDataTableOps::LoadDataTable(const FString& TablePath, FUDBComman
 	return DataTable;
 }
 
-TArray<UDataTable*> FUDBDataTableOps::GetParentTables(const UCompositeDataTable* CompositeTable)
+TArray<TSharedPtr<FJsonValue>> FUDBDataTableOps::GetParentTablesJsonArray(const UCompositeDataTable* CompositeTable)
 {
-	TArray<UDataTable*> Result;
-	if (CompositeTable == nullptr)
-	{
-		return Result;
-	}
-
-	const FArrayProperty* ParentTablesProp = CastField<FArrayProperty>(
-		UCompositeDataTable::StaticClass()->FindPropertyByName(TEXT("ParentTables"))
-	);
-	if (ParentTablesProp == nullptr)
+	TArray<TSharedPtr<FJsonValue>> JsonArray;
+	for (const UDataTable* Parent : FUDBCompositeLayout::ReadParentTables(CompositeTable))
 	{
-		UE_LOG(LogUDBDataTableOps, Warning, TEXT("Could not find ParentTables property on UCompositeDataTable"));
-		return Result;
+		TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+		Entry->SetStringField(TEXT("name"), Parent->GetName());
+		Entry->SetStringField(TEXT("path"), Parent->GetPathName());
+		JsonArray.Add(MakeShared<FJsonValueObject>(Entry));
 	}
 
-	FScriptArrayHelper ArrayHelper(ParentTablesProp, ParentTablesProp->ContainerPtrToValuePtr<void>(CompositeTable));
-	const FObjectProperty* InnerProp = CastField<FObjectProperty>(ParentTablesProp->Inner);
-	if (InnerProp == nullptr)
-	{
-		return Result;
-	}
+	return JsonArray;
+}
 
-	for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+FUDBFieldProjection FUDBDataTableOps::ParseFieldProjection(const TSharedPtr<FJsonObject>& Params, const FString& ParamName, TArray<FString>& OutWarnings, const UStruct* StructType)
+{
+	TArray<FString> Paths;
+	const TArray<TSharedPtr<FJsonValue>>* FieldsArray = nullptr;
+	if (Params.IsValid() && Params->TryGetArrayField(ParamName, FieldsArray) && FieldsArray != nullptr)
 	{
-		UObject* Obj = InnerProp->GetObjectPropertyValue(ArrayHelper.GetRawPtr(Index));
-		UDataTable* Table = Cast<UDataTable>(Obj);
-		if (Table != nullptr)
+		for (const TSharedPtr<FJsonValue>& FieldValue : *FieldsArray)
 		{
-			Result.Add(Table);
+			FString FieldName;
+			if (FieldValue.IsValid() && FieldValue->TryGetString(FieldName))
+			{
+				Paths.Add(FieldName);
+			}
 		}
 	}
 
-	return Result;
+	TArray<FString> Errors;
+	FUDBFieldProjection Projection = FUDBFieldProjection::FromStrings(Paths, Errors);
+	Projection.Validate(StructType, Errors);
+	for (const FString& Error : Errors)
+	{
+		OutWarnings.Add(FString::Printf(TEXT("%s: %s (ignored)"), *ParamName, *Error));
+	}
+	return Projection;
 }
 
-TArray<TSharedPtr<FJsonValue>> FUDBDataTableOps::GetParentTablesJsonArray(const UCompositeDataTable* CompositeTable)
+int32 FUDBDataTableOps::GetSerializeChunkCount(int32 NumRows)
 {
-	TArray<TSharedPtr<FJsonValue>> JsonArray;
-	TArray<UDataTable*> Parents = GetParentTables(CompositeTable);
-
-	for (const UDataTable* Parent : Parents)
+	const int32 Threshold = UUDBSettings::Get()->ParallelSerializeMinRows;
+	if (Threshold <= 0 || NumRows < Threshold || !FApp::ShouldUseThreadingForPerformance())
 	{
-		TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
-		Entry->SetStringField(TEXT("name"), Parent->GetName());
-		Entry->SetStringField(TEXT("path"), Parent->GetPathName());
-		JsonArray.Add(MakeShared<FJsonValueObject>(Entry));
+		return 1;
 	}
 
-	return JsonArray;
+	// One chunk per worker plus the calling thread; below ~64 rows a chunk costs more to schedule than to run
+	const int32 MaxChunks = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	return FMath::Clamp(NumRows / 64, 1, MaxChunks);
 }
 
-UDataTable* FUDBDataTableOps::FindSourceTableForRow(const UCompositeDataTable* CompositeTable, FName RowName)
+TArray<TSharedPtr<FJsonObject>> FUDBDataTableOps::SerializeRowEntries(
+	const UDataTable* DataTable,
+	const UScriptStruct* RowStruct,
+	TConstArrayView<TPair<FName, const uint8*>> Rows,
+	const FUDBFieldProjection& FieldsProjection,
+	const FUDBSerializeOptions& Options,
+	FUDBJsonFragmentMap& OutFragments)
 {
-	TArray<UDataTable*> Parents = GetParentTables(CompositeTable);
-
-	// Search back-to-front: higher-index tables override lower-index ones
-	for (int32 Index = Parents.Num() - 1; Index >= 0; --Index)
-	{
-		UDataTable* Parent = Parents[Index];
-		if (Parent == nullptr)
+	const bool bUseRowCache = DataTable != nullptr && FUDBRowCache::IsEnabled();
+	const uint64 VariantKey = bUseRowCache ? FUDBRowCache::MakeVariantKey(FieldsProjection, Options) : 0;
+
+	TArray<TSharedPtr<FJsonObject>> RowJsons;
+	TArray<FUDBJsonFragment> RowUtf8;
+	RowJsons.SetNum(Rows.Num());
+	RowUtf8.SetNum(Rows.Num());
+
+	// Cache hits are filled in directly; only the misses go through reflection.
+	// Their indices and row pointers are request scratch, released when this returns.
+	FMemMark ScratchMark(FMemStack::Get());
+	TArray<int32, TMemStackAllocator<>> MissIndices;
+	TArray<const void*, TMemStackAllocator<>> MissDatas;
+	MissIndices.Reserve(Rows.Num());
+	MissDatas.Reserve(Rows.Num());
+	for (int32 Index = 0; Index < Rows.Num(); ++Index)
+	{
+		FUDBCachedRow Cached;
+		if (bUseRowCache && FUDBRowCache::Find(DataTable, Rows[Index].Key, VariantKey, Cached))
 		{
+			// Response trees take mutable objects but only read this shared one
+			RowJsons[Index] = ConstCastSharedPtr<FJsonObject>(Cached.Json);
+			RowUtf8[Index] = MoveTemp(Cached.Utf8);
 			continue;
 		}
+		MissIndices.Add(Index);
+		MissDatas.Add(Rows[Index].Value);
+	}
+
+	if (MissDatas.Num() > 0)
+	{
+		// Misses are encoded on the workers when parallel, or when the bytes are going into the cache
+		const int32 NumChunks = GetSerializeChunkCount(MissDatas.Num());
+		TArray<TSharedPtr<FJsonObject>> MissJsons;
+		TArray<FUDBJsonFragment> MissUtf8;
+		FUDBSerializer::StructsToJson(RowStruct, MissDatas, FieldsProjection, Options, NumChunks, MissJsons,
+			(NumChunks > 1 || bUseRowCache) ? &MissUtf8 : nullptr);
 
-		// If parent is itself a composite, recurse
-		const UCompositeDataTable* NestedComposite = Cast<UCompositeDataTable>(Parent);
-		if (NestedComposite != nullptr)
+		for (int32 MissIndex = 0; MissIndex < MissIndices.Num(); ++MissIndex)
 		{
-			UDataTable* NestedResult = FindSourceTableForRow(NestedComposite, RowName);
-			if (NestedResult != nullptr)
+			const int32 Index = MissIndices[MissIndex];
+			RowJsons[Index] = MissJsons[MissIndex];
+			if (MissUtf8.IsValidIndex(MissIndex))
 			{
-				return NestedResult;
+				RowUtf8[Index] = MissUtf8[MissIndex];
+				if (bUseRowCache)
+				{
+					FUDBRowCache::Add(DataTable, Rows[Index].Key, VariantKey, RowJsons[Index], RowUtf8[Index]);
+				}
 			}
-			continue;
 		}
+	}
+
+	TArray<TSharedPtr<FJsonObject>> Entries;
+	Entries.Reserve(Rows.Num());
+	for (int32 Index = 0; Index < Rows.Num(); ++Index)
+	{
+		TSharedRef<FJsonObject> EntryJson = MakeShared<FJsonObject>();
+		EntryJson->SetStringField(TEXT("row_name"), Rows[Index].Key.ToString());
+		EntryJson->SetObjectField(TEXT("row_data"), RowJsons[Index]);
+		Entries.Add(EntryJson);
 
-		if (Parent->FindRowUnchecked(RowName) != nullptr)
+		// Cached rows and rows encoded on the workers are spliced by the response writer instead of re-encoded here
+		if (RowUtf8[Index].IsValid())
 		{
-			return Parent;
+			OutFragments.Add(RowJsons[Index].Get(), RowUtf8[Index]);
 		}
 	}
 
-	return nullptr;
+	return Entries;
 }
 
 FUDBCommandResult FUDBDataTableOps::ListDatatables(const TSharedPtr<FJsonObject>& Params)
@@ -212,12 +279,94 @@ FUDBCommandResult FUDBDataTableOps::GetDatatableSchema(const TSharedPtr<FJsonObj
 		Params->TryGetBoolField(TEXT("include_inherited"), bIncludeInherited);
 	}
 
+	const FUDBCachedSchema Schema = FUDBSchemaCache::Get(RowStruct, bIncludeInherited);
+
 	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
 	Data->SetStringField(TEXT("table_path"), TablePath);
 	Data->SetStringField(TEXT("row_struct_name"), RowStruct->GetName());
-	Data->SetObjectField(TEXT("schema"), FUDBSerializer::GetStructSchema(RowStruct, bIncludeInherited));
+	Data->SetObjectField(TEXT("schema"), Schema.Schema);
+	Data->SetStringField(TEXT("schema_hash"), Schema.Hash);
 
-	return FUDBCommandHandler::Success(Data);
+	FUDBCommandResult Result = FUDBCommandHandler::Success(Data);
+	Result.PreserializedObjects.Add(Schema.Schema.Get(), Schema.Utf8);
+	return Result;
+}
+
+/**
+ * Visit every row that passes the optional where filter and row-name wildcard, in table order.
+ * When an index can narrow the filter, only its candidates are visited (in index order) and
+ * true is returned with OutIndexLookup describing the index. Otherwise the filter runs on the
+ * table's FUDBColumnStore columns when it can, or row by row.
+ */
+static bool ForEachMatchingRow(
+	const UDataTable* DataTable,
+	const FUDBRowFilter* WhereFilter,
+	const FString& RowNamePattern,
+	FUDBIndexLookup& OutIndexLookup,
+	TFunctionRef<void(FName, const uint8*)> Visitor)
+{
+	const FUDBRowNameIndex::FPattern NamePattern(RowNamePattern);
+
+	if (WhereFilter != nullptr && FUDBTableIndexes::FindCandidates(DataTable, *WhereFilter, OutIndexLookup))
+	{
+		// An index narrowed the rows; the full predicate still decides each candidate
+		for (const FName& Name : OutIndexLookup.Rows)
+		{
+			const uint8* RowData = DataTable->FindRowUnchecked(Name);
+			if (RowData == nullptr || !WhereFilter->Matches(RowData) || !NamePattern.Matches(Name))
+			{
+				continue;
+			}
+			Visitor(Name, RowData);
+		}
+		return true;
+	}
+
+	// Large tables answer number/enum/bool predicates from their column copy, still in table order
+	FUDBColumnStore::FScan ColumnScan;
+	if (WhereFilter != nullptr && FUDBColumnStore::Scan(DataTable, WhereFilter, ColumnScan))
+	{
+		for (int32 Index = 0; Index < ColumnScan.Mask.Num(); ++Index)
+		{
+			if (!ColumnScan.Mask[Index])
+			{
+				continue;
+			}
+			const FName& Name = ColumnScan.RowNames[Index];
+			if (!NamePattern.Matches(Name))
+			{
+				continue;
+			}
+			Visitor(Name, ColumnScan.RowDatas[Index]);
+		}
+		return false;
+	}
+
+	// Wildcard pattern filtering, straight off the row map rather than a copied name array
+	for (const TPair<FName, uint8*>& RowPair : DataTable->GetRowMap())
+	{
+		const FName& Name = RowPair.Key;
+		if (!NamePattern.Matches(Name))
+		{
+			continue;
+		}
+		if (WhereFilter != nullptr && !WhereFilter->Matches(RowPair.Value))
+		{
+			continue;
+		}
+		Visitor(Name, RowPair.Value);
+	}
+	return false;
+}
+
+/** {field, type, candidates} describing the index that served a read */
+static TSharedPtr<FJsonObject> MakeIndexUsedJson(const FUDBIndexLookup& IndexLookup)
+{
+	TSharedPtr<FJsonObject> IndexJson = MakeShared<FJsonObject>();
+	IndexJson->SetStringField(TEXT("field"), IndexLookup.Field);
+	IndexJson->SetStringField(TEXT("type"), FUDBTableIndexes::LexToString(IndexLookup.Type));
+	IndexJson->SetNumberField(TEXT("candidates"), IndexLookup.Rows.Num());
+	return IndexJson;
 }
 
 FUDBCommandResult FUDBDataTableOps::QueryDatatable(const TSharedPtr<FJsonObject>& Params)
@@ -247,6 +396,13 @@ FUDBCommandResult FUDBDataTableOps::QueryDatatable(const TSharedPtr<FJsonObject>
 		);
 	}
 
+	// Unchanged table and identical request: answer without touching a single row
+	const FString ETag = FUDBTableVersions::MakeReadETag(DataTable, Params);
+	if (FUDBCommandHandler::MatchesIfNoneMatch(Params, ETag))
+	{
+		return FUDBCommandHandler::NotModified(ETag);
+	}
+
 	// Parse optional params
 	FString RowNamePattern;
 	if (Params.IsValid())
@@ -271,22 +427,32 @@ FUDBCommandResult FUDBDataTableOps::QueryDatatable(const TSharedPtr<FJsonObject>
 		}
 	}
 
-	// Parse optional fields projection
-	TSet<FString> FieldsProjection;
-	if (Params.IsValid())
+	// Cursor paging: use_cursor snapshots the matching rows on the first page, cursor continues from the snapshot
+	FString Cursor;
+	Params->TryGetStringField(TEXT("cursor"), Cursor);
+	bool bUseCursor = false;
+	Params->TryGetBoolField(TEXT("use_cursor"), bUseCursor);
+	const bool bFromCursor = !Cursor.IsEmpty();
+
+	// Parse optional fields projection (top-level names or nested paths like "Stats.Damage")
+	TArray<FString> Warnings;
+	const FUDBFieldProjection FieldsProjection = ParseFieldProjection(Params, TEXT("fields"), Warnings, RowStruct);
+	const FUDBSerializeOptions SerializeOptions = FUDBSerializeOptions::FromParams(Params, RowStruct);
+
+	// Parse optional result format: "rows" (default) or "columnar"
+	FString Format = TEXT("rows");
+	Params->TryGetStringField(TEXT("format"), Format);
+	const bool bColumnar = Format.Equals(TEXT("columnar"), ESearchCase::IgnoreCase);
+	if (!bColumnar && !Format.Equals(TEXT("rows"), ESearchCase::IgnoreCase))
 	{
-		const TArray<TSharedPtr<FJsonValue>>* FieldsArray = nullptr;
-		if (Params->TryGetArrayField(TEXT("fields"), FieldsArray) && FieldsArray != nullptr)
-		{
-			for (const TSharedPtr<FJsonValue>& FieldValue : *FieldsArray)
-			{
-				FString FieldName;
-				if (FieldValue.IsValid() && FieldValue->TryGetString(FieldName))
-				{
-					FieldsProjection.Add(FieldName);
-				}
-			}
-		}
+		return FUDBCommandHandler::Error(
+			UDBErrorCodes::InvalidValue,
+			FString::Printf(TEXT("Invalid format '%s'. Must be one of: rows, columnar"), *Format)
+		);
+	}
+	if (bColumnar && SerializeOptions.DefaultData != nullptr)
+	{
+		Warnings.Add(TEXT("omit_defaults is ignored for columnar results (columns need one value per row)"));
 	}
 
 	// Parse optional row_names (exact match list)
@@ -307,19 +473,101 @@ FUDBCommandResult FUDBDataTableOps::QueryDatatable(const TSharedPtr<FJsonObject>
 		}
 	}
 
-	// Filtering
-	TArray<FName> FilteredRowNames;
+	// Parse optional where expression, compiled once against the row struct
+	TSharedPtr<const FUDBRowFilter> WhereFilter;
+	FString WhereExpression;
+	if (Params->TryGetStringField(TEXT("where"), WhereExpression) && !WhereExpression.TrimStartAndEnd().IsEmpty())
+	{
+		FString WhereError;
+		WhereFilter = FUDBRowFilter::Compile(RowStruct, WhereExpression, WhereError);
+		if (!WhereFilter.IsValid())
+		{
+			return FUDBCommandHandler::Error(
+				UDBErrorCodes::InvalidValue,
+				FString::Printf(TEXT("Invalid where expression: %s"), *WhereError)
+			);
+		}
+	}
+
+	// Parse optional order_by: ["Field", "Field desc", ...]
+	TSharedPtr<const FUDBRowOrder> Order;
+	const TArray<TSharedPtr<FJsonValue>>* OrderByArray = nullptr;
+	if (Params->TryGetArrayField(TEXT("order_by"), OrderByArray) && OrderByArray != nullptr && OrderByArray->Num() > 0)
+	{
+		TArray<FString> OrderKeys;
+		for (const TSharedPtr<FJsonValue>& KeyValue : *OrderByArray)
+		{
+			FString KeySpec;
+			if (KeyValue.IsValid() && KeyValue->TryGetString(KeySpec))
+			{
+				OrderKeys.Add(KeySpec);
+			}
+		}
+
+		FString OrderError;
+		Order = FUDBRowOrder::Compile(RowStruct, OrderKeys, OrderError);
+		if (!Order.IsValid())
+		{
+			return FUDBCommandHandler::Error(
+				UDBErrorCodes::InvalidValue,
+				FString::Printf(TEXT("Invalid order_by: %s"), *OrderError)
+			);
+		}
+	}
+
+	// Filtering; the name and row-pointer lists are request scratch on the mem stack
+	FMemMark ScratchMark(FMemStack::Get());
+	TArray<FName, TMemStackAllocator<>> FilteredRowNames;
 	TArray<FString> MissingNames;
+	FUDBIndexLookup IndexLookup;
+	bool bIndexUsed = false;
+	bool bPagedByName = false;
+	int32 TotalCount = 0;
+
+	// row_names already returns every match, so only pattern, where and order_by queries take a snapshot
+	const bool bSnapshot = bUseCursor && !bFromCursor && RowNamesList.Num() == 0;
+	FUDBQueryCursors::FPage CursorPage;
+
+	if (bFromCursor)
+	{
+		// The snapshot fixes rows and order; this request's where, order_by and patterns are not applied again
+		const FUDBQueryCursors::EReadResult ReadResult = FUDBQueryCursors::ReadPage(DataTable, Cursor, Limit, CursorPage);
+		if (ReadResult == FUDBQueryCursors::EReadResult::Expired)
+		{
+			return FUDBCommandHandler::Error(
+				UDBErrorCodes::CursorExpired,
+				TEXT("Cursor expired: its snapshot was dropped. Query again without cursor to start over")
+			);
+		}
+		if (ReadResult != FUDBQueryCursors::EReadResult::Ok)
+		{
+			return FUDBCommandHandler::Error(
+				UDBErrorCodes::InvalidValue,
+				FString::Printf(TEXT("Invalid cursor for %s: %s"), *TablePath, *Cursor)
+			);
+		}
 
-	if (RowNamesList.Num() > 0)
+		FilteredRowNames.Append(CursorPage.RowNames);
+		TotalCount = CursorPage.TotalCount;
+		Offset = CursorPage.Position;
+		if (CursorPage.bConsistencyBreak)
+		{
+			Warnings.Add(TEXT("The table changed after this cursor's first page: rows keep the snapshot's order, show current values, and deleted rows are skipped"));
+		}
+	}
+	else if (RowNamesList.Num() > 0)
 	{
 		// Exact match: preserve requested order, track missing
 		for (const FString& RequestedName : RowNamesList)
 		{
 			FName RowFName(*RequestedName);
-			if (DataTable->FindRowUnchecked(RowFName) != nullptr)
+			if (const uint8* RowData = DataTable->FindRowUnchecked(RowFName))
 			{
-				FilteredRowNames.Add(RowFName);
+				// Rows rejected by where are found, just not returned
+				if (!WhereFilter.IsValid() || WhereFilter->Matches(RowData))
+				{
+					FilteredRowNames.Add(RowFName);
+				}
 			}
 			else
 			{
@@ -327,54 +575,147 @@ FUDBCommandResult FUDBDataTableOps::QueryDatatable(const TSharedPtr<FJsonObject>
 			}
 		}
 	}
+	else if (!WhereFilter.IsValid() && !Order.IsValid() && !FUDBRowNameIndex::FPattern(RowNamePattern).MatchesAll() && FUDBRowNameIndex::IsEnabled(DataTable))
+	{
+		// Names alone decide on a large table: the cached name index matches the pattern once and pages are slices
+		// of its matches. A snapshot takes every match
+		TArray<FName> PageNames;
+		TotalCount = FUDBRowNameIndex::SelectPage(
+			DataTable, RowNamePattern, bSnapshot ? 0 : Offset, bSnapshot ? DataTable->GetRowMap().Num() : Limit, PageNames);
+		FilteredRowNames.Append(PageNames);
+		bPagedByName = !bSnapshot;
+	}
 	else
 	{
-		// Wildcard pattern filtering
-		TArray<FName> RowNames = DataTable->GetRowNames();
-		for (const FName& Name : RowNames)
+		FilteredRowNames.Reserve(DataTable->GetRowMap().Num());
+		bIndexUsed = ForEachMatchingRow(DataTable, WhereFilter.Get(), RowNamePattern, IndexLookup, [&FilteredRowNames](FName Name, const uint8*)
 		{
-			if (!RowNamePattern.IsEmpty())
-			{
-				if (!Name.ToString().MatchesWildcard(RowNamePattern))
-				{
-					continue;
-				}
-			}
 			FilteredRowNames.Add(Name);
-		}
+		});
 	}
 
-	const int32 TotalCount = FilteredRowNames.Num();
-
-	// Apply pagination (skip for row_names mode — return all matched)
-	const int32 StartIndex = (RowNamesList.Num() > 0) ? 0 : FMath::Min(Offset, TotalCount);
-	const int32 EndIndex = (RowNamesList.Num() > 0) ? TotalCount : FMath::Min(StartIndex + Limit, TotalCount);
+	if (!bPagedByName && !bFromCursor)
+	{
+		TotalCount = FilteredRowNames.Num();
+	}
 
-	TArray<TSharedPtr<FJsonValue>> RowsArray;
-	for (int32 Index = StartIndex; Index < EndIndex; ++Index)
+	// A snapshot keeps the whole order, so this page and the following ones are plain slices of it
+	if (Order.IsValid() && bSnapshot)
 	{
-		const FName& RowName = FilteredRowNames[Index];
-		const void* RowData = DataTable->FindRowUnchecked(RowName);
-		if (RowData == nullptr)
+		TArray<const void*, TMemStackAllocator<>> FilteredRowDatas;
+		FilteredRowDatas.Reserve(TotalCount);
+		for (const FName& RowName : FilteredRowNames)
 		{
-			continue;
+			FilteredRowDatas.Add(DataTable->FindRowUnchecked(RowName));
+		}
+
+		TArray<int32> OrderedIndices;
+		Order->Select(FilteredRowDatas, 0, TotalCount, OrderedIndices);
+		TArray<FName, TMemStackAllocator<>> OrderedRowNames;
+		OrderedRowNames.Reserve(OrderedIndices.Num());
+		for (int32 Index : OrderedIndices)
+		{
+			OrderedRowNames.Add(FilteredRowNames[Index]);
 		}
+		FilteredRowNames = MoveTemp(OrderedRowNames);
+	}
 
-		TSharedPtr<FJsonObject> RowJson = FUDBSerializer::StructToJson(RowStruct, RowData, FieldsProjection);
+	// Apply pagination (skip for row_names mode — return all matched — and for pages the name index or a cursor already cut)
+	const bool bWholeList = RowNamesList.Num() > 0 || bPagedByName || bFromCursor;
+	const int32 StartIndex = bWholeList ? 0 : FMath::Min(Offset, TotalCount);
+	const int32 EndIndex = bWholeList ? FilteredRowNames.Num() : FMath::Min(StartIndex + Limit, TotalCount);
 
-		TSharedRef<FJsonObject> EntryJson = MakeShared<FJsonObject>();
-		EntryJson->SetStringField(TEXT("row_name"), RowName.ToString());
-		EntryJson->SetObjectField(TEXT("row_data"), RowJson);
+	TArray<TPair<FName, const uint8*>, TMemStackAllocator<>> PageRows;
+	PageRows.Reserve(EndIndex - StartIndex);
+	if (Order.IsValid() && !bSnapshot && !bFromCursor)
+	{
+		// Top-k over extracted sort keys: only the page's rows are ever ordered in full or serialized
+		TArray<const void*, TMemStackAllocator<>> FilteredRowDatas;
+		FilteredRowDatas.Reserve(TotalCount);
+		for (const FName& RowName : FilteredRowNames)
+		{
+			FilteredRowDatas.Add(DataTable->FindRowUnchecked(RowName));
+		}
+
+		TArray<int32> PageIndices;
+		Order->Select(FilteredRowDatas, StartIndex, EndIndex - StartIndex, PageIndices);
+		for (int32 Index : PageIndices)
+		{
+			PageRows.Emplace(FilteredRowNames[Index], static_cast<const uint8*>(FilteredRowDatas[Index]));
+		}
+	}
+	else
+	{
+		for (int32 Index = StartIndex; Index < EndIndex; ++Index)
+		{
+			const FName& RowName = FilteredRowNames[Index];
+			const uint8* RowData = DataTable->FindRowUnchecked(RowName);
+			if (RowData == nullptr)
+			{
+				continue;
+			}
+			PageRows.Emplace(RowName, RowData);
+		}
+	}
 
-		RowsArray.Add(MakeShared<FJsonValueObject>(EntryJson));
+	FString NextCursor = CursorPage.NextCursor;
+	if (bSnapshot)
+	{
+		NextCursor = FUDBQueryCursors::Save(DataTable, TArray<FName>(FilteredRowNames), EndIndex);
 	}
 
 	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
 	Data->SetStringField(TEXT("table_path"), TablePath);
-	Data->SetArrayField(TEXT("rows"), RowsArray);
+
+	FUDBJsonFragmentMap RowFragments;
+	if (bColumnar)
+	{
+		// Column-wise: field names appear once, repeated strings/enums are dictionary-encoded
+		TArray<const void*, TMemStackAllocator<>> RowDatas;
+		TArray<TSharedPtr<FJsonValue>> RowNamesArray;
+		RowDatas.Reserve(PageRows.Num());
+		RowNamesArray.Reserve(PageRows.Num());
+		for (const TPair<FName, const uint8*>& Row : PageRows)
+		{
+			RowDatas.Add(Row.Value);
+			RowNamesArray.Add(MakeShared<FJsonValueString>(Row.Key.ToString()));
+		}
+
+		Data->SetStringField(TEXT("format"), TEXT("columnar"));
+		Data->SetArrayField(TEXT("row_names"), RowNamesArray);
+		Data->SetObjectField(TEXT("columns"), FUDBSerializer::StructsToColumns(
+			RowStruct, RowDatas, FieldsProjection, SerializeOptions.ForNestedValue(), GetSerializeChunkCount(RowDatas.Num())));
+	}
+	else
+	{
+		TArray<TSharedPtr<FJsonValue>> RowsArray;
+		for (const TSharedPtr<FJsonObject>& EntryJson : SerializeRowEntries(DataTable, RowStruct, PageRows, FieldsProjection, SerializeOptions, RowFragments))
+		{
+			RowsArray.Add(MakeShared<FJsonValueObject>(EntryJson));
+		}
+		Data->SetArrayField(TEXT("rows"), RowsArray);
+	}
+
 	Data->SetNumberField(TEXT("total_count"), TotalCount);
 	Data->SetNumberField(TEXT("offset"), Offset);
 	Data->SetNumberField(TEXT("limit"), Limit);
+	Data->SetStringField(TEXT("etag"), ETag);
+
+	if (bSnapshot || bFromCursor)
+	{
+		if (!NextCursor.IsEmpty())
+		{
+			Data->SetStringField(TEXT("next_cursor"), NextCursor);
+		}
+		const uint64 SnapshotGeneration = bFromCursor ? CursorPage.SnapshotGeneration : FUDBTableVersions::GetGeneration(DataTable);
+		Data->SetNumberField(TEXT("snapshot_generation"), static_cast<double>(SnapshotGeneration));
+		Data->SetBoolField(TEXT("consistency_break"), CursorPage.bConsistencyBreak);
+	}
+
+	if (bIndexUsed)
+	{
+		Data->SetObjectField(TEXT("index_used"), MakeIndexUsedJson(IndexLookup));
+	}
 
 	if (MissingNames.Num() > 0)
 	{
@@ -386,7 +727,10 @@ FUDBCommandResult FUDBDataTableOps::QueryDatatable(const TSharedPtr<FJsonObject>
 		Data->SetArrayField(TEXT("missing_rows"), MissingArray);
 	}
 
-	return FUDBCommandHandler::Success(Data);
+	FUDBCommandResult Result = FUDBCommandHandler::Success(Data);
+	Result.PreserializedObjects = MoveTemp(RowFragments);
+	Result.Warnings = MoveTemp(Warnings);
+	return Result;
 }
 
 FUDBCommandResult FUDBDataTableOps::GetDatatableRow(const TSharedPtr<FJsonObject>& Params)
@@ -413,7 +757,8 @@ FUDBCommandResult FUDBDataTableOps::GetDatatableRow(const TSharedPtr<FJsonObject
 		return LoadError;
 	}
 
-	const void* RowData = DataTable->FindRowUnchecked(FName(*RowName));
+	const FName RowFName(*RowName);
+	const void* RowData = DataTable->FindRowUnchecked(RowFName);
 	if (RowData == nullptr)
 	{
 		return FUDBCommandHandler::Error(
@@ -422,13 +767,36 @@ FUDBCommandResult FUDBDataTableOps::GetDatatableRow(const TSharedPtr<FJsonObject
 		);
 	}
 
+	const FUDBSerializeOptions SerializeOptions = FUDBSerializeOptions::FromParams(Params, DataTable->GetRowStruct());
+	const TPair<FName, const uint8*> Row(RowFName, static_cast<const uint8*>(RowData));
+
+	FUDBJsonFragmentMap RowFragments;
+	const TArray<TSharedPtr<FJsonObject>> Entries = SerializeRowEntries(
+		DataTable, DataTable->GetRowStruct(), MakeArrayView(&Row, 1), FUDBFieldProjection(), SerializeOptions, RowFragments);
+
+	// The row ETag hashes its serialized bytes, so edits to other rows leave it unchanged
+	const TSharedPtr<FJsonObject> RowJson = Entries[0]->GetObjectField(TEXT("row_data"));
+	const FUDBJsonFragment* RowUtf8 = RowFragments.Find(RowJson.Get());
+	if (RowUtf8 == nullptr)
+	{
+		RowUtf8 = &RowFragments.Add(RowJson.Get(), FUDBJsonFragment(MakeShared<FUDBJsonBytes>(FUDBJsonWriter::ToBytes(RowJson))));
+	}
+	const FString ETag = FUDBTableVersions::MakeContentETag(RowUtf8->GetData(), RowUtf8->Num);
+	if (FUDBCommandHandler::MatchesIfNoneMatch(Params, ETag))
+	{
+		return FUDBCommandHandler::NotModified(ETag);
+	}
+
 	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
 	Data->SetStringField(TEXT("table_path"), TablePath);
 	Data->SetStringField(TEXT("row_name"), RowName);
 	Data->SetStringField(TEXT("row_struct"), DataTable->GetRowStruct()->GetName());
-	Data->SetObjectField(TEXT("row_data"), FUDBSerializer::StructToJson(DataTable->GetRowStruct(), RowData));
+	Data->SetObjectField(TEXT("row_data"), RowJson);
+	Data->SetStringField(TEXT("etag"), ETag);
 
-	return FUDBCommandHandler::Success(Data);
+	FUDBCommandResult Result = FUDBCommandHandler::Success(Data);
+	Result.PreserializedObjects = MoveTemp(RowFragments);
+	return Result;
 }
 
 FUDBCommandResult FUDBDataTableOps::AddDatatableRow(const TSharedPtr<FJsonObject>& Params)
@@ -515,8 +883,10 @@ FUDBCommandResult FUDBDataTableOps::AddDatatableRow(const TSharedPtr<FJsonObject
 		FString::Printf(TEXT("UDB: Add Row '%s' to '%s'"), *RowName, *DataTable->GetName())
 	));
 	DataTable->Modify();
+	FUDBTableIndexes::FScopedRowChanges IndexChanges(DataTable);
 
 	DataTable->AddRow(RowFName, RowMemory, RowStruct);
+	IndexChanges.RowChanged(RowFName);
 
 	RowStruct->DestroyStruct(RowMemory);
 	FMemory::Free(RowMemory);
@@ -588,7 +958,7 @@ FUDBCommandResult FUDBDataTableOps::UpdateDatatableRow(const TSharedPtr<FJsonObj
 	const UCompositeDataTable* CompositeTable = Cast<UCompositeDataTable>(DataTable);
 	if (CompositeTable != nullptr)
 	{
-		UDataTable* SourceTable = FindSourceTableForRow(CompositeTable, RowFName);
+		UDataTable* SourceTable = FUDBCompositeLayout::FindSourceTable(CompositeTable, RowFName);
 		if (SourceTable == nullptr)
 		{
 			return FUDBCommandHandler::Error(
@@ -708,6 +1078,7 @@ FUDBCommandResult FUDBDataTableOps::UpdateDatatableRow(const TSharedPtr<FJsonObj
 		FString::Printf(TEXT("UDB: Update Row '%s' in '%s'"), *RowName, *DataTable->GetName())
 	));
 	DataTable->Modify();
+	FUDBTableIndexes::FScopedRowChanges IndexChanges(DataTable);
 
 	bool bDeserializeSuccess = FUDBSerializer::JsonToStruct(*RowData, RowStruct, RowPtr, Warnings);
 
@@ -719,6 +1090,7 @@ FUDBCommandResult FUDBDataTableOps::UpdateDatatableRow(const TSharedPtr<FJsonObj
 		);
 	}
 
+	IndexChanges.RowChanged(RowFName);
 	DataTable->HandleDataTableChanged(RowFName);
 	DataTable->MarkPackageDirty();
 	FUDBEditorUtils::NotifyAssetModified(DataTable);
@@ -785,7 +1157,7 @@ FUDBCommandResult FUDBDataTableOps::DeleteDatatableRow(const TSharedPtr<FJsonObj
 	const UCompositeDataTable* CompositeTable = Cast<UCompositeDataTable>(DataTable);
 	if (CompositeTable != nullptr)
 	{
-		UDataTable* SourceTable = FindSourceTableForRow(CompositeTable, RowFName);
+		UDataTable* SourceTable = FUDBCompositeLayout::FindSourceTable(CompositeTable, RowFName);
 		if (SourceTable == nullptr)
 		{
 			return FUDBCommandHandler::Error(
@@ -811,8 +1183,10 @@ FUDBCommandResult FUDBDataTableOps::DeleteDatatableRow(const TSharedPtr<FJsonObj
 		FString::Printf(TEXT("UDB: Delete Row '%s' from '%s'"), *RowName, *DataTable->GetName())
 	));
 	DataTable->Modify();
+	FUDBTableIndexes::FScopedRowChanges IndexChanges(DataTable);
 
 	DataTable->RemoveRow(RowFName);
+	IndexChanges.RowRemoved(RowFName);
 	DataTable->MarkPackageDirty();
 	FUDBEditorUtils::NotifyAssetModified(DataTable);
 
@@ -828,6 +1202,81 @@ FUDBCommandResult FUDBDataTableOps::DeleteDatatableRow(const TSharedPtr<FJsonObj
 	return FUDBCommandHandler::Success(Data);
 }
 
+/** What an import does with one entry of its rows array */
+enum class EUDBImportAction : uint8
+{
+	Invalid,
+	Skip,
+	Create,
+	Update,
+};
+
+/** One entry of an import_datatable_json request on its way through the import stages */
+struct FUDBImportRow
+{
+	FString RowName;
+	FName RowFName;
+	const TSharedPtr<FJsonObject>* RowData = nullptr;
+	EUDBImportAction Action = EUDBImportAction::Invalid;
+	bool bDeserialized = false;
+	FString Error;
+	TArray<FString> Warnings;
+};
+
+/**
+ * Row buffers of one struct carved from a single aligned allocation that is reused from pass to
+ * pass, so an import allocates once rather than once per row. Every buffer handed out must be
+ * initialized by the caller; Reset and the destructor destroy them.
+ */
+class FUDBRowBufferPool
+{
+public:
+	explicit FUDBRowBufferPool(const UScriptStruct* InRowStruct)
+		: RowStruct(InRowStruct)
+		, Alignment(FMath::Max(InRowStruct->GetMinAlignment(), 16))
+		, Stride(Align(InRowStruct->GetStructureSize(), Alignment))
+	{
+	}
+
+	~FUDBRowBufferPool()
+	{
+		Reset(0);
+		FMemory::Free(Memory);
+	}
+
+	UE_NONCOPYABLE(FUDBRowBufferPool);
+
+	/** Destroy the rows of the previous pass and make room for NumRows uninitialized ones */
+	void Reset(int32 InNumRows)
+	{
+		for (int32 Index = 0; Index < NumRows; ++Index)
+		{
+			RowStruct->DestroyStruct(GetRow(Index));
+		}
+
+		if (InNumRows > Capacity)
+		{
+			FMemory::Free(Memory);
+			Memory = static_cast<uint8*>(FMemory::Malloc(static_cast<SIZE_T>(InNumRows) * Stride, Alignment));
+			Capacity = InNumRows;
+		}
+		NumRows = InNumRows;
+	}
+
+	uint8* GetRow(int32 Index) const
+	{
+		return Memory + static_cast<SIZE_T>(Index) * Stride;
+	}
+
+private:
+	const UScriptStruct* RowStruct;
+	uint32 Alignment;
+	SIZE_T Stride;
+	uint8* Memory = nullptr;
+	int32 Capacity = 0;
+	int32 NumRows = 0;
+};
+
 FUDBCommandResult FUDBDataTableOps::ImportDatatableJson(const TSharedPtr<FJsonObject>& Params)
 {
 	FString TablePath;
@@ -891,6 +1340,10 @@ FUDBCommandResult FUDBDataTableOps::ImportDatatableJson(const TSharedPtr<FJsonOb
 		);
 	}
 
+	const double StartTime = FPlatformTime::Seconds();
+	const bool bCreateMode = Mode == TEXT("create");
+	const bool bUpsertMode = Mode == TEXT("upsert");
+
 	// Wrap entire import in a single undo transaction (skip for dry_run)
 	TOptional<FScopedTransaction> Transaction;
 	if (!bDryRun)
@@ -900,143 +1353,200 @@ FUDBCommandResult FUDBDataTableOps::ImportDatatableJson(const TSharedPtr<FJsonOb
 		));
 		DataTable->Modify();
 	}
+	FUDBTableIndexes::FScopedRowChanges IndexChanges(DataTable);
 
 	if (Mode == TEXT("replace") && !bDryRun)
 	{
 		DataTable->EmptyTable();
+		IndexChanges.Invalidate();
 	}
 
-	int32 CreatedCount = 0;
-	int32 UpdatedCount = 0;
-	int32 SkippedCount = 0;
-	TArray<FString> Errors;
-	TArray<FString> Warnings;
-
+	// Prepare: read every entry once
+	TArray<FUDBImportRow> ImportRows;
+	ImportRows.SetNum(RowsArray->Num());
+	TArray<int32> PassEntries;
+	PassEntries.Reserve(RowsArray->Num());
 	for (int32 Index = 0; Index < RowsArray->Num(); ++Index)
 	{
+		FUDBImportRow& Row = ImportRows[Index];
 		const TSharedPtr<FJsonValue>& RowEntry = (*RowsArray)[Index];
 		if (!RowEntry.IsValid() || RowEntry->Type != EJson::Object)
 		{
-			Errors.Add(FString::Printf(TEXT("Row %d: invalid entry (not an object)"), Index));
+			Row.Error = FString::Printf(TEXT("Row %d: invalid entry (not an object)"), Index);
 			continue;
 		}
 
 		const TSharedPtr<FJsonObject>& RowEntryObj = RowEntry->AsObject();
-		FString EntryRowName;
-		if (!RowEntryObj->TryGetStringField(TEXT("row_name"), EntryRowName))
+		if (!RowEntryObj->TryGetStringField(TEXT("row_name"), Row.RowName))
 		{
-			Errors.Add(FString::Printf(TEXT("Row %d: missing row_name"), Index));
+			Row.Error = FString::Printf(TEXT("Row %d: missing row_name"), Index);
 			continue;
 		}
 
-		const TSharedPtr<FJsonObject>* EntryRowData = nullptr;
-		if (!RowEntryObj->TryGetObjectField(TEXT("row_data"), EntryRowData) || EntryRowData == nullptr || !(*EntryRowData).IsValid())
+		if (!RowEntryObj->TryGetObjectField(TEXT("row_data"), Row.RowData) || Row.RowData == nullptr || !(*Row.RowData).IsValid())
 		{
-			Errors.Add(FString::Printf(TEXT("Row %d (%s): missing row_data"), Index, *EntryRowName));
+			Row.Error = FString::Printf(TEXT("Row %d (%s): missing row_data"), Index, *Row.RowName);
 			continue;
 		}
 
-		const FName EntryRowFName(*EntryRowName);
-		uint8* ExistingRow = DataTable->FindRowUnchecked(EntryRowFName);
-		bool bRowExists = (ExistingRow != nullptr);
-
-		if (bDryRun)
+		Row.RowFName = FName(*Row.RowName);
+		PassEntries.Add(Index);
+	}
+	double PrepareMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	double DeserializeMs = 0.0;
+	double ValidateMs = 0.0;
+	double CommitMs = 0.0;
+
+	// Rows go through in passes that hold each row name at most once; a repeated name waits for the next
+	// pass, so it lands on top of the earlier entry as if the rows were imported one by one
+	const bool bConcurrent = FUDBSerializer::CanDeserializeConcurrently(RowStruct);
+	FUDBRowBufferPool Buffers(RowStruct);
+	TArray<int32> PassRows;
+	TArray<uint8*> PassTargets;
+	TArray<int32> DeferredEntries;
+	TSet<FName> PassNames;
+	int32 NumChunks = 1;
+	while (PassEntries.Num() > 0)
+	{
+		double StageStart = FPlatformTime::Seconds();
+		PassRows.Reset();
+		PassTargets.Reset();
+		DeferredEntries.Reset();
+		PassNames.Reset();
+		for (const int32 Index : PassEntries)
 		{
-			// Validate by attempting deserialization into temp memory
-			uint8* TempMemory = static_cast<uint8*>(FMemory::Malloc(RowStruct->GetStructureSize()));
-			RowStruct->InitializeStruct(TempMemory);
+			FUDBImportRow& Row = ImportRows[Index];
+			uint8* ExistingRow = DataTable->FindRowUnchecked(Row.RowFName);
 
-			TArray<FString> RowWarnings;
-			bool bSuccess = FUDBSerializer::JsonToStruct(*EntryRowData, RowStruct, TempMemory, RowWarnings);
+			// A dry run checks every entry against the table as it is, into fresh rows
+			if (bDryRun)
+			{
+				Row.Action = ExistingRow == nullptr ? EUDBImportAction::Create : bCreateMode ? EUDBImportAction::Skip : EUDBImportAction::Update;
+				PassRows.Add(Index);
+				PassTargets.Add(nullptr);
+				continue;
+			}
 
-			RowStruct->DestroyStruct(TempMemory);
-			FMemory::Free(TempMemory);
+			bool bRepeated = false;
+			PassNames.Add(Row.RowFName, &bRepeated);
+			if (bRepeated)
+			{
+				DeferredEntries.Add(Index);
+				continue;
+			}
 
-			if (!bSuccess)
+			if (ExistingRow != nullptr && bCreateMode)
 			{
-				Errors.Add(FString::Printf(TEXT("Row %d (%s): deserialization failed"), Index, *EntryRowName));
+				Row.Action = EUDBImportAction::Skip;
+				continue;
 			}
-			else
+
+			// Replace mode overwrites a row an earlier pass added rather than merging into it
+			Row.Action = (ExistingRow != nullptr && bUpsertMode) ? EUDBImportAction::Update : EUDBImportAction::Create;
+			PassRows.Add(Index);
+			PassTargets.Add(Row.Action == EUDBImportAction::Update ? ExistingRow : nullptr);
+		}
+		PrepareMs += (FPlatformTime::Seconds() - StageStart) * 1000.0;
+
+		// Deserialize: each row into its pooled buffer, in parallel chunks; upserts start from a copy of their row
+		StageStart = FPlatformTime::Seconds();
+		Buffers.Reset(PassRows.Num());
+		const int32 PassChunks = bConcurrent ? GetSerializeChunkCount(PassRows.Num()) : 1;
+		const int32 RowsPerChunk = FMath::DivideAndRoundUp(PassRows.Num(), PassChunks);
+		NumChunks = FMath::Max(NumChunks, PassChunks);
+		ParallelFor(PassChunks, [&](int32 ChunkIndex)
+		{
+			const int32 Begin = ChunkIndex * RowsPerChunk;
+			const int32 End = FMath::Min(Begin + RowsPerChunk, PassRows.Num());
+			for (int32 PassIndex = Begin; PassIndex < End; ++PassIndex)
 			{
-				for (const FString& W : RowWarnings)
+				FUDBImportRow& Row = ImportRows[PassRows[PassIndex]];
+				uint8* Buffer = Buffers.GetRow(PassIndex);
+				RowStruct->InitializeStruct(Buffer);
+				if (PassTargets[PassIndex] != nullptr)
 				{
-					Warnings.Add(FString::Printf(TEXT("Row %d (%s): %s"), Index, *EntryRowName, *W));
+					RowStruct->CopyScriptStruct(Buffer, PassTargets[PassIndex]);
 				}
+				Row.bDeserialized = FUDBSerializer::JsonToStruct(*Row.RowData, RowStruct, Buffer, Row.Warnings);
+			}
+		}, PassChunks > 1 ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread);
+		DeserializeMs += (FPlatformTime::Seconds() - StageStart) * 1000.0;
 
-				if (bRowExists && Mode == TEXT("create"))
-				{
-					++SkippedCount;
+		// Validate: rows that failed drop out before anything touches the table
+		StageStart = FPlatformTime::Seconds();
+		for (const int32 Index : PassRows)
+		{
+			FUDBImportRow& Row = ImportRows[Index];
+			if (!Row.bDeserialized)
+			{
+				Row.Action = EUDBImportAction::Invalid;
+				Row.Error = FString::Printf(TEXT("Row %d (%s): deserialization failed"), Index, *Row.RowName);
+			}
+		}
+		ValidateMs += (FPlatformTime::Seconds() - StageStart) * 1000.0;
+
+		// Commit: one game-thread pass over the table
+		if (!bDryRun)
+		{
+			StageStart = FPlatformTime::Seconds();
+			for (int32 PassIndex = 0; PassIndex < PassRows.Num(); ++PassIndex)
+			{
+				const FUDBImportRow& Row = ImportRows[PassRows[PassIndex]];
+				if (Row.Action == EUDBImportAction::Update)
+				{
+					RowStruct->CopyScriptStruct(PassTargets[PassIndex], Buffers.GetRow(PassIndex));
 				}
-				else if (bRowExists)
+				else if (Row.Action == EUDBImportAction::Create)
 				{
-					++UpdatedCount;
+					DataTable->AddRow(Row.RowFName, Buffers.GetRow(PassIndex), RowStruct);
 				}
 				else
 				{
-					++CreatedCount;
+					continue;
 				}
+				IndexChanges.RowChanged(Row.RowFName);
 			}
-			continue;
+			CommitMs += (FPlatformTime::Seconds() - StageStart) * 1000.0;
 		}
 
-		// Non-dry-run execution
-		if (bRowExists && Mode == TEXT("create"))
+		Swap(PassEntries, DeferredEntries);
+	}
+
+	// Results in request order
+	int32 CreatedCount = 0;
+	int32 UpdatedCount = 0;
+	int32 SkippedCount = 0;
+	TArray<FString> Errors;
+	TArray<FString> Warnings;
+	for (int32 Index = 0; Index < ImportRows.Num(); ++Index)
+	{
+		const FUDBImportRow& Row = ImportRows[Index];
+		if (!Row.Error.IsEmpty())
 		{
-			++SkippedCount;
+			Errors.Add(Row.Error);
 			continue;
 		}
 
-		if (bRowExists && Mode == TEXT("upsert"))
+		for (const FString& W : Row.Warnings)
 		{
-			// Update existing row in place
-			TArray<FString> RowWarnings;
-			bool bSuccess = FUDBSerializer::JsonToStruct(*EntryRowData, RowStruct, ExistingRow, RowWarnings);
-			if (!bSuccess)
-			{
-				Errors.Add(FString::Printf(TEXT("Row %d (%s): deserialization failed"), Index, *EntryRowName));
-				continue;
-			}
-			for (const FString& W : RowWarnings)
-			{
-				Warnings.Add(FString::Printf(TEXT("Row %d (%s): %s"), Index, *EntryRowName, *W));
-			}
-			DataTable->HandleDataTableChanged(EntryRowFName);
-			++UpdatedCount;
-		}
-		else
-		{
-			// Create new row
-			uint8* RowMemory = static_cast<uint8*>(FMemory::Malloc(RowStruct->GetStructureSize()));
-			RowStruct->InitializeStruct(RowMemory);
-
-			TArray<FString> RowWarnings;
-			bool bSuccess = FUDBSerializer::JsonToStruct(*EntryRowData, RowStruct, RowMemory, RowWarnings);
-
-			if (!bSuccess)
-			{
-				RowStruct->DestroyStruct(RowMemory);
-				FMemory::Free(RowMemory);
-				Errors.Add(FString::Printf(TEXT("Row %d (%s): deserialization failed"), Index, *EntryRowName));
-				continue;
-			}
-
-			for (const FString& W : RowWarnings)
-			{
-				Warnings.Add(FString::Printf(TEXT("Row %d (%s): %s"), Index, *EntryRowName, *W));
-			}
-
-			DataTable->AddRow(EntryRowFName, RowMemory, RowStruct);
-
-			RowStruct->DestroyStruct(RowMemory);
-			FMemory::Free(RowMemory);
-			++CreatedCount;
+			Warnings.Add(FString::Printf(TEXT("Row %d (%s): %s"), Index, *Row.RowName, *W));
 		}
+		CreatedCount += Row.Action == EUDBImportAction::Create ? 1 : 0;
+		UpdatedCount += Row.Action == EUDBImportAction::Update ? 1 : 0;
+		SkippedCount += Row.Action == EUDBImportAction::Skip ? 1 : 0;
 	}
 
 	if (!bDryRun)
 	{
+		// A single change broadcast for the whole import rather than one per updated row
+		const double StageStart = FPlatformTime::Seconds();
+		if (CreatedCount + UpdatedCount > 0)
+		{
+			DataTable->HandleDataTableChanged();
+		}
 		DataTable->MarkPackageDirty();
-	FUDBEditorUtils::NotifyAssetModified(DataTable);
+		FUDBEditorUtils::NotifyAssetModified(DataTable);
+		CommitMs += (FPlatformTime::Seconds() - StageStart) * 1000.0;
 	}
 
 	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
@@ -1044,6 +1554,15 @@ FUDBCommandResult FUDBDataTableOps::ImportDatatableJson(const TSharedPtr<FJsonOb
 	Data->SetNumberField(TEXT("updated"), UpdatedCount);
 	Data->SetNumberField(TEXT("skipped"), SkippedCount);
 
+	TSharedPtr<FJsonObject> StageMs = MakeShared<FJsonObject>();
+	StageMs->SetNumberField(TEXT("prepare"), PrepareMs);
+	StageMs->SetNumberField(TEXT("deserialize"), DeserializeMs);
+	StageMs->SetNumberField(TEXT("validate"), ValidateMs);
+	StageMs->SetNumberField(TEXT("commit"), CommitMs);
+	Data->SetObjectField(TEXT("stage_ms"), StageMs);
+	Data->SetNumberField(TEXT("deserialize_chunks"), NumChunks);
+	Data->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
 	if (Errors.Num() > 0)
 	{
 		TArray<TSharedPtr<FJsonValue>> ErrorsArray;
@@ -1125,8 +1644,14 @@ FUDBCommandResult FUDBDataTableOps::GetStructSchema(const TSharedPtr<FJsonObject
 		Params->TryGetBoolField(TEXT("include_subtypes"), bIncludeSubtypes);
 	}
 
+	const FUDBCachedSchema Schema = FUDBSchemaCache::Get(FoundStruct);
+
 	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
-	Data->SetObjectField(TEXT("schema"), FUDBSerializer::GetStructSchema(FoundStruct));
+	Data->SetObjectField(TEXT("schema"), Schema.Schema);
+	Data->SetStringField(TEXT("schema_hash"), Schema.Hash);
+
+	FUDBCommandResult Result = FUDBCommandHandler::Success(Data);
+	Result.PreserializedObjects.Add(Schema.Schema.Get(), Schema.Utf8);
 
 	if (bIncludeSubtypes)
 	{
@@ -1134,120 +1659,186 @@ FUDBCommandResult FUDBDataTableOps::GetStructSchema(const TSharedPtr<FJsonObject
 		TArray<TSharedPtr<FJsonValue>> SubtypeSchemas;
 		for (const UScriptStruct* Subtype : Subtypes)
 		{
-			SubtypeSchemas.Add(MakeShared<FJsonValueObject>(FUDBSerializer::GetStructSchema(Subtype)));
+			const FUDBCachedSchema SubtypeSchema = FUDBSchemaCache::Get(Subtype);
+			SubtypeSchemas.Add(MakeShared<FJsonValueObject>(SubtypeSchema.Schema));
+			Result.PreserializedObjects.Add(SubtypeSchema.Schema.Get(), SubtypeSchema.Utf8);
 		}
 		Data->SetArrayField(TEXT("subtypes"), SubtypeSchemas);
 	}
 
-	return FUDBCommandHandler::Success(Data);
+	return Result;
 }
 
-/** Recursively search struct fields for a substring match. Appends matching {field, value} pairs. */
-static void SearchRowFields(
-	const UStruct* StructType,
-	const void* StructData,
-	const FString& SearchText,
-	const TSet<FString>& FieldFilter,
-	const FString& FieldPrefix,
-	TArray<TSharedPtr<FJsonValue>>& OutMatches)
+/** Append a {field, value} match; the dotted field path is only built for hits */
+static void AddSearchMatch(const FString& FieldPrefix, const FString& FieldName, const FString& Value, TArray<TSharedPtr<FJsonValue>>& OutMatches)
 {
-	for (TFieldIterator<FProperty> It(StructType); It; ++It)
+	TSharedRef<FJsonObject> Match = MakeShared<FJsonObject>();
+	Match->SetStringField(TEXT("field"), FieldPrefix.IsEmpty() ? FieldName : FieldPrefix + TEXT(".") + FieldName);
+	Match->SetStringField(TEXT("value"), Value);
+	OutMatches.Add(MakeShared<FJsonValueObject>(Match));
+}
+
+/**
+ * Case-insensitive substring search with the search text folded once. Each field is folded into a
+ * stack buffer and scanned for the first character, so the inner loop is a plain compare the
+ * compiler can vectorize. Safe to share across worker threads.
+ */
+struct FUDBFoldedSearch
+{
+	explicit FUDBFoldedSearch(const FString& SearchText)
 	{
-		const FProperty* Property = *It;
-		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(StructData);
-		const FString FieldPath = FieldPrefix.IsEmpty()
-			? Property->GetName()
-			: FieldPrefix + TEXT(".") + Property->GetName();
+		Needle.Reserve(SearchText.Len());
+		for (const TCHAR Char : SearchText)
+		{
+			Needle.Add(FChar::ToLower(Char));
+		}
+	}
 
-		// If field filter is set, skip fields that don't match
-		if (FieldFilter.Num() > 0 && !FieldFilter.Contains(FieldPath) && !FieldFilter.Contains(Property->GetName()))
+	bool Matches(const FString& Text) const
+	{
+		const int32 NeedleLen = Needle.Num();
+		const int32 TextLen = Text.Len();
+		if (NeedleLen == 0 || TextLen < NeedleLen)
 		{
-			// Still recurse into structs if any filter path starts with this prefix
-			if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
-			{
-				bool bHasChildMatch = false;
-				const FString Prefix = FieldPath + TEXT(".");
-				for (const FString& Filter : FieldFilter)
-				{
-					if (Filter.StartsWith(Prefix))
-					{
-						bHasChildMatch = true;
-						break;
-					}
-				}
-				if (bHasChildMatch)
-				{
-					const UScriptStruct* InnerStruct = StructProp->Struct;
-					if (InnerStruct != FGameplayTag::StaticStruct()
-						&& InnerStruct != TBaseStructure<FSoftObjectPath>::Get()
-						&& InnerStruct != FInstancedStruct::StaticStruct())
-					{
-						SearchRowFields(InnerStruct, ValuePtr, SearchText, FieldFilter, FieldPath, OutMatches);
-					}
-				}
-			}
-			continue;
+			return false;
 		}
 
-		// Check FText
-		if (const FTextProperty* TextProp = CastField<FTextProperty>(Property))
+		TArray<TCHAR, TInlineAllocator<256>> Folded;
+		Folded.SetNumUninitialized(TextLen);
+		const TCHAR* RESTRICT Source = *Text;
+		TCHAR* RESTRICT Target = Folded.GetData();
+		for (int32 Index = 0; Index < TextLen; ++Index)
 		{
-			const FText& TextVal = TextProp->GetPropertyValue(ValuePtr);
-			const FString* SourceString = FTextInspector::GetSourceString(TextVal);
-			FString StringToSearch = (SourceString != nullptr && !SourceString->IsEmpty())
-				? *SourceString
-				: TextVal.ToString();
+			Target[Index] = FChar::ToLower(Source[Index]);
+		}
 
-			if (StringToSearch.Contains(SearchText, ESearchCase::IgnoreCase))
+		const TCHAR First = Needle[0];
+		const TCHAR* Rest = Needle.GetData() + 1;
+		const SIZE_T RestBytes = (NeedleLen - 1) * sizeof(TCHAR);
+		for (int32 Start = 0; Start <= TextLen - NeedleLen; ++Start)
+		{
+			if (Target[Start] == First && FMemory::Memcmp(Target + Start + 1, Rest, RestBytes) == 0)
 			{
-				TSharedRef<FJsonObject> Match = MakeShared<FJsonObject>();
-				Match->SetStringField(TEXT("field"), FieldPath);
-				Match->SetStringField(TEXT("value"), StringToSearch);
-				OutMatches.Add(MakeShared<FJsonValueObject>(Match));
+				return true;
 			}
-			continue;
 		}
+		return false;
+	}
+
+	TArray<TCHAR> Needle;
+};
 
-		// Check FString
-		if (const FStrProperty* StrProp = CastField<FStrProperty>(Property))
+static bool SearchRowFields(
+	const UStruct* StructType,
+	const void* StructData,
+	const FUDBFoldedSearch& Search,
+	const FUDBCompiledProjection* FieldFilter,
+	const FString& FieldPrefix,
+	TArray<TSharedPtr<FJsonValue>>* OutMatches);
+
+/**
+ * Search one property value. ChildFilter narrows nested structs; null searches everything beneath.
+ * Without OutMatches, only reports whether anything matched and stops at the first hit.
+ */
+static bool SearchPropertyValue(
+	const FProperty* Property,
+	const FString& PropertyName,
+	const void* ValuePtr,
+	const FUDBFoldedSearch& Search,
+	const FUDBCompiledProjection* ChildFilter,
+	const FString& FieldPrefix,
+	TArray<TSharedPtr<FJsonValue>>* OutMatches)
+{
+	auto Check = [&](const FString& Value)
+	{
+		if (!Search.Matches(Value))
 		{
-			const FString& StringVal = StrProp->GetPropertyValue(ValuePtr);
-			if (StringVal.Contains(SearchText, ESearchCase::IgnoreCase))
-			{
-				TSharedRef<FJsonObject> Match = MakeShared<FJsonObject>();
-				Match->SetStringField(TEXT("field"), FieldPath);
-				Match->SetStringField(TEXT("value"), StringVal);
-				OutMatches.Add(MakeShared<FJsonValueObject>(Match));
-			}
-			continue;
+			return false;
+		}
+		if (OutMatches != nullptr)
+		{
+			AddSearchMatch(FieldPrefix, PropertyName, Value, *OutMatches);
 		}
+		return true;
+	};
+
+	// Check FText
+	if (const FTextProperty* TextProp = CastField<FTextProperty>(Property))
+	{
+		const FText& TextVal = TextProp->GetPropertyValue(ValuePtr);
+		const FString* SourceString = FTextInspector::GetSourceString(TextVal);
+		return (SourceString != nullptr && !SourceString->IsEmpty())
+			? Check(*SourceString)
+			: Check(TextVal.ToString());
+	}
 
-		// Check FName
-		if (const FNameProperty* NameProp = CastField<FNameProperty>(Property))
+	// Check FString
+	if (const FStrProperty* StrProp = CastField<FStrProperty>(Property))
+	{
+		return Check(StrProp->GetPropertyValue(ValuePtr));
+	}
+
+	// Check FName
+	if (const FNameProperty* NameProp = CastField<FNameProperty>(Property))
+	{
+		return Check(NameProp->GetPropertyValue(ValuePtr).ToString());
+	}
+
+	// Recurse into nested structs (skip GameplayTag, SoftObjectPath, InstancedStruct)
+	if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	{
+		const UScriptStruct* InnerStruct = StructProp->Struct;
+		if (InnerStruct != FGameplayTag::StaticStruct()
+			&& InnerStruct != TBaseStructure<FSoftObjectPath>::Get()
+			&& InnerStruct != FInstancedStruct::StaticStruct())
 		{
-			const FString NameStr = NameProp->GetPropertyValue(ValuePtr).ToString();
-			if (NameStr.Contains(SearchText, ESearchCase::IgnoreCase))
-			{
-				TSharedRef<FJsonObject> Match = MakeShared<FJsonObject>();
-				Match->SetStringField(TEXT("field"), FieldPath);
-				Match->SetStringField(TEXT("value"), NameStr);
-				OutMatches.Add(MakeShared<FJsonValueObject>(Match));
-			}
-			continue;
+			const FString NestedPrefix = OutMatches == nullptr ? FString()
+				: FieldPrefix.IsEmpty() ? PropertyName : FieldPrefix + TEXT(".") + PropertyName;
+			return SearchRowFields(InnerStruct, ValuePtr, Search, ChildFilter, NestedPrefix, OutMatches);
 		}
+	}
+	return false;
+}
 
-		// Recurse into nested structs (skip GameplayTag, SoftObjectPath, InstancedStruct)
-		if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+/**
+ * Recursively search struct fields for a substring match. Appends matching {field, value} pairs to
+ * OutMatches when given. FieldFilter is compiled once per request against the row struct; null
+ * searches every field.
+ */
+static bool SearchRowFields(
+	const UStruct* StructType,
+	const void* StructData,
+	const FUDBFoldedSearch& Search,
+	const FUDBCompiledProjection* FieldFilter,
+	const FString& FieldPrefix,
+	TArray<TSharedPtr<FJsonValue>>* OutMatches)
+{
+	bool bMatched = false;
+	if (FieldFilter != nullptr)
+	{
+		for (const FUDBCompiledProjection::FField& Field : FieldFilter->Fields)
 		{
-			const UScriptStruct* InnerStruct = StructProp->Struct;
-			if (InnerStruct != FGameplayTag::StaticStruct()
-				&& InnerStruct != TBaseStructure<FSoftObjectPath>::Get()
-				&& InnerStruct != FInstancedStruct::StaticStruct())
+			const void* ValuePtr = Field.Property->ContainerPtrToValuePtr<void>(StructData);
+			bMatched |= SearchPropertyValue(Field.Property, Field.Name, ValuePtr, Search, Field.Child.Get(), FieldPrefix, OutMatches);
+			if (bMatched && OutMatches == nullptr)
 			{
-				SearchRowFields(InnerStruct, ValuePtr, SearchText, FieldFilter, FieldPath, OutMatches);
+				return true;
 			}
 		}
+		return bMatched;
+	}
+
+	for (TFieldIterator<FProperty> It(StructType); It; ++It)
+	{
+		const FProperty* Property = *It;
+		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(StructData);
+		bMatched |= SearchPropertyValue(Property, Property->GetName(), ValuePtr, Search, nullptr, FieldPrefix, OutMatches);
+		if (bMatched && OutMatches == nullptr)
+		{
+			return true;
+		}
 	}
+	return bMatched;
 }
 
 FUDBCommandResult FUDBDataTableOps::SearchDatatableContent(const TSharedPtr<FJsonObject>& Params)
@@ -1286,35 +1877,18 @@ FUDBCommandResult FUDBDataTableOps::SearchDatatableContent(const TSharedPtr<FJso
 		);
 	}
 
-	// Parse optional fields filter
-	TSet<FString> FieldFilter;
-	const TArray<TSharedPtr<FJsonValue>>* FieldsArray = nullptr;
-	if (Params->TryGetArrayField(TEXT("fields"), FieldsArray) && FieldsArray != nullptr)
+	// Parse optional fields filter and preview_fields, compiled once against the row struct.
+	// Bare names in "fields" also match same-named fields inside nested structs.
+	TArray<FString> Warnings;
+	const FUDBFieldProjection FieldProjection = ParseFieldProjection(Params, TEXT("fields"), Warnings, RowStruct);
+	TSharedPtr<const FUDBCompiledProjection> FieldFilter;
+	if (!FieldProjection.IsEmpty())
 	{
-		for (const TSharedPtr<FJsonValue>& FieldValue : *FieldsArray)
-		{
-			FString FieldName;
-			if (FieldValue.IsValid() && FieldValue->TryGetString(FieldName))
-			{
-				FieldFilter.Add(FieldName);
-			}
-		}
+		FieldFilter = FUDBCompiledProjection::Compile(RowStruct, FieldProjection, true);
 	}
 
-	// Parse optional preview_fields
-	TArray<FString> PreviewFields;
-	const TArray<TSharedPtr<FJsonValue>>* PreviewArray = nullptr;
-	if (Params->TryGetArrayField(TEXT("preview_fields"), PreviewArray) && PreviewArray != nullptr)
-	{
-		for (const TSharedPtr<FJsonValue>& FieldValue : *PreviewArray)
-		{
-			FString FieldName;
-			if (FieldValue.IsValid() && FieldValue->TryGetString(FieldName))
-			{
-				PreviewFields.Add(FieldName);
-			}
-		}
-	}
+	const FUDBFieldProjection PreviewProjection = ParseFieldProjection(Params, TEXT("preview_fields"), Warnings, RowStruct);
+	const TSharedRef<const FUDBCompiledProjection> CompiledPreview = FUDBCompiledProjection::Compile(RowStruct, PreviewProjection);
 
 	// Parse limit
 	int32 Limit = 20;
@@ -1324,43 +1898,65 @@ FUDBCommandResult FUDBDataTableOps::SearchDatatableContent(const TSharedPtr<FJso
 		Limit = FMath::Max(1, static_cast<int32>(LimitVal));
 	}
 
-	// Search all rows
-	TArray<FName> RowNames = DataTable->GetRowNames();
-	TArray<TSharedPtr<FJsonValue>> ResultsArray;
-	int32 TotalMatches = 0;
+	// Rows holding every trigram of the search text when the table has a text index, else all rows;
+	// either way each row is checked field by field below
+	TArray<FName> RowNames;
+	const bool bIndexed = FUDBTextIndex::FindCandidates(DataTable, SearchText, RowNames);
+	if (!bIndexed)
+	{
+		RowNames = DataTable->GetRowNames();
+	}
 
+	TArray<const uint8*> RowDatas;
+	RowDatas.Reserve(RowNames.Num());
 	for (const FName& RowName : RowNames)
 	{
-		if (TotalMatches >= Limit)
+		RowDatas.Add(DataTable->FindRowUnchecked(RowName));
+	}
+
+	// Every row is checked (across workers on large tables) so total_matches is exact; match details
+	// and previews are only built for the first `limit` matches, in row order
+	const FUDBFoldedSearch Search(SearchText);
+	const int32 NumRows = RowDatas.Num();
+	const int32 NumChunks = GetSerializeChunkCount(NumRows);
+	TArray<uint8> Matched;
+	Matched.SetNumZeroed(NumRows);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Begin = static_cast<int32>(int64(NumRows) * ChunkIndex / NumChunks);
+		const int32 End = static_cast<int32>(int64(NumRows) * (ChunkIndex + 1) / NumChunks);
+		for (int32 Index = Begin; Index < End; ++Index)
 		{
-			break;
+			Matched[Index] = RowDatas[Index] != nullptr
+				&& SearchRowFields(RowStruct, RowDatas[Index], Search, FieldFilter.Get(), FString(), nullptr);
 		}
+	}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-		const void* RowData = DataTable->FindRowUnchecked(RowName);
-		if (RowData == nullptr)
+	TArray<TSharedPtr<FJsonValue>> ResultsArray;
+	int32 TotalMatches = 0;
+	for (int32 Index = 0; Index < NumRows; ++Index)
+	{
+		if (!Matched[Index])
 		{
 			continue;
 		}
 
-		TArray<TSharedPtr<FJsonValue>> Matches;
-		SearchRowFields(RowStruct, RowData, SearchText, FieldFilter, FString(), Matches);
-
-		if (Matches.Num() == 0)
+		if (++TotalMatches > Limit)
 		{
 			continue;
 		}
 
-		++TotalMatches;
+		TArray<TSharedPtr<FJsonValue>> Matches;
+		SearchRowFields(RowStruct, RowDatas[Index], Search, FieldFilter.Get(), FString(), &Matches);
 
 		TSharedRef<FJsonObject> ResultEntry = MakeShared<FJsonObject>();
-		ResultEntry->SetStringField(TEXT("row_name"), RowName.ToString());
+		ResultEntry->SetStringField(TEXT("row_name"), RowNames[Index].ToString());
 		ResultEntry->SetArrayField(TEXT("matches"), Matches);
 
 		// Build preview from requested fields (pre-serialization filter)
-		if (PreviewFields.Num() > 0)
+		if (!PreviewProjection.IsEmpty())
 		{
-			TSet<FString> PreviewFieldsSet(PreviewFields);
-			TSharedPtr<FJsonObject> Preview = FUDBSerializer::StructToJson(RowStruct, RowData, PreviewFieldsSet);
+			TSharedPtr<FJsonObject> Preview = FUDBSerializer::StructToJson(RowStruct, RowDatas[Index], *CompiledPreview);
 			ResultEntry->SetObjectField(TEXT("preview"), Preview);
 		}
 
@@ -1373,8 +1969,263 @@ FUDBCommandResult FUDBDataTableOps::SearchDatatableContent(const TSharedPtr<FJso
 	Data->SetNumberField(TEXT("total_matches"), TotalMatches);
 	Data->SetNumberField(TEXT("limit"), Limit);
 	Data->SetArrayField(TEXT("results"), ResultsArray);
+	if (bIndexed)
+	{
+		TSharedPtr<FJsonObject> IndexJson = MakeShared<FJsonObject>();
+		IndexJson->SetStringField(TEXT("type"), TEXT("trigram"));
+		IndexJson->SetNumberField(TEXT("candidates"), RowNames.Num());
+		Data->SetObjectField(TEXT("index_used"), IndexJson);
+	}
 
-	return FUDBCommandHandler::Success(Data);
+	FUDBCommandResult Result = FUDBCommandHandler::Success(Data);
+	Result.Warnings = MoveTemp(Warnings);
+	return Result;
+}
+
+/** Whether a row struct is the one asked for, by short name or full path */
+static bool MatchesRowStructFilter(const FString& StructPath, const FString& Filter)
+{
+	return StructPath.Equals(Filter, ESearchCase::IgnoreCase)
+		|| StructPath.EndsWith(TEXT(".") + Filter, ESearchCase::IgnoreCase);
+}
+
+FUDBCommandResult FUDBDataTableOps::SearchAllContent(const TSharedPtr<FJsonObject>& Params)
+{
+	FString SearchText;
+	if (!Params.IsValid() || !Params->TryGetStringField(TEXT("search_text"), SearchText) || SearchText.IsEmpty())
+	{
+		return FUDBCommandHandler::Error(
+			UDBErrorCodes::InvalidValue,
+			TEXT("Missing or empty required param: search_text")
+		);
+	}
+
+	FString PathFilter;
+	FString RowStructFilter;
+	bool bIncludeComposites = false;
+	bool bLoadUnloaded = true;
+	Params->TryGetStringField(TEXT("path_filter"), PathFilter);
+	Params->TryGetStringField(TEXT("row_struct"), RowStructFilter);
+	Params->TryGetBoolField(TEXT("include_composites"), bIncludeComposites);
+	Params->TryGetBoolField(TEXT("load_unloaded"), bLoadUnloaded);
+
+	int32 Limit = 50;
+	double LimitVal = 0.0;
+	if (Params->TryGetNumberField(TEXT("limit"), LimitVal))
+	{
+		Limit = FMath::Max(1, static_cast<int32>(LimitVal));
+	}
+
+	TArray<FString> Warnings;
+	const FUDBFieldProjection FieldProjection = ParseFieldProjection(Params, TEXT("fields"), Warnings);
+	const FUDBFieldProjection PreviewProjection = ParseFieldProjection(Params, TEXT("preview_fields"), Warnings);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Tables already in memory, then assets that match the filters but still need loading
+	TArray<UDataTable*> Tables;
+	auto AcceptTable = [&](UDataTable* DataTable)
+	{
+		const UScriptStruct* RowStruct = DataTable != nullptr ? DataTable->GetRowStruct() : nullptr;
+		if (RowStruct == nullptr
+			|| (!bIncludeComposites && DataTable->IsA<UCompositeDataTable>())
+			|| (!PathFilter.IsEmpty() && !DataTable->GetPathName().StartsWith(PathFilter))
+			|| (!RowStructFilter.IsEmpty() && !MatchesRowStructFilter(RowStruct->GetPathName(), RowStructFilter)))
+		{
+			return;
+		}
+		Tables.AddUnique(DataTable);
+	};
+
+	for (TObjectIterator<UDataTable> It; It; ++It)
+	{
+		AcceptTable(*It);
+	}
+
+	int32 NumLoaded = 0;
+	double LoadMs = 0.0;
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	if (bLoadUnloaded && AssetRegistry != nullptr)
+	{
+		FARFilter Filter;
+		Filter.ClassPaths.Add(UDataTable::StaticClass()->GetClassPathName());
+		Filter.bRecursiveClasses = true;
+		TArray<FAssetData> AssetDataList;
+		AssetRegistry->GetAssets(Filter, AssetDataList);
+
+		// Request every package up front so the loader overlaps their IO, then wait for all of them
+		TArray<int32> RequestIds;
+		TArray<FSoftObjectPath> PendingPaths;
+		for (const FAssetData& AssetData : AssetDataList)
+		{
+			FString RowStructTag;
+			if (AssetData.IsAssetLoaded()
+				|| (!PathFilter.IsEmpty() && !AssetData.GetObjectPathString().StartsWith(PathFilter))
+				|| (!RowStructFilter.IsEmpty() && AssetData.GetTagValue(TEXT("RowStructure"), RowStructTag) && !MatchesRowStructFilter(RowStructTag, RowStructFilter)))
+			{
+				continue;
+			}
+			RequestIds.Add(LoadPackageAsync(AssetData.PackageName.ToString()));
+			PendingPaths.Add(AssetData.GetSoftObjectPath());
+		}
+
+		if (RequestIds.Num() > 0)
+		{
+			const double LoadStart = FPlatformTime::Seconds();
+			FlushAsyncLoading(RequestIds);
+			LoadMs = (FPlatformTime::Seconds() - LoadStart) * 1000.0;
+
+			for (const FSoftObjectPath& Path : PendingPaths)
+			{
+				if (UDataTable* DataTable = Cast<UDataTable>(Path.ResolveObject()))
+				{
+					AcceptTable(DataTable);
+					++NumLoaded;
+				}
+			}
+		}
+	}
+
+	Tables.Sort([](const UDataTable& A, const UDataTable& B) { return A.GetPathName() < B.GetPathName(); });
+
+	// Rows to check per table (trigram candidates where indexed), laid end to end so workers can
+	// split them evenly however they are spread across tables
+	struct FTableScan
+	{
+		UDataTable* Table = nullptr;
+		TSharedPtr<const FUDBCompiledProjection> FieldFilter;
+		TArray<FName> RowNames;
+		TArray<const uint8*> RowDatas;
+		int32 FirstRow = 0;
+		bool bIndexed = false;
+	};
+	TArray<FTableScan> Scans;
+	Scans.Reserve(Tables.Num());
+	int32 TotalRows = 0;
+	for (UDataTable* DataTable : Tables)
+	{
+		FTableScan& Scan = Scans.AddDefaulted_GetRef();
+		Scan.Table = DataTable;
+		Scan.FirstRow = TotalRows;
+		if (!FieldProjection.IsEmpty())
+		{
+			Scan.FieldFilter = FUDBCompiledProjection::Compile(DataTable->GetRowStruct(), FieldProjection, true);
+		}
+
+		Scan.bIndexed = FUDBTextIndex::FindCandidates(DataTable, SearchText, Scan.RowNames);
+		if (!Scan.bIndexed)
+		{
+			Scan.RowNames = DataTable->GetRowNames();
+		}
+		Scan.RowDatas.Reserve(Scan.RowNames.Num());
+		for (const FName& RowName : Scan.RowNames)
+		{
+			Scan.RowDatas.Add(DataTable->FindRowUnchecked(RowName));
+		}
+		TotalRows += Scan.RowDatas.Num();
+	}
+
+	const FUDBFoldedSearch Search(SearchText);
+	const int32 NumChunks = GetSerializeChunkCount(TotalRows);
+	TArray<uint8> Matched;
+	Matched.SetNumZeroed(TotalRows);
+	TArray<int64> TableCycles;
+	TableCycles.SetNumZeroed(Scans.Num());
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Begin = static_cast<int32>(int64(TotalRows) * ChunkIndex / NumChunks);
+		const int32 End = static_cast<int32>(int64(TotalRows) * (ChunkIndex + 1) / NumChunks);
+		int32 TableIndex = Algo::UpperBoundBy(Scans, Begin, &FTableScan::FirstRow) - 1;
+		for (int32 Index = Begin; Index < End; ++TableIndex)
+		{
+			const FTableScan& Scan = Scans[TableIndex];
+			const int32 SegmentEnd = FMath::Min(End, Scan.FirstRow + Scan.RowDatas.Num());
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (; Index < SegmentEnd; ++Index)
+			{
+				const uint8* RowData = Scan.RowDatas[Index - Scan.FirstRow];
+				Matched[Index] = RowData != nullptr
+					&& SearchRowFields(Scan.Table->GetRowStruct(), RowData, Search, Scan.FieldFilter.Get(), FString(), nullptr);
+			}
+			FPlatformAtomics::InterlockedAdd(&TableCycles[TableIndex], static_cast<int64>(FPlatformTime::Cycles64() - StartCycles));
+		}
+	}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Group by table, in path order; the global limit caps result rows, not the per-table counts
+	TArray<TSharedPtr<FJsonValue>> TablesArray;
+	int32 TotalMatches = 0;
+	int32 Returned = 0;
+	for (int32 TableIndex = 0; TableIndex < Scans.Num(); ++TableIndex)
+	{
+		const FTableScan& Scan = Scans[TableIndex];
+		const UScriptStruct* RowStruct = Scan.Table->GetRowStruct();
+		TSharedPtr<const FUDBCompiledProjection> CompiledPreview;
+
+		TArray<TSharedPtr<FJsonValue>> ResultsArray;
+		int32 TableMatches = 0;
+		for (int32 RowIndex = 0; RowIndex < Scan.RowDatas.Num(); ++RowIndex)
+		{
+			if (!Matched[Scan.FirstRow + RowIndex])
+			{
+				continue;
+			}
+
+			++TableMatches;
+			if (Returned >= Limit)
+			{
+				continue;
+			}
+			++Returned;
+
+			TArray<TSharedPtr<FJsonValue>> Matches;
+			SearchRowFields(RowStruct, Scan.RowDatas[RowIndex], Search, Scan.FieldFilter.Get(), FString(), &Matches);
+
+			TSharedRef<FJsonObject> ResultEntry = MakeShared<FJsonObject>();
+			ResultEntry->SetStringField(TEXT("row_name"), Scan.RowNames[RowIndex].ToString());
+			ResultEntry->SetArrayField(TEXT("matches"), Matches);
+			if (!PreviewProjection.IsEmpty())
+			{
+				if (!CompiledPreview.IsValid())
+				{
+					CompiledPreview = FUDBCompiledProjection::Compile(RowStruct, PreviewProjection);
+				}
+				ResultEntry->SetObjectField(TEXT("preview"), FUDBSerializer::StructToJson(RowStruct, Scan.RowDatas[RowIndex], *CompiledPreview));
+			}
+			ResultsArray.Add(MakeShared<FJsonValueObject>(ResultEntry));
+		}
+
+		if (TableMatches == 0)
+		{
+			continue;
+		}
+		TotalMatches += TableMatches;
+
+		TSharedRef<FJsonObject> TableEntry = MakeShared<FJsonObject>();
+		TableEntry->SetStringField(TEXT("table_path"), Scan.Table->GetPathName());
+		TableEntry->SetStringField(TEXT("row_struct"), RowStruct->GetName());
+		TableEntry->SetNumberField(TEXT("total_matches"), TableMatches);
+		TableEntry->SetNumberField(TEXT("rows_checked"), Scan.RowDatas.Num());
+		TableEntry->SetBoolField(TEXT("indexed"), Scan.bIndexed);
+		TableEntry->SetNumberField(TEXT("search_ms"), FPlatformTime::ToMilliseconds64(TableCycles[TableIndex]));
+		TableEntry->SetArrayField(TEXT("results"), ResultsArray);
+		TablesArray.Add(MakeShared<FJsonValueObject>(TableEntry));
+	}
+
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetStringField(TEXT("search_text"), SearchText);
+	Data->SetNumberField(TEXT("tables_searched"), Scans.Num());
+	Data->SetNumberField(TEXT("tables_loaded"), NumLoaded);
+	Data->SetNumberField(TEXT("rows_checked"), TotalRows);
+	Data->SetNumberField(TEXT("total_matches"), TotalMatches);
+	Data->SetNumberField(TEXT("returned"), Returned);
+	Data->SetNumberField(TEXT("limit"), Limit);
+	Data->SetNumberField(TEXT("load_ms"), LoadMs);
+	Data->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	Data->SetArrayField(TEXT("tables"), TablesArray);
+
+	FUDBCommandResult Result = FUDBCommandHandler::Success(Data);
+	Result.Warnings = MoveTemp(Warnings);
+	return Result;
 }
 
 FUDBCommandResult FUDBDataTableOps::GetDataCatalog(const TSharedPtr<FJsonObject>& Params)
@@ -1599,6 +2450,13 @@ FUDBCommandResult FUDBDataTableOps::ResolveTags(const TSharedPtr<FJsonObject>& P
 		);
 	}
 
+	// Unchanged table and identical request: answer without touching a single row
+	const FString ETag = FUDBTableVersions::MakeReadETag(DataTable, Params);
+	if (FUDBCommandHandler::MatchesIfNoneMatch(Params, ETag))
+	{
+		return FUDBCommandHandler::NotModified(ETag);
+	}
+
 	// Find the tag field property
 	const FProperty* TagProperty = RowStruct->FindPropertyByName(FName(*TagFieldName));
 	if (TagProperty == nullptr)
@@ -1611,124 +2469,473 @@ FUDBCommandResult FUDBDataTableOps::ResolveTags(const TSharedPtr<FJsonObject>& P
 
 	// Validate it's a GameplayTag or GameplayTagContainer
 	const FStructProperty* StructProp = CastField<FStructProperty>(TagProperty);
-	bool bIsGameplayTag = false;
-	bool bIsGameplayTagContainer = false;
-	if (StructProp != nullptr)
+	if (StructProp == nullptr
+		|| (StructProp->Struct != FGameplayTag::StaticStruct() && StructProp->Struct != FGameplayTagContainer::StaticStruct()))
 	{
-		bIsGameplayTag = (StructProp->Struct == FGameplayTag::StaticStruct());
-		bIsGameplayTagContainer = (StructProp->Struct == FGameplayTagContainer::StaticStruct());
+		return FUDBCommandHandler::Error(
+			UDBErrorCodes::InvalidField,
+			FString::Printf(TEXT("Field '%s' is not FGameplayTag or FGameplayTagContainer"), *TagFieldName)
+		);
 	}
 
-	if (!bIsGameplayTag && !bIsGameplayTagContainer)
+	// "exact" matches the requested tags only; "hierarchical" also matches their children
+	FString MatchMode = TEXT("exact");
+	Params->TryGetStringField(TEXT("match_mode"), MatchMode);
+	if (MatchMode != TEXT("exact") && MatchMode != TEXT("hierarchical"))
 	{
 		return FUDBCommandHandler::Error(
-			UDBErrorCodes::InvalidField,
-			FString::Printf(TEXT("Field '%s' is not FGameplayTag or FGameplayTagContainer"), *TagFieldName)
+			UDBErrorCodes::InvalidValue,
+			FString::Printf(TEXT("Invalid match_mode '%s'. Must be one of: exact, hierarchical"), *MatchMode)
 		);
 	}
 
-	// Parse requested tags into a set
-	TSet<FString> RequestedTags;
+	// Parse requested tags; names the tag manager does not know cannot be on any row
+	TArray<FString> RequestedTags;
+	TArray<FGameplayTag> LookupTags;
 	for (const TSharedPtr<FJsonValue>& TagValue : *TagsArray)
 	{
 		FString TagString;
-		if (TagValue.IsValid() && TagValue->TryGetString(TagString))
+		if (TagValue.IsValid() && TagValue->TryGetString(TagString) && !RequestedTags.Contains(TagString))
 		{
 			RequestedTags.Add(TagString);
+			const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(*TagString), false);
+			if (Tag.IsValid())
+			{
+				LookupTags.Add(Tag);
+			}
 		}
 	}
 
-	// Parse optional fields projection
-	TSet<FString> FieldsProjection;
-	const TArray<TSharedPtr<FJsonValue>>* FieldsArray = nullptr;
-	if (Params->TryGetArrayField(TEXT("fields"), FieldsArray) && FieldsArray != nullptr)
+	// Parse optional fields projection (top-level names or nested paths like "Stats.Damage")
+	TArray<FString> Warnings;
+	const FUDBFieldProjection FieldsProjection = ParseFieldProjection(Params, TEXT("fields"), Warnings, RowStruct);
+	const FUDBSerializeOptions SerializeOptions = FUDBSerializeOptions::FromParams(Params, RowStruct);
+
+	// Look the tags up in the field's reverse index; matched rows are serialized afterwards in one (possibly parallel) pass
+	TArray<FUDBTagIndex::FRowMatch> Matches;
+	TSet<FGameplayTag> ResolvedTags;
+	FUDBTagIndex::FindRows(DataTable, TagProperty->GetFName(), LookupTags, MatchMode == TEXT("hierarchical"), Matches, ResolvedTags);
+
+	TArray<TPair<FName, const uint8*>> MatchedRows;
+	TArray<TArray<FString>> MatchedRowTags;
+	MatchedRows.Reserve(Matches.Num());
+	MatchedRowTags.Reserve(Matches.Num());
+	for (const FUDBTagIndex::FRowMatch& Match : Matches)
 	{
-		for (const TSharedPtr<FJsonValue>& FieldValue : *FieldsArray)
+		const uint8* RowData = DataTable->FindRowUnchecked(Match.RowName);
+		if (RowData == nullptr)
 		{
-			FString FieldName;
-			if (FieldValue.IsValid() && FieldValue->TryGetString(FieldName))
-			{
-				FieldsProjection.Add(FieldName);
-			}
+			continue;
 		}
+
+		TArray<FString>& MatchedTags = MatchedRowTags.AddDefaulted_GetRef();
+		for (const FGameplayTag& Tag : Match.Tags)
+		{
+			MatchedTags.Add(Tag.ToString());
+		}
+		MatchedRows.Emplace(Match.RowName, RowData);
 	}
 
-	// Scan all rows
-	TSet<FString> ResolvedTags;
+	FUDBJsonFragmentMap RowFragments;
+	TArray<TSharedPtr<FJsonObject>> Entries = SerializeRowEntries(DataTable, RowStruct, MatchedRows, FieldsProjection, SerializeOptions, RowFragments);
+
 	TArray<TSharedPtr<FJsonValue>> ResolvedArray;
+	ResolvedArray.Reserve(Entries.Num());
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		TArray<TSharedPtr<FJsonValue>> MatchedTagsArray;
+		for (const FString& Tag : MatchedRowTags[Index])
+		{
+			MatchedTagsArray.Add(MakeShared<FJsonValueString>(Tag));
+		}
+		Entries[Index]->SetArrayField(TEXT("matched_tags"), MatchedTagsArray);
 
-	TArray<FName> RowNames = DataTable->GetRowNames();
-	for (const FName& RowName : RowNames)
+		ResolvedArray.Add(MakeShared<FJsonValueObject>(Entries[Index]));
+	}
+
+	// Compute unresolved tags
+	TArray<TSharedPtr<FJsonValue>> UnresolvedArray;
+	for (const FString& Tag : RequestedTags)
 	{
-		const uint8* RowData = DataTable->FindRowUnchecked(RowName);
-		if (RowData == nullptr)
+		if (!ResolvedTags.Contains(FGameplayTag::RequestGameplayTag(FName(*Tag), false)))
 		{
-			continue;
+			UnresolvedArray.Add(MakeShared<FJsonValueString>(Tag));
 		}
+	}
 
-		const void* FieldPtr = TagProperty->ContainerPtrToValuePtr<void>(RowData);
-		TArray<FString> MatchedTags;
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetStringField(TEXT("table_path"), TablePath);
+	Data->SetStringField(TEXT("tag_field"), TagFieldName);
+	Data->SetStringField(TEXT("match_mode"), MatchMode);
+	Data->SetArrayField(TEXT("resolved"), ResolvedArray);
+	Data->SetNumberField(TEXT("resolved_count"), ResolvedArray.Num());
+	Data->SetArrayField(TEXT("unresolved_tags"), UnresolvedArray);
+	Data->SetStringField(TEXT("etag"), ETag);
+
+	FUDBCommandResult Result = FUDBCommandHandler::Success(Data);
+	Result.PreserializedObjects = MoveTemp(RowFragments);
+	Result.Warnings = MoveTemp(Warnings);
+	return Result;
+}
 
-		if (bIsGameplayTag)
+FUDBCommandResult FUDBDataTableOps::GetCompositeLayout(const TSharedPtr<FJsonObject>& Params)
+{
+	FString TablePath;
+	if (!Params.IsValid() || !Params->TryGetStringField(TEXT("table_path"), TablePath))
+	{
+		return FUDBCommandHandler::Error(
+			UDBErrorCodes::InvalidField,
+			TEXT("Missing required param: table_path")
+		);
+	}
+
+	FUDBCommandResult LoadError;
+	UDataTable* DataTable = LoadDataTable(TablePath, LoadError);
+	if (DataTable == nullptr)
+	{
+		return LoadError;
+	}
+
+	const UCompositeDataTable* CompositeTable = Cast<UCompositeDataTable>(DataTable);
+	if (CompositeTable == nullptr)
+	{
+		return FUDBCommandHandler::Error(
+			UDBErrorCodes::InvalidValue,
+			FString::Printf(TEXT("'%s' is not a CompositeDataTable"), *TablePath)
+		);
+	}
+
+	bool bOverriddenOnly = false;
+	Params->TryGetBoolField(TEXT("overridden_only"), bOverriddenOnly);
+
+	// Optional subset of rows; unknown names are reported rather than failing the request
+	TArray<FName> RequestedRows;
+	const TArray<TSharedPtr<FJsonValue>>* RowNamesArray = nullptr;
+	if (Params->TryGetArrayField(TEXT("row_names"), RowNamesArray) && RowNamesArray != nullptr)
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *RowNamesArray)
 		{
-			const FGameplayTag* Tag = static_cast<const FGameplayTag*>(FieldPtr);
-			if (Tag->IsValid() && RequestedTags.Contains(Tag->ToString()))
+			FString RowName;
+			if (Value.IsValid() && Value->TryGetString(RowName))
 			{
-				MatchedTags.Add(Tag->ToString());
+				RequestedRows.Add(FName(*RowName));
 			}
 		}
-		else if (bIsGameplayTagContainer)
+	}
+
+	const FUDBCompositeLayout::FLayout& Layout = *FUDBCompositeLayout::Get(CompositeTable);
+
+	// Rows per source: the rows it supplies and the ones a later source overrides
+	TArray<int32> OwnedCounts;
+	TArray<int32> ShadowedCounts;
+	OwnedCounts.SetNumZeroed(Layout.Sources.Num());
+	ShadowedCounts.SetNumZeroed(Layout.Sources.Num());
+	int32 OverriddenCount = 0;
+	for (const TPair<FName, TArray<int32, TInlineAllocator<2>>>& Pair : Layout.Chains)
+	{
+		++OwnedCounts[Pair.Value.Last()];
+		for (int32 Index = 0; Index + 1 < Pair.Value.Num(); ++Index)
 		{
-			const FGameplayTagContainer* Container = static_cast<const FGameplayTagContainer*>(FieldPtr);
-			for (const FGameplayTag& Tag : *Container)
-			{
-				if (Tag.IsValid() && RequestedTags.Contains(Tag.ToString()))
-				{
-					MatchedTags.Add(Tag.ToString());
-				}
-			}
+			++ShadowedCounts[Pair.Value[Index]];
 		}
+		OverriddenCount += Pair.Value.Num() > 1 ? 1 : 0;
+	}
 
-		if (MatchedTags.Num() == 0)
+	TArray<TSharedPtr<FJsonValue>> SourcesArray;
+	for (int32 SourceIndex = 0; SourceIndex < Layout.Sources.Num(); ++SourceIndex)
+	{
+		TSharedPtr<FJsonObject> SourceJson = MakeShared<FJsonObject>();
+		SourceJson->SetNumberField(TEXT("index"), SourceIndex);
+		SourceJson->SetStringField(TEXT("name"), Layout.Sources[SourceIndex]->GetName());
+		SourceJson->SetStringField(TEXT("path"), Layout.Sources[SourceIndex]->GetPathName());
+		SourceJson->SetNumberField(TEXT("row_count"), Layout.Sources[SourceIndex]->GetRowMap().Num());
+		SourceJson->SetNumberField(TEXT("owned_rows"), OwnedCounts[SourceIndex]);
+		SourceJson->SetNumberField(TEXT("overridden_rows"), ShadowedCounts[SourceIndex]);
+		SourcesArray.Add(MakeShared<FJsonValueObject>(SourceJson));
+	}
+
+	auto MakeRowJson = [&Layout](FName RowName, const TArray<int32, TInlineAllocator<2>>& Chain)
+	{
+		TArray<TSharedPtr<FJsonValue>> ChainArray;
+		for (const int32 SourceIndex : Chain)
 		{
-			continue;
+			ChainArray.Add(MakeShared<FJsonValueNumber>(SourceIndex));
 		}
 
-		for (const FString& Tag : MatchedTags)
+		TSharedPtr<FJsonObject> RowJson = MakeShared<FJsonObject>();
+		RowJson->SetStringField(TEXT("row_name"), RowName.ToString());
+		RowJson->SetNumberField(TEXT("source"), Chain.Last());
+		RowJson->SetArrayField(TEXT("chain"), ChainArray);
+		return MakeShared<FJsonValueObject>(RowJson);
+	};
+
+	TArray<TSharedPtr<FJsonValue>> RowsArray;
+	TArray<TSharedPtr<FJsonValue>> MissingArray;
+	for (const FName& RowName : RequestedRows.Num() > 0 ? RequestedRows : Layout.RowNames)
+	{
+		const TArray<int32, TInlineAllocator<2>>* Chain = Layout.Chains.Find(RowName);
+		if (Chain == nullptr)
 		{
-			ResolvedTags.Add(Tag);
+			MissingArray.Add(MakeShared<FJsonValueString>(RowName.ToString()));
 		}
+		else if (!bOverriddenOnly || Chain->Num() > 1)
+		{
+			RowsArray.Add(MakeRowJson(RowName, *Chain));
+		}
+	}
 
-		TSharedRef<FJsonObject> EntryJson = MakeShared<FJsonObject>();
-		EntryJson->SetStringField(TEXT("row_name"), RowName.ToString());
-		EntryJson->SetObjectField(TEXT("row_data"), FUDBSerializer::StructToJson(RowStruct, RowData, FieldsProjection));
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetStringField(TEXT("table_path"), TablePath);
+	Data->SetArrayField(TEXT("parent_tables"), GetParentTablesJsonArray(CompositeTable));
+	Data->SetArrayField(TEXT("sources"), SourcesArray);
+	Data->SetNumberField(TEXT("row_count"), Layout.RowNames.Num());
+	Data->SetNumberField(TEXT("overridden_count"), OverriddenCount);
+	Data->SetArrayField(TEXT("rows"), RowsArray);
+	if (MissingArray.Num() > 0)
+	{
+		Data->SetArrayField(TEXT("missing_rows"), MissingArray);
+	}
 
-		TArray<TSharedPtr<FJsonValue>> MatchedTagsArray;
-		for (const FString& Tag : MatchedTags)
+	return FUDBCommandHandler::Success(Data);
+}
+
+/** [{field, type}] for every index on a table */
+static TArray<TSharedPtr<FJsonValue>> GetIndexesJsonArray(const UDataTable* DataTable)
+{
+	TArray<TSharedPtr<FJsonValue>> IndexesArray;
+	for (const TPair<FString, EUDBIndexType>& Index : FUDBTableIndexes::GetIndexes(DataTable))
+	{
+		TSharedPtr<FJsonObject> IndexJson = MakeShared<FJsonObject>();
+		IndexJson->SetStringField(TEXT("field"), Index.Key);
+		IndexJson->SetStringField(TEXT("type"), FUDBTableIndexes::LexToString(Index.Value));
+		IndexesArray.Add(MakeShared<FJsonValueObject>(IndexJson));
+	}
+	return IndexesArray;
+}
+
+FUDBCommandResult FUDBDataTableOps::CreateIndex(const TSharedPtr<FJsonObject>& Params)
+{
+	FString TablePath;
+	if (!Params.IsValid() || !Params->TryGetStringField(TEXT("table_path"), TablePath))
+	{
+		return FUDBCommandHandler::Error(
+			UDBErrorCodes::InvalidField,
+			TEXT("Missing required param: table_path")
+		);
+	}
+
+	FString Field;
+	if (!Params->TryGetStringField(TEXT("field"), Field) || Field.IsEmpty())
+	{
+		return FUDBCommandHandler::Error(
+			UDBErrorCodes::InvalidField,
+			TEXT("Missing required param: field")
+		);
+	}
+
+	FString TypeString = TEXT("hash");
+	Params->TryGetStringField(TEXT("type"), TypeString);
+	EUDBIndexType Type;
+	if (!FUDBTableIndexes::LexFromString(TypeString, Type))
+	{
+		return FUDBCommandHandler::Error(
+			UDBErrorCodes::InvalidValue,
+			FString::Printf(TEXT("Invalid type '%s'. Must be one of: hash, sorted, bitmap"), *TypeString)
+		);
+	}
+
+	FUDBCommandResult LoadError;
+	UDataTable* DataTable = LoadDataTable(TablePath, LoadError);
+	if (DataTable == nullptr)
+	{
+		return LoadError;
+	}
+
+	FUDBTableIndexes::FBuildStats Stats;
+	FString IndexError;
+	if (!FUDBTableIndexes::CreateIndex(DataTable, Field, Type, Stats, IndexError))
+	{
+		return FUDBCommandHandler::Error(UDBErrorCodes::InvalidField, IndexError);
+	}
+
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetStringField(TEXT("table_path"), TablePath);
+	Data->SetStringField(TEXT("field"), Field);
+	Data->SetStringField(TEXT("type"), FUDBTableIndexes::LexToString(Type));
+	Data->SetNumberField(TEXT("row_count"), Stats.NumRows);
+	Data->SetNumberField(TEXT("key_count"), Stats.NumKeys);
+	Data->SetNumberField(TEXT("build_ms"), Stats.BuildMs);
+	Data->SetArrayField(TEXT("indexes"), GetIndexesJsonArray(DataTable));
+	return FUDBCommandHandler::Success(Data);
+}
+
+FUDBCommandResult FUDBDataTableOps::DropIndex(const TSharedPtr<FJsonObject>& Params)
+{
+	FString TablePath;
+	FString Field;
+	if (!Params.IsValid() || !Params->TryGetStringField(TEXT("table_path"), TablePath) || !Params->TryGetStringField(TEXT("field"), Field))
+	{
+		return FUDBCommandHandler::Error(
+			UDBErrorCodes::InvalidField,
+			TEXT("Missing required params: table_path, field")
+		);
+	}
+
+	FUDBCommandResult LoadError;
+	UDataTable* DataTable = LoadDataTable(TablePath, LoadError);
+	if (DataTable == nullptr)
+	{
+		return LoadError;
+	}
+
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetStringField(TEXT("table_path"), TablePath);
+	Data->SetStringField(TEXT("field"), Field);
+	Data->SetBoolField(TEXT("dropped"), FUDBTableIndexes::DropIndex(DataTable, Field));
+	Data->SetArrayField(TEXT("indexes"), GetIndexesJsonArray(DataTable));
+	return FUDBCommandHandler::Success(Data);
+}
+
+FUDBCommandResult FUDBDataTableOps::AggregateDatatable(const TSharedPtr<FJsonObject>& Params)
+{
+	FString TablePath;
+	if (!Params.IsValid() || !Params->TryGetStringField(TEXT("table_path"), TablePath))
+	{
+		return FUDBCommandHandler::Error(
+			UDBErrorCodes::InvalidField,
+			TEXT("Missing required param: table_path")
+		);
+	}
+
+	FUDBCommandResult LoadError;
+	UDataTable* DataTable = LoadDataTable(TablePath, LoadError);
+	if (DataTable == nullptr)
+	{
+		return LoadError;
+	}
+
+	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+	if (RowStruct == nullptr)
+	{
+		return FUDBCommandHandler::Error(
+			UDBErrorCodes::InvalidStructType,
+			FString::Printf(TEXT("DataTable has no row struct: %s"), *TablePath)
+		);
+	}
+
+	// Unchanged table and identical request: answer without touching a single row
+	const FString ETag = FUDBTableVersions::MakeReadETag(DataTable, Params);
+	if (FUDBCommandHandler::MatchesIfNoneMatch(Params, ETag))
+	{
+		return FUDBCommandHandler::NotModified(ETag);
+	}
+
+	// Parse metrics (default: count) and group_by field paths
+	TArray<FString> MetricSpecs;
+	TArray<FString> GroupByPaths;
+	const TArray<TSharedPtr<FJsonValue>>* SpecArray = nullptr;
+	if (Params->TryGetArrayField(TEXT("metrics"), SpecArray) && SpecArray != nullptr)
+	{
+		for (const TSharedPtr<FJsonValue>& SpecValue : *SpecArray)
 		{
-			MatchedTagsArray.Add(MakeShared<FJsonValueString>(Tag));
+			FString Spec;
+			if (SpecValue.IsValid() && SpecValue->TryGetString(Spec))
+			{
+				MetricSpecs.Add(Spec);
+			}
 		}
-		EntryJson->SetArrayField(TEXT("matched_tags"), MatchedTagsArray);
+	}
+	if (Params->TryGetArrayField(TEXT("group_by"), SpecArray) && SpecArray != nullptr)
+	{
+		for (const TSharedPtr<FJsonValue>& PathValue : *SpecArray)
+		{
+			FString Path;
+			if (PathValue.IsValid() && PathValue->TryGetString(Path))
+			{
+				GroupByPaths.Add(Path);
+			}
+		}
+	}
 
-		ResolvedArray.Add(MakeShared<FJsonValueObject>(EntryJson));
+	FString AggregateError;
+	TSharedPtr<const FUDBAggregate> Aggregate = FUDBAggregate::Compile(RowStruct, MetricSpecs, GroupByPaths, AggregateError);
+	if (!Aggregate.IsValid())
+	{
+		return FUDBCommandHandler::Error(
+			UDBErrorCodes::InvalidValue,
+			FString::Printf(TEXT("Invalid aggregate: %s"), *AggregateError)
+		);
 	}
 
-	// Compute unresolved tags
-	TArray<TSharedPtr<FJsonValue>> UnresolvedArray;
-	for (const FString& Tag : RequestedTags)
+	// Parse optional where expression and row-name wildcard, as for query_datatable
+	TSharedPtr<const FUDBRowFilter> WhereFilter;
+	FString WhereExpression;
+	if (Params->TryGetStringField(TEXT("where"), WhereExpression) && !WhereExpression.TrimStartAndEnd().IsEmpty())
 	{
-		if (!ResolvedTags.Contains(Tag))
+		FString WhereError;
+		WhereFilter = FUDBRowFilter::Compile(RowStruct, WhereExpression, WhereError);
+		if (!WhereFilter.IsValid())
 		{
-			UnresolvedArray.Add(MakeShared<FJsonValueString>(Tag));
+			return FUDBCommandHandler::Error(
+				UDBErrorCodes::InvalidValue,
+				FString::Printf(TEXT("Invalid where expression: %s"), *WhereError)
+			);
 		}
 	}
+	FString RowNamePattern;
+	Params->TryGetStringField(TEXT("row_name_pattern"), RowNamePattern);
 
-	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
-	Data->SetStringField(TEXT("table_path"), TablePath);
-	Data->SetStringField(TEXT("tag_field"), TagFieldName);
-	Data->SetArrayField(TEXT("resolved"), ResolvedArray);
-	Data->SetNumberField(TEXT("resolved_count"), ResolvedArray.Num());
-	Data->SetArrayField(TEXT("unresolved_tags"), UnresolvedArray);
+	// Whole-table number/bool metrics on a mirrored table: masked loops over contiguous columns
+	TArray<const FUDBRowFilter::FAccessor*> ColumnAccessors;
+	FUDBColumnStore::FScan ColumnScan;
+	if (Aggregate->GetColumnAccessors(ColumnAccessors) && FUDBColumnStore::Scan(DataTable, WhereFilter.Get(), ColumnScan))
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		const FUDBRowNameIndex::FPattern NamePattern(RowNamePattern);
+		int32 RowCount = 0;
+		for (int32 Index = 0; Index < ColumnScan.Mask.Num(); ++Index)
+		{
+			if (ColumnScan.Mask[Index] && !NamePattern.Matches(ColumnScan.RowNames[Index]))
+			{
+				ColumnScan.Mask[Index] = 0;
+			}
+			RowCount += ColumnScan.Mask[Index];
+		}
+
+		TArray<TConstArrayView<double>> MetricColumns;
+		for (const FUDBRowFilter::FAccessor* Accessor : ColumnAccessors)
+		{
+			MetricColumns.Add(Accessor != nullptr ? FUDBColumnStore::GetColumn(DataTable, *Accessor) : TConstArrayView<double>());
+		}
 
+		TSharedPtr<FJsonObject> Data = Aggregate->RunOnColumns(MetricColumns, ColumnScan.Mask);
+		Data->SetStringField(TEXT("table_path"), TablePath);
+		Data->SetNumberField(TEXT("row_count"), RowCount);
+		Data->SetNumberField(TEXT("aggregate_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		Data->SetBoolField(TEXT("columnar"), true);
+		Data->SetStringField(TEXT("etag"), ETag);
+		return FUDBCommandHandler::Success(Data);
+	}
+
+	// Otherwise reduce straight over row memory; nothing is serialized but the result
+	FMemMark ScratchMark(FMemStack::Get());
+	TArray<const void*, TMemStackAllocator<>> RowDatas;
+	RowDatas.Reserve(DataTable->GetRowMap().Num());
+	FUDBIndexLookup IndexLookup;
+	const bool bIndexUsed = ForEachMatchingRow(DataTable, WhereFilter.Get(), RowNamePattern, IndexLookup, [&RowDatas](FName, const uint8* RowData)
+	{
+		RowDatas.Add(RowData);
+	});
+
+	const double StartTime = FPlatformTime::Seconds();
+	TSharedPtr<FJsonObject> Data = Aggregate->Run(RowDatas, GetSerializeChunkCount(RowDatas.Num()));
+	Data->SetStringField(TEXT("table_path"), TablePath);
+	Data->SetNumberField(TEXT("row_count"), RowDatas.Num());
+	Data->SetNumberField(TEXT("aggregate_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	Data->SetStringField(TEXT("etag"), ETag);
+	if (bIndexUsed)
+	{
+		Data->SetObjectField(TEXT("index_used"), MakeIndexUsedJson(IndexLookup));
+	}
 	return FUDBCommandHandler::Success(Data);
 }
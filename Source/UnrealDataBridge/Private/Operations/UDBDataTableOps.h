@@ -3,6 +3,8 @@
 
 #include "CoreMinimal.h"
 #include "UDBCommandHandler.h"
+#include "UDBFieldPath.h"
+#include "UDBSerializer.h"
 
 class UDataTable;
 class UCompositeDataTable;
@@ -20,19 +22,35 @@ public:
 	static FUDBCommandResult DeleteDatatableRow(const TSharedPtr<FJsonObject>& Params);
 	static FUDBCommandResult ImportDatatableJson(const TSharedPtr<FJsonObject>& Params);
 	static FUDBCommandResult SearchDatatableContent(const TSharedPtr<FJsonObject>& Params);
+	static FUDBCommandResult SearchAllContent(const TSharedPtr<FJsonObject>& Params);
 	static FUDBCommandResult GetDataCatalog(const TSharedPtr<FJsonObject>& Params);
 	static FUDBCommandResult ResolveTags(const TSharedPtr<FJsonObject>& Params);
+	static FUDBCommandResult GetCompositeLayout(const TSharedPtr<FJsonObject>& Params);
+	static FUDBCommandResult CreateIndex(const TSharedPtr<FJsonObject>& Params);
+	static FUDBCommandResult DropIndex(const TSharedPtr<FJsonObject>& Params);
+	static FUDBCommandResult AggregateDatatable(const TSharedPtr<FJsonObject>& Params);
 
 private:
 	/** Load a DataTable by asset path, returns nullptr and sets OutError if not found */
 	static UDataTable* LoadDataTable(const FString& TablePath, FUDBCommandResult& OutError);
 
-	/** Get the parent/source tables from a UCompositeDataTable via reflection */
-	static TArray<UDataTable*> GetParentTables(const UCompositeDataTable* CompositeTable);
-
 	/** Build a JSON array of {name, path} entries for the parent tables */
 	static TArray<TSharedPtr<FJsonValue>> GetParentTablesJsonArray(const UCompositeDataTable* CompositeTable);
 
-	/** Find which source table actually owns a row (searches back-to-front for override semantics) */
-	static UDataTable* FindSourceTableForRow(const UCompositeDataTable* CompositeTable, FName RowName);
+	/** Parse an optional array param of field paths into a projection; malformed paths, and "[*]" on
+	 *  fields of StructType that are not arrays or sets, become warnings */
+	static FUDBFieldProjection ParseFieldProjection(const TSharedPtr<FJsonObject>& Params, const FString& ParamName, TArray<FString>& OutWarnings, const UStruct* StructType = nullptr);
+
+	/** Number of parallel chunks to serialize NumRows rows with (1 below the settings threshold) */
+	static int32 GetSerializeChunkCount(int32 NumRows);
+
+	/** Serialize rows as {row_name, row_data} entries, pre-serializing each row_data into OutFragments.
+	 *  Rows of DataTable are served from and added to FUDBRowCache (pass null to bypass it). */
+	static TArray<TSharedPtr<FJsonObject>> SerializeRowEntries(
+		const UDataTable* DataTable,
+		const UScriptStruct* RowStruct,
+		TConstArrayView<TPair<FName, const uint8*>> Rows,
+		const FUDBFieldProjection& FieldsProjection,
+		const FUDBSerializeOptions& Options,
+		FUDBJsonFragmentMap& OutFragments);
 };
@@ -0,0 +1,527 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBAggregate.h"
+#include "Dom/JsonValue.h"
+#include "Async/ParallelFor.h"
+
+namespace UDBAggregatePrivate
+{
+	static bool IsNumericKind(FUDBRowFilter::ELeafKind Kind)
+	{
+		return Kind == FUDBRowFilter::ELeafKind::Numeric || Kind == FUDBRowFilter::ELeafKind::Bool;
+	}
+
+	static const TCHAR* GroupKeySeparator = TEXT("\x1F");
+}
+
+bool FUDBAggregate::FMetric::IsNumericHistogram() const
+{
+	return Type == EMetric::Histogram && Accessor.Kind == FUDBRowFilter::ELeafKind::Numeric;
+}
+
+void FUDBAggregate::FMetricState::AddCategory(const FString& Category, int64 Amount)
+{
+	if (const int32* Existing = CategoryIndices.Find(Category))
+	{
+		Categories[*Existing].Value += Amount;
+	}
+	else
+	{
+		CategoryIndices.Add(Category, Categories.Num());
+		Categories.Emplace(Category, Amount);
+	}
+}
+
+TSharedPtr<const FUDBAggregate> FUDBAggregate::Compile(const UStruct* StructType, const TArray<FString>& MetricSpecs, const TArray<FString>& GroupByPaths, FString& OutError)
+{
+	using namespace UDBAggregatePrivate;
+
+	TSharedRef<FUDBAggregate> Aggregate = MakeShared<FUDBAggregate>();
+
+	for (const FString& RawSpec : MetricSpecs)
+	{
+		const FString Spec = RawSpec.TrimStartAndEnd();
+		FMetric& Metric = Aggregate->Metrics.AddDefaulted_GetRef();
+		if (Spec.Equals(TEXT("count"), ESearchCase::IgnoreCase) || Spec.Equals(TEXT("count(*)"), ESearchCase::IgnoreCase))
+		{
+			Metric.Type = EMetric::Count;
+			Metric.Name = TEXT("count");
+			continue;
+		}
+
+		int32 OpenParen = INDEX_NONE;
+		if (!Spec.FindChar(TEXT('('), OpenParen) || !Spec.EndsWith(TEXT(")")))
+		{
+			OutError = FString::Printf(TEXT("'%s' should look like count, avg(Field) or histogram(Field, 10)"), *Spec);
+			return nullptr;
+		}
+
+		const FString Op = Spec.Left(OpenParen).TrimEnd().ToLower();
+		TArray<FString> Args;
+		Spec.Mid(OpenParen + 1, Spec.Len() - OpenParen - 2).ParseIntoArray(Args, TEXT(","));
+		for (FString& Arg : Args)
+		{
+			Arg.TrimStartAndEndInline();
+		}
+
+		static const TMap<FString, EMetric> Ops = {
+			{ TEXT("count"), EMetric::CountValues },
+			{ TEXT("sum"), EMetric::Sum },
+			{ TEXT("avg"), EMetric::Avg },
+			{ TEXT("min"), EMetric::Min },
+			{ TEXT("max"), EMetric::Max },
+			{ TEXT("distinct"), EMetric::Distinct },
+			{ TEXT("histogram"), EMetric::Histogram },
+		};
+		const EMetric* Type = Ops.Find(Op);
+		if (Type == nullptr)
+		{
+			OutError = FString::Printf(TEXT("Unknown metric '%s'. Must be one of: count, sum, avg, min, max, distinct, histogram"), *Op);
+			return nullptr;
+		}
+		Metric.Type = *Type;
+
+		const int32 MaxArgs = Metric.Type == EMetric::Histogram ? 2 : 1;
+		if (Args.Num() == 0 || Args.Num() > MaxArgs || Args[0].IsEmpty())
+		{
+			OutError = FString::Printf(TEXT("'%s' takes %s"), *Spec, MaxArgs == 2 ? TEXT("a field path and an optional bucket count") : TEXT("one field path"));
+			return nullptr;
+		}
+		if (Args.Num() == 2 && (!LexTryParseString(Metric.NumBuckets, *Args[1]) || Metric.NumBuckets < 1 || Metric.NumBuckets > 1000))
+		{
+			OutError = FString::Printf(TEXT("Bucket count in '%s' must be between 1 and 1000"), *Spec);
+			return nullptr;
+		}
+
+		if (!FUDBRowFilter::ResolveAccessor(StructType, Args[0], Metric.Accessor, OutError))
+		{
+			return nullptr;
+		}
+
+		const bool bNeedsNumber = Metric.Type == EMetric::Sum || Metric.Type == EMetric::Avg || Metric.Type == EMetric::Min || Metric.Type == EMetric::Max;
+		if (bNeedsNumber && !IsNumericKind(Metric.Accessor.Kind))
+		{
+			OutError = FString::Printf(TEXT("%s needs a number or bool field; '%s' is not"), *Op, *Metric.Accessor.Path);
+			return nullptr;
+		}
+
+		Metric.Name = FString::Printf(TEXT("%s(%s)"), *Op, *Metric.Accessor.Path);
+	}
+
+	if (Aggregate->Metrics.Num() == 0)
+	{
+		FMetric& Metric = Aggregate->Metrics.AddDefaulted_GetRef();
+		Metric.Type = EMetric::Count;
+		Metric.Name = TEXT("count");
+	}
+
+	for (const FString& Path : GroupByPaths)
+	{
+		FUDBRowFilter::FAccessor& Accessor = Aggregate->GroupBy.AddDefaulted_GetRef();
+		if (!FUDBRowFilter::ResolveAccessor(StructType, Path.TrimStartAndEnd(), Accessor, OutError))
+		{
+			return nullptr;
+		}
+		if (Accessor.HasArrays() || Accessor.Kind == FUDBRowFilter::ELeafKind::TagContainer)
+		{
+			OutError = FString::Printf(TEXT("'%s' has several values per row and cannot be grouped by"), *Path);
+			return nullptr;
+		}
+	}
+
+	return Aggregate;
+}
+
+TSharedPtr<FJsonObject> FUDBAggregate::Run(TConstArrayView<const void*> Rows, int32 NumChunks) const
+{
+	const int32 NumRows = Rows.Num();
+	NumChunks = FMath::Clamp(NumChunks, 1, FMath::Max(1, NumRows));
+
+	TArray<FPartial> Partials;
+	Partials.SetNum(NumChunks);
+	const int32 RowsPerChunk = FMath::DivideAndRoundUp(FMath::Max(1, NumRows), NumChunks);
+
+	// Each chunk reduces a contiguous slice; merging in chunk order keeps groups in table order
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Begin = ChunkIndex * RowsPerChunk;
+		const int32 End = FMath::Min(Begin + RowsPerChunk, NumRows);
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			Accumulate(Rows[Index], Partials[ChunkIndex]);
+		}
+	}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	for (int32 ChunkIndex = 1; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		Merge(MoveTemp(Partials[ChunkIndex]), Partials[0]);
+	}
+	const FPartial& Result = Partials[0];
+
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	if (GroupBy.Num() == 0)
+	{
+		FGroupState Empty;
+		Empty.Metrics.SetNum(Metrics.Num());
+		Data->SetObjectField(TEXT("aggregates"), MakeGroupJson(Result.Groups.Num() > 0 ? Result.Groups[0] : Empty));
+		return Data;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> GroupsArray;
+	GroupsArray.Reserve(Result.Groups.Num());
+	for (const FGroupState& Group : Result.Groups)
+	{
+		TSharedPtr<FJsonObject> GroupJson = MakeGroupJson(Group);
+
+		TSharedPtr<FJsonObject> KeyJson = MakeShared<FJsonObject>();
+		for (int32 KeyIndex = 0; KeyIndex < GroupBy.Num(); ++KeyIndex)
+		{
+			const FUDBRowFilter::FAccessor& Accessor = GroupBy[KeyIndex];
+			const FString& Part = Group.KeyParts[KeyIndex];
+			if (Accessor.Kind == FUDBRowFilter::ELeafKind::Numeric)
+			{
+				KeyJson->SetNumberField(Accessor.Path, FCString::Atod(*Part));
+			}
+			else if (Accessor.Kind == FUDBRowFilter::ELeafKind::Bool)
+			{
+				KeyJson->SetBoolField(Accessor.Path, Part == TEXT("true"));
+			}
+			else
+			{
+				KeyJson->SetStringField(Accessor.Path, Part);
+			}
+		}
+		GroupJson->SetObjectField(TEXT("group"), KeyJson);
+
+		GroupsArray.Add(MakeShared<FJsonValueObject>(GroupJson));
+	}
+
+	Data->SetArrayField(TEXT("groups"), GroupsArray);
+	Data->SetNumberField(TEXT("group_count"), GroupsArray.Num());
+	return Data;
+}
+
+bool FUDBAggregate::GetColumnAccessors(TArray<const FUDBRowFilter::FAccessor*>& OutAccessors) const
+{
+	OutAccessors.Reset();
+	if (GroupBy.Num() > 0)
+	{
+		return false;
+	}
+
+	for (const FMetric& Metric : Metrics)
+	{
+		switch (Metric.Type)
+		{
+		case EMetric::Count:
+			OutAccessors.Add(nullptr);
+			break;
+		case EMetric::CountValues:
+			// One value per selected row
+			if (Metric.Accessor.HasArrays())
+			{
+				return false;
+			}
+			OutAccessors.Add(nullptr);
+			break;
+		case EMetric::Sum:
+		case EMetric::Avg:
+		case EMetric::Min:
+		case EMetric::Max:
+		case EMetric::Histogram:
+			if (Metric.Accessor.HasArrays() || (Metric.Type == EMetric::Histogram && !Metric.IsNumericHistogram()))
+			{
+				return false;
+			}
+			OutAccessors.Add(&Metric.Accessor);
+			break;
+		default:
+			return false;
+		}
+	}
+	return true;
+}
+
+TSharedPtr<FJsonObject> FUDBAggregate::RunOnColumns(TConstArrayView<TConstArrayView<double>> MetricColumns, TConstArrayView<uint8> Mask) const
+{
+	const int32 NumRows = Mask.Num();
+	const uint8* RESTRICT Selected = Mask.GetData();
+
+	int64 NumSelected = 0;
+	for (int32 Index = 0; Index < NumRows; ++Index)
+	{
+		NumSelected += Selected[Index];
+	}
+
+	FGroupState Group;
+	Group.RowCount = NumSelected;
+	Group.Metrics.SetNum(Metrics.Num());
+	for (int32 MetricIndex = 0; MetricIndex < Metrics.Num(); ++MetricIndex)
+	{
+		const FMetric& Metric = Metrics[MetricIndex];
+		FMetricState& State = Group.Metrics[MetricIndex];
+		State.Count = NumSelected;
+		if (Metric.Type == EMetric::Count || Metric.Type == EMetric::CountValues)
+		{
+			continue;
+		}
+
+		const double* RESTRICT Values = MetricColumns[MetricIndex].GetData();
+		check(MetricColumns[MetricIndex].Num() == NumRows);
+		if (Metric.Type == EMetric::Histogram)
+		{
+			State.Values.Reserve(NumSelected);
+			for (int32 Index = 0; Index < NumRows; ++Index)
+			{
+				if (Selected[Index])
+				{
+					State.Values.Add(Values[Index]);
+				}
+			}
+			continue;
+		}
+
+		// Branch-free masked reduction in four independent lanes
+		double Sum[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double Min[4] = { State.Min, State.Min, State.Min, State.Min };
+		double Max[4] = { State.Max, State.Max, State.Max, State.Max };
+		int32 Index = 0;
+		for (; Index + 4 <= NumRows; Index += 4)
+		{
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				const double Value = Values[Index + Lane];
+				const bool bSelected = Selected[Index + Lane] != 0;
+				Sum[Lane] += bSelected ? Value : 0.0;
+				Min[Lane] = bSelected && Value < Min[Lane] ? Value : Min[Lane];
+				Max[Lane] = bSelected && Value > Max[Lane] ? Value : Max[Lane];
+			}
+		}
+		for (; Index < NumRows; ++Index)
+		{
+			if (Selected[Index])
+			{
+				Sum[0] += Values[Index];
+				Min[0] = FMath::Min(Min[0], Values[Index]);
+				Max[0] = FMath::Max(Max[0], Values[Index]);
+			}
+		}
+
+		State.Sum = (Sum[0] + Sum[1]) + (Sum[2] + Sum[3]);
+		State.Min = FMath::Min(FMath::Min(Min[0], Min[1]), FMath::Min(Min[2], Min[3]));
+		State.Max = FMath::Max(FMath::Max(Max[0], Max[1]), FMath::Max(Max[2], Max[3]));
+	}
+
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetObjectField(TEXT("aggregates"), MakeGroupJson(Group));
+	return Data;
+}
+
+void FUDBAggregate::Accumulate(const void* RowData, FPartial& Partial) const
+{
+	TArray<FString, TInlineAllocator<4>> KeyParts;
+	for (const FUDBRowFilter::FAccessor& Accessor : GroupBy)
+	{
+		KeyParts.Add(Accessor.ReadString(Accessor.GetLeafData(RowData)));
+	}
+	const FString Key = FString::Join(KeyParts, UDBAggregatePrivate::GroupKeySeparator);
+
+	int32 GroupIndex;
+	if (const int32* Existing = Partial.GroupIndices.Find(Key))
+	{
+		GroupIndex = *Existing;
+	}
+	else
+	{
+		GroupIndex = Partial.Groups.Num();
+		Partial.GroupIndices.Add(Key, GroupIndex);
+		FGroupState& NewGroup = Partial.Groups.AddDefaulted_GetRef();
+		NewGroup.KeyParts = KeyParts;
+		NewGroup.Metrics.SetNum(Metrics.Num());
+	}
+
+	FGroupState& Group = Partial.Groups[GroupIndex];
+	++Group.RowCount;
+	for (int32 MetricIndex = 0; MetricIndex < Metrics.Num(); ++MetricIndex)
+	{
+		AccumulateMetric(Metrics[MetricIndex], RowData, Group.Metrics[MetricIndex]);
+	}
+}
+
+void FUDBAggregate::AccumulateMetric(const FMetric& Metric, const void* RowData, FMetricState& State) const
+{
+	if (Metric.Type == EMetric::Count)
+	{
+		return;
+	}
+
+	const FUDBRowFilter::FAccessor& Accessor = Metric.Accessor;
+	Accessor.ForEachLeaf(RowData, [&](const void* LeafData)
+	{
+		++State.Count;
+		switch (Metric.Type)
+		{
+		case EMetric::Sum:
+		case EMetric::Avg:
+		case EMetric::Min:
+		case EMetric::Max:
+		{
+			const double Value = Accessor.ReadNumber(LeafData);
+			State.Sum += Value;
+			State.Min = FMath::Min(State.Min, Value);
+			State.Max = FMath::Max(State.Max, Value);
+			break;
+		}
+
+		case EMetric::Distinct:
+		case EMetric::Histogram:
+			if (Metric.IsNumericHistogram())
+			{
+				State.Values.Add(Accessor.ReadNumber(LeafData));
+			}
+			else if (Accessor.Kind == FUDBRowFilter::ELeafKind::TagContainer)
+			{
+				for (const FGameplayTag& Tag : *static_cast<const FGameplayTagContainer*>(LeafData))
+				{
+					if (Metric.Type == EMetric::Distinct)
+					{
+						State.Distinct.Add(Tag.ToString());
+					}
+					else
+					{
+						State.AddCategory(Tag.ToString(), 1);
+					}
+				}
+			}
+			else if (Metric.Type == EMetric::Distinct)
+			{
+				// FString hashing and equality are case-insensitive, as the filter's string comparisons are
+				State.Distinct.Add(Accessor.ReadString(LeafData));
+			}
+			else
+			{
+				State.AddCategory(Accessor.ReadString(LeafData), 1);
+			}
+			break;
+
+		default:
+			break;
+		}
+	});
+}
+
+void FUDBAggregate::Merge(FPartial&& Source, FPartial& Target) const
+{
+	for (FGroupState& SourceGroup : Source.Groups)
+	{
+		const FString Key = FString::Join(SourceGroup.KeyParts, UDBAggregatePrivate::GroupKeySeparator);
+		const int32* Existing = Target.GroupIndices.Find(Key);
+		if (Existing == nullptr)
+		{
+			Target.GroupIndices.Add(Key, Target.Groups.Num());
+			Target.Groups.Add(MoveTemp(SourceGroup));
+			continue;
+		}
+
+		FGroupState& TargetGroup = Target.Groups[*Existing];
+		TargetGroup.RowCount += SourceGroup.RowCount;
+		for (int32 MetricIndex = 0; MetricIndex < Metrics.Num(); ++MetricIndex)
+		{
+			FMetricState& From = SourceGroup.Metrics[MetricIndex];
+			FMetricState& To = TargetGroup.Metrics[MetricIndex];
+			To.Count += From.Count;
+			To.Sum += From.Sum;
+			To.Min = FMath::Min(To.Min, From.Min);
+			To.Max = FMath::Max(To.Max, From.Max);
+			To.Distinct.Append(MoveTemp(From.Distinct));
+			To.Values.Append(MoveTemp(From.Values));
+			for (const TPair<FString, int64>& Category : From.Categories)
+			{
+				To.AddCategory(Category.Key, Category.Value);
+			}
+		}
+	}
+}
+
+TSharedPtr<FJsonObject> FUDBAggregate::MakeGroupJson(const FGroupState& Group) const
+{
+	TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+	for (int32 MetricIndex = 0; MetricIndex < Metrics.Num(); ++MetricIndex)
+	{
+		const FMetric& Metric = Metrics[MetricIndex];
+		const FMetricState& State = Group.Metrics[MetricIndex];
+
+		switch (Metric.Type)
+		{
+		case EMetric::Count:
+			Json->SetNumberField(Metric.Name, static_cast<double>(Group.RowCount));
+			break;
+		case EMetric::CountValues:
+			Json->SetNumberField(Metric.Name, static_cast<double>(State.Count));
+			break;
+		case EMetric::Sum:
+			Json->SetNumberField(Metric.Name, State.Sum);
+			break;
+		case EMetric::Avg:
+		case EMetric::Min:
+		case EMetric::Max:
+			if (State.Count == 0)
+			{
+				Json->SetField(Metric.Name, MakeShared<FJsonValueNull>());
+			}
+			else
+			{
+				Json->SetNumberField(Metric.Name, Metric.Type == EMetric::Avg ? State.Sum / static_cast<double>(State.Count)
+					: Metric.Type == EMetric::Min ? State.Min : State.Max);
+			}
+			break;
+		case EMetric::Distinct:
+			Json->SetNumberField(Metric.Name, State.Distinct.Num());
+			break;
+		case EMetric::Histogram:
+		{
+			TSharedPtr<FJsonObject> Histogram = MakeShared<FJsonObject>();
+			if (Metric.IsNumericHistogram())
+			{
+				double Min = TNumericLimits<double>::Max();
+				double Max = TNumericLimits<double>::Lowest();
+				for (double Value : State.Values)
+				{
+					Min = FMath::Min(Min, Value);
+					Max = FMath::Max(Max, Value);
+				}
+
+				// Equal-width buckets over [min, max]; the last bucket includes max
+				TArray<int64> Counts;
+				Counts.SetNumZeroed(State.Values.Num() > 0 ? Metric.NumBuckets : 0);
+				const double Width = State.Values.Num() > 0 ? (Max - Min) / Metric.NumBuckets : 0.0;
+				for (double Value : State.Values)
+				{
+					const int32 Bucket = Width > 0.0 ? FMath::Min(static_cast<int32>((Value - Min) / Width), Metric.NumBuckets - 1) : 0;
+					++Counts[Bucket];
+				}
+
+				TArray<TSharedPtr<FJsonValue>> CountsArray;
+				for (int64 Count : Counts)
+				{
+					CountsArray.Add(MakeShared<FJsonValueNumber>(static_cast<double>(Count)));
+				}
+				Histogram->SetNumberField(TEXT("min"), State.Values.Num() > 0 ? Min : 0.0);
+				Histogram->SetNumberField(TEXT("max"), State.Values.Num() > 0 ? Max : 0.0);
+				Histogram->SetNumberField(TEXT("bucket_width"), Width);
+				Histogram->SetArrayField(TEXT("counts"), CountsArray);
+			}
+			else
+			{
+				for (const TPair<FString, int64>& Category : State.Categories)
+				{
+					Histogram->SetNumberField(Category.Key, static_cast<double>(Category.Value));
+				}
+			}
+			Json->SetObjectField(Metric.Name, Histogram);
+			break;
+		}
+		}
+	}
+	return Json;
+}
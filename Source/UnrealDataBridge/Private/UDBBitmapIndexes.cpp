@@ -0,0 +1,554 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBBitmapIndexes.h"
+#include "UDBTableIndexes.h"
+#include "Engine/DataTable.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUDBBitmapIndexes, Log, All);
+
+TMap<const UDataTable*, TUniquePtr<FUDBBitmapIndexes::FTableBitmaps>> FUDBBitmapIndexes::Tables;
+
+namespace UDBBitmapIndexesPrivate
+{
+	static bool IsTagKind(FUDBRowFilter::ELeafKind Kind)
+	{
+		return Kind == FUDBRowFilter::ELeafKind::Tag || Kind == FUDBRowFilter::ELeafKind::TagContainer;
+	}
+
+	/** Lower-cased tag names, so lookups match the filter's case-insensitive tag literals */
+	static FString TagKey(const FGameplayTag& Tag)
+	{
+		return Tag.ToString().ToLower();
+	}
+
+	/** Tag equals Parent or is a child of it ("a.b" under "a"); both lower-cased */
+	static bool MatchesTagKey(const FString& Tag, const FString& Parent)
+	{
+		return Tag.StartsWith(Parent, ESearchCase::CaseSensitive)
+			&& (Tag.Len() == Parent.Len() || Tag[Parent.Len()] == TEXT('.'));
+	}
+
+	/** Node indices of the top-level conjuncts of a filter */
+	static void CollectConjuncts(const TArray<FUDBRowFilter::FNode>& Nodes, int32 NodeIndex, TArray<int32>& OutNodeIndices)
+	{
+		const FUDBRowFilter::FNode& Node = Nodes[NodeIndex];
+		if (Node.Kind == FUDBRowFilter::FNode::EKind::And)
+		{
+			CollectConjuncts(Nodes, Node.Left, OutNodeIndices);
+			CollectConjuncts(Nodes, Node.Right, OutNodeIndices);
+		}
+		else
+		{
+			OutNodeIndices.Add(NodeIndex);
+		}
+	}
+}
+
+// --- FIndex ---
+
+void FUDBBitmapIndexes::FIndex::Insert(uint32 Position, const void* RowData)
+{
+	using namespace UDBBitmapIndexesPrivate;
+
+	auto AddTo = [this, Position](double Number, FString&& String)
+	{
+		const FString Key = String.IsEmpty() ? FString::SanitizeFloat(Number) : String;
+		int32 ValueIndex;
+		if (const int32* Existing = ValueIndices.Find(Key))
+		{
+			ValueIndex = *Existing;
+		}
+		else
+		{
+			ValueIndex = Values.Num();
+			ValueIndices.Add(Key, ValueIndex);
+			FValue& Value = Values.AddDefaulted_GetRef();
+			Value.Number = Number;
+			Value.String = MoveTemp(String);
+		}
+		Values[ValueIndex].Rows.Add(Position);
+	};
+
+	const void* LeafData = Accessor.GetLeafData(RowData);
+	switch (Accessor.Kind)
+	{
+	case FUDBRowFilter::ELeafKind::TagContainer:
+		for (const FGameplayTag& Tag : *static_cast<const FGameplayTagContainer*>(LeafData))
+		{
+			AddTo(0.0, TagKey(Tag));
+		}
+		break;
+	case FUDBRowFilter::ELeafKind::Tag:
+		// An unset tag is a value too (""), so != and not keep counting such rows
+		AddTo(0.0, TagKey(*static_cast<const FGameplayTag*>(LeafData)));
+		break;
+	default:
+		AddTo(Accessor.ReadNumber(LeafData), FString());
+		break;
+	}
+}
+
+void FUDBBitmapIndexes::FIndex::Remove(uint32 Position)
+{
+	for (FValue& Value : Values)
+	{
+		Value.Rows.Remove(Position);
+	}
+}
+
+bool FUDBBitmapIndexes::FIndex::Evaluate(const FUDBRowFilter::FNode& Condition, TArrayView<uint64> Words) const
+{
+	using namespace UDBBitmapIndexesPrivate;
+	using EOp = FUDBRowFilter::EOp;
+
+	TFunction<bool(const FValue&)> Selects;
+	if (IsTagKind(Accessor.Kind))
+	{
+		const FString Literal = Condition.Literals.Num() > 0 ? TagKey(Condition.Literals[0].Tag) : FString();
+		switch (Condition.Op)
+		{
+		case EOp::Truthy:
+			// Container not empty: in any tag's bitmap
+			Selects = [](const FValue&) { return true; };
+			break;
+		case EOp::Equal:
+		case EOp::Contains:
+			Selects = [Literal](const FValue& Value) { return Value.String == Literal; };
+			break;
+		case EOp::NotEqual:
+			if (Accessor.Kind == FUDBRowFilter::ELeafKind::TagContainer)
+			{
+				return false;
+			}
+			Selects = [Literal](const FValue& Value) { return Value.String != Literal; };
+			break;
+		case EOp::Matches:
+			Selects = [Literal](const FValue& Value) { return MatchesTagKey(Value.String, Literal); };
+			break;
+		case EOp::In:
+		{
+			TSet<FString> Literals;
+			for (const FUDBRowFilter::FLiteral& Each : Condition.Literals)
+			{
+				Literals.Add(TagKey(Each.Tag));
+			}
+			Selects = [Literals = MoveTemp(Literals)](const FValue& Value) { return Literals.Contains(Value.String); };
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+	else if (Accessor.Kind == FUDBRowFilter::ELeafKind::Bool)
+	{
+		if (Condition.Op != EOp::Truthy && Condition.Op != EOp::Equal && Condition.Op != EOp::NotEqual)
+		{
+			return false;
+		}
+		const double Literal = Condition.Op == EOp::Truthy || Condition.Literals[0].bBool ? 1.0 : 0.0;
+		const bool bEqual = Condition.Op != EOp::NotEqual;
+		Selects = [Literal, bEqual](const FValue& Value) { return (Value.Number == Literal) == bEqual; };
+	}
+	else
+	{
+		// Enums: the same comparisons FUDBRowFilter applies to their underlying values
+		const EOp Op = Condition.Op;
+		TArray<double> Literals;
+		for (const FUDBRowFilter::FLiteral& Each : Condition.Literals)
+		{
+			Literals.Add(Each.Number);
+		}
+		if (Literals.Num() == 0)
+		{
+			return false;
+		}
+		switch (Op)
+		{
+		case EOp::Equal:        Selects = [L = Literals[0]](const FValue& Value) { return Value.Number == L; }; break;
+		case EOp::NotEqual:     Selects = [L = Literals[0]](const FValue& Value) { return !(Value.Number == L); }; break;
+		case EOp::Less:         Selects = [L = Literals[0]](const FValue& Value) { return Value.Number < L; }; break;
+		case EOp::LessEqual:    Selects = [L = Literals[0]](const FValue& Value) { return !(L < Value.Number); }; break;
+		case EOp::Greater:      Selects = [L = Literals[0]](const FValue& Value) { return L < Value.Number; }; break;
+		case EOp::GreaterEqual: Selects = [L = Literals[0]](const FValue& Value) { return !(Value.Number < L); }; break;
+		case EOp::In:           Selects = [Literals](const FValue& Value) { return Literals.Contains(Value.Number); }; break;
+		default:                return false;
+		}
+	}
+
+	for (const FValue& Value : Values)
+	{
+		if (Selects(Value))
+		{
+			Value.Rows.OrInto(Words);
+		}
+	}
+	return true;
+}
+
+// --- FTableBitmaps ---
+
+FUDBBitmapIndexes::FIndex* FUDBBitmapIndexes::FTableBitmaps::FindIndex(const FString& Field) const
+{
+	for (const TUniquePtr<FIndex>& Index : Indexes)
+	{
+		if (Index->Field.Equals(Field, ESearchCase::IgnoreCase))
+		{
+			return Index.Get();
+		}
+	}
+	return nullptr;
+}
+
+void FUDBBitmapIndexes::FTableBitmaps::Rebuild(const UDataTable* InTable)
+{
+	Stamp(InTable);
+	LiveRows.Reset();
+	for (const TUniquePtr<FIndex>& Index : Indexes)
+	{
+		Index->Values.Reset();
+		Index->ValueIndices.Reset();
+	}
+
+	Slots.Build(InTable, [this](FName, int32 Position, const uint8* RowData)
+	{
+		LiveRows.Add(static_cast<uint32>(Position));
+		for (const TUniquePtr<FIndex>& Index : Indexes)
+		{
+			Index->Insert(static_cast<uint32>(Position), RowData);
+		}
+	});
+}
+
+void FUDBBitmapIndexes::FTableBitmaps::RemoveRow(FName RowName)
+{
+	const int32 Position = Slots.Remove(RowName);
+	if (Position != INDEX_NONE)
+	{
+		FreePosition(static_cast<uint32>(Position));
+	}
+}
+
+void FUDBBitmapIndexes::FTableBitmaps::FreePosition(uint32 Position)
+{
+	for (const TUniquePtr<FIndex>& Index : Indexes)
+	{
+		Index->Remove(Position);
+	}
+	LiveRows.Remove(Position);
+}
+
+// --- FUDBBitmapIndexes ---
+
+bool FUDBBitmapIndexes::ResolveField(const UScriptStruct* RowStruct, const FString& Field, FUDBRowFilter::FAccessor& OutAccessor, FString& OutError)
+{
+	if (!FUDBRowFilter::ResolveAccessor(RowStruct, Field, OutAccessor, OutError))
+	{
+		return false;
+	}
+	if (OutAccessor.HasArrays())
+	{
+		OutError = FString::Printf(TEXT("'%s' goes through an array; indexes need a single-valued field"), *Field);
+		return false;
+	}
+
+	switch (OutAccessor.Kind)
+	{
+	case FUDBRowFilter::ELeafKind::Enum:
+	case FUDBRowFilter::ELeafKind::Bool:
+	case FUDBRowFilter::ELeafKind::Tag:
+	case FUDBRowFilter::ELeafKind::TagContainer:
+		return true;
+	default:
+		OutError = FString::Printf(TEXT("'%s' is not an enum, bool or gameplay tag field; use a hash or sorted index"), *Field);
+		return false;
+	}
+}
+
+bool FUDBBitmapIndexes::CreateIndex(const UDataTable* Table, const FString& Field, int32& OutNumRows, int32& OutNumKeys, FString& OutError)
+{
+	if (Table == nullptr || Table->GetRowStruct() == nullptr)
+	{
+		OutError = TEXT("DataTable has no row struct");
+		return false;
+	}
+
+	TUniquePtr<FIndex> Index = MakeUnique<FIndex>();
+	if (!ResolveField(Table->GetRowStruct(), Field, Index->Accessor, OutError))
+	{
+		return false;
+	}
+	Index->Field = Index->Accessor.Path;
+
+	FTableBitmaps* Bitmaps = &FUDBTableCacheEntry::FindOrAdd(Tables, Table);
+	Bitmaps->Indexes.RemoveAll([&Index](const TUniquePtr<FIndex>& Existing)
+	{
+		return Existing->Field.Equals(Index->Field, ESearchCase::IgnoreCase);
+	});
+
+	// Shared numbering: a stale table is rebuilt as a whole, otherwise only the new index is filled
+	FIndex& Added = *Bitmaps->Indexes.Add_GetRef(MoveTemp(Index));
+	if (!Bitmaps->IsCurrent(Table))
+	{
+		Bitmaps->Rebuild(Table);
+	}
+	else
+	{
+		for (const TPair<FName, int32>& Row : Bitmaps->Slots.RowPositions)
+		{
+			if (const uint8* RowData = Table->FindRowUnchecked(Row.Key))
+			{
+				Added.Insert(static_cast<uint32>(Row.Value), RowData);
+			}
+		}
+	}
+
+	OutNumRows = Bitmaps->Slots.RowPositions.Num();
+	OutNumKeys = Added.Values.Num();
+	if (OutNumKeys > MaxDistinctValues)
+	{
+		OutError = FString::Printf(TEXT("'%s' has %d distinct values (bitmap indexes allow %d); use a hash index"), *Added.Field, OutNumKeys, MaxDistinctValues);
+		DropIndex(Table, Added.Field);
+		return false;
+	}
+	return true;
+}
+
+bool FUDBBitmapIndexes::DropIndex(const UDataTable* Table, const FString& Field)
+{
+	FTableBitmaps* Bitmaps = FUDBTableCacheEntry::Find(Tables, Table);
+	if (Bitmaps == nullptr)
+	{
+		return false;
+	}
+
+	const int32 Removed = Bitmaps->Indexes.RemoveAll([&Field](const TUniquePtr<FIndex>& Index)
+	{
+		return Index->Field.Equals(Field, ESearchCase::IgnoreCase);
+	});
+	if (Bitmaps->Indexes.Num() == 0)
+	{
+		Tables.Remove(Table);
+	}
+	return Removed > 0;
+}
+
+TArray<FString> FUDBBitmapIndexes::GetIndexes(const UDataTable* Table)
+{
+	TArray<FString> Fields;
+	if (const FTableBitmaps* Bitmaps = FUDBTableCacheEntry::Find(Tables, Table))
+	{
+		for (const TUniquePtr<FIndex>& Index : Bitmaps->Indexes)
+		{
+			Fields.Add(Index->Field);
+		}
+	}
+	return Fields;
+}
+
+bool FUDBBitmapIndexes::FindCandidates(const UDataTable* Table, const FUDBRowFilter& Filter, FUDBIndexLookup& OutLookup)
+{
+	FTableBitmaps* Bitmaps = FUDBTableCacheEntry::Find(Tables, Table);
+	const TArray<FUDBRowFilter::FNode>& Nodes = Filter.GetNodes();
+	if (Bitmaps == nullptr || Nodes.Num() == 0 || !Refresh(Table, *Bitmaps))
+	{
+		return false;
+	}
+
+	// The whole expression when every condition is indexed, else the indexed conjuncts intersected
+	TArray<uint64> Words;
+	TSet<FString> Fields;
+	if (!EvaluateNode(*Bitmaps, Nodes, Nodes.Num() - 1, Words, Fields))
+	{
+		TArray<int32> Conjuncts;
+		UDBBitmapIndexesPrivate::CollectConjuncts(Nodes, Nodes.Num() - 1, Conjuncts);
+
+		bool bAnyIndexed = false;
+		Fields.Reset();
+		for (const int32 NodeIndex : Conjuncts)
+		{
+			TArray<uint64> ConjunctWords;
+			TSet<FString> ConjunctFields;
+			if (!EvaluateNode(*Bitmaps, Nodes, NodeIndex, ConjunctWords, ConjunctFields))
+			{
+				continue;
+			}
+
+			if (!bAnyIndexed)
+			{
+				Words = MoveTemp(ConjunctWords);
+				bAnyIndexed = true;
+			}
+			else
+			{
+				for (int32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex)
+				{
+					Words[WordIndex] &= ConjunctWords[WordIndex];
+				}
+			}
+			Fields.Append(ConjunctFields);
+		}
+		if (!bAnyIndexed)
+		{
+			return false;
+		}
+	}
+
+	OutLookup.Rows.Reset();
+	for (int32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex)
+	{
+		for (uint64 Word = Words[WordIndex]; Word != 0; Word &= Word - 1)
+		{
+			OutLookup.Rows.Add(Bitmaps->Slots.RowNames[(WordIndex << 6) + FMath::CountTrailingZeros64(Word)]);
+		}
+	}
+
+	TArray<FString> SortedFields = Fields.Array();
+	SortedFields.Sort();
+	OutLookup.Field = FString::Join(SortedFields, TEXT(", "));
+	OutLookup.Type = EUDBIndexType::Bitmap;
+	return true;
+}
+
+bool FUDBBitmapIndexes::Contains(const UDataTable* Table)
+{
+	return FUDBTableCacheEntry::Find(Tables, Table) != nullptr;
+}
+
+void FUDBBitmapIndexes::ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows)
+{
+	FTableBitmaps* Bitmaps = FUDBTableCacheEntry::Find(Tables, Table);
+	if (Bitmaps == nullptr || !Bitmaps->CanPatch(Table, StartGeneration))
+	{
+		return;
+	}
+
+	for (const FName& RowName : RemovedRows)
+	{
+		Bitmaps->RemoveRow(RowName);
+	}
+	for (const FName& RowName : ChangedRows)
+	{
+		const int32 Slot = Bitmaps->Slots.Place(Table, RowName, [Bitmaps](int32 Freed) { Bitmaps->FreePosition(static_cast<uint32>(Freed)); });
+		if (Slot == INDEX_NONE)
+		{
+			continue;
+		}
+
+		// A row updated in place drops its old bits first
+		const uint32 Position = static_cast<uint32>(Slot);
+		const uint8* RowData = Table->FindRowUnchecked(RowName);
+		Bitmaps->LiveRows.Add(Position);
+		for (const TUniquePtr<FIndex>& Index : Bitmaps->Indexes)
+		{
+			Index->Remove(Position);
+			Index->Insert(Position, RowData);
+		}
+	}
+	Bitmaps->Stamp(Table);
+}
+
+void FUDBBitmapIndexes::Reset()
+{
+	if (Tables.Num() > 0)
+	{
+		UE_LOG(LogUDBBitmapIndexes, Log, TEXT("Dropped bitmap indexes on %d tables"), Tables.Num());
+	}
+	Tables.Empty();
+}
+
+bool FUDBBitmapIndexes::Refresh(const UDataTable* Table, FTableBitmaps& Bitmaps)
+{
+	if (Bitmaps.RowStruct != Table->GetRowStruct())
+	{
+		// The table was given a different row struct; every path must resolve again
+		for (int32 IndexPos = Bitmaps.Indexes.Num() - 1; IndexPos >= 0; --IndexPos)
+		{
+			FIndex& Index = *Bitmaps.Indexes[IndexPos];
+			FString Error;
+			if (Table->GetRowStruct() == nullptr || !ResolveField(Table->GetRowStruct(), Index.Field, Index.Accessor, Error))
+			{
+				UE_LOG(LogUDBBitmapIndexes, Warning, TEXT("Dropped bitmap index on %s.%s: the field no longer exists"), *Table->GetName(), *Index.Field);
+				Bitmaps.Indexes.RemoveAt(IndexPos);
+			}
+		}
+		if (Bitmaps.Indexes.Num() == 0)
+		{
+			Tables.Remove(Table);
+			return false;
+		}
+	}
+
+	if (!Bitmaps.IsCurrent(Table))
+	{
+		Bitmaps.Rebuild(Table);
+		UE_LOG(LogUDBBitmapIndexes, Verbose, TEXT("Rebuilt %d bitmap indexes on %s"), Bitmaps.Indexes.Num(), *Table->GetName());
+	}
+	return true;
+}
+
+bool FUDBBitmapIndexes::EvaluateNode(const FTableBitmaps& Bitmaps, const TArray<FUDBRowFilter::FNode>& Nodes, int32 NodeIndex, TArray<uint64>& Words, TSet<FString>& OutFields)
+{
+	using FNode = FUDBRowFilter::FNode;
+
+	const FNode& Node = Nodes[NodeIndex];
+	const int32 NumWords = FMath::DivideAndRoundUp(Bitmaps.Slots.RowNames.Num(), 64);
+
+	switch (Node.Kind)
+	{
+	case FNode::EKind::And:
+	case FNode::EKind::Or:
+	{
+		TArray<uint64> RightWords;
+		if (!EvaluateNode(Bitmaps, Nodes, Node.Left, Words, OutFields) || !EvaluateNode(Bitmaps, Nodes, Node.Right, RightWords, OutFields))
+		{
+			return false;
+		}
+		uint64* RESTRICT Target = Words.GetData();
+		const uint64* RESTRICT Source = RightWords.GetData();
+		if (Node.Kind == FNode::EKind::And)
+		{
+			for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+			{
+				Target[WordIndex] &= Source[WordIndex];
+			}
+		}
+		else
+		{
+			for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+			{
+				Target[WordIndex] |= Source[WordIndex];
+			}
+		}
+		return true;
+	}
+
+	case FNode::EKind::Not:
+	{
+		if (!EvaluateNode(Bitmaps, Nodes, Node.Left, Words, OutFields))
+		{
+			return false;
+		}
+		// Complement within the live rows: removed positions and tail bits stay clear
+		TArray<uint64> LiveWords;
+		LiveWords.SetNumZeroed(NumWords);
+		Bitmaps.LiveRows.OrInto(LiveWords);
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			Words[WordIndex] = LiveWords[WordIndex] & ~Words[WordIndex];
+		}
+		return true;
+	}
+
+	default:
+	{
+		const FIndex* Index = Bitmaps.FindIndex(Node.Accessor.Path);
+		Words.SetNumZeroed(NumWords);
+		if (Index == nullptr || !Index->Evaluate(Node, Words))
+		{
+			return false;
+		}
+		OutFields.Add(Index->Field);
+		return true;
+	}
+	}
+}
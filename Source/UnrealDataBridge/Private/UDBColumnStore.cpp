@@ -0,0 +1,330 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBColumnStore.h"
+#include "UDBSettings.h"
+#include "Engine/DataTable.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUDBColumnStore, Log, All);
+
+TMap<const UDataTable*, TUniquePtr<FUDBColumnStore::FTableColumns>> FUDBColumnStore::Tables;
+
+namespace UDBColumnStorePrivate
+{
+	/** Mask[i] = Predicate(Values[i]); a branch-free loop the compiler vectorizes */
+	template <typename PredicateType>
+	static void FillMask(TConstArrayView<double> Values, TArray<uint8>& OutMask, PredicateType Predicate)
+	{
+		const int32 Num = Values.Num();
+		OutMask.SetNumUninitialized(Num);
+		const double* RESTRICT Source = Values.GetData();
+		uint8* RESTRICT Target = OutMask.GetData();
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Target[Index] = Predicate(Source[Index]) ? 1 : 0;
+		}
+	}
+
+	/** Mask[i] |= (Values[i] == Literal), for the further literals of an in-list */
+	static void OrEqualMask(TConstArrayView<double> Values, double Literal, TArray<uint8>& InOutMask)
+	{
+		const int32 Num = Values.Num();
+		const double* RESTRICT Source = Values.GetData();
+		uint8* RESTRICT Target = InOutMask.GetData();
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Target[Index] |= Source[Index] == Literal ? 1 : 0;
+		}
+	}
+}
+
+// --- FColumn / FTableColumns ---
+
+void FUDBColumnStore::FColumn::Fill(TConstArrayView<const uint8*> RowDatas)
+{
+	Values.SetNumUninitialized(RowDatas.Num());
+	for (int32 Index = 0; Index < RowDatas.Num(); ++Index)
+	{
+		Values[Index] = Accessor.ReadNumber(Accessor.GetLeafData(RowDatas[Index]));
+	}
+}
+
+FUDBColumnStore::FColumn& FUDBColumnStore::FTableColumns::FindOrAddColumn(const FUDBRowFilter::FAccessor& Accessor)
+{
+	TUniquePtr<FColumn>& Column = Columns.FindOrAdd(Accessor.Path);
+	if (!Column.IsValid())
+	{
+		Column = MakeUnique<FColumn>();
+		Column->Accessor = Accessor;
+		Column->Fill(RowDatas);
+	}
+	return *Column;
+}
+
+// --- FUDBColumnStore ---
+
+bool FUDBColumnStore::IsEnabled(const UDataTable* Table)
+{
+	const int32 Threshold = UUDBSettings::Get()->ColumnStoreMinRows;
+	return Threshold > 0 && Table != nullptr && Table->GetRowStruct() != nullptr && Table->GetRowMap().Num() >= Threshold;
+}
+
+bool FUDBColumnStore::IsColumnar(const FUDBRowFilter::FAccessor& Accessor)
+{
+	return !Accessor.HasArrays()
+		&& (Accessor.Kind == FUDBRowFilter::ELeafKind::Numeric
+			|| Accessor.Kind == FUDBRowFilter::ELeafKind::Enum
+			|| Accessor.Kind == FUDBRowFilter::ELeafKind::Bool);
+}
+
+bool FUDBColumnStore::Scan(const UDataTable* Table, const FUDBRowFilter* Filter, FScan& OutScan)
+{
+	const bool bHasFilter = Filter != nullptr && Filter->GetNodes().Num() > 0;
+	if (bHasFilter)
+	{
+		if (Table == nullptr || Filter->GetStruct() != Table->GetRowStruct())
+		{
+			return false;
+		}
+		for (const FUDBRowFilter::FNode& Node : Filter->GetNodes())
+		{
+			if (!CanEvaluate(Node))
+			{
+				return false;
+			}
+		}
+	}
+
+	FTableColumns* Columns = Refresh(Table);
+	if (Columns == nullptr)
+	{
+		return false;
+	}
+
+	if (bHasFilter)
+	{
+		EvaluateNode(*Columns, Filter->GetNodes(), Filter->GetNodes().Num() - 1, OutScan.Mask);
+	}
+	else
+	{
+		OutScan.Mask.Init(1, Columns->RowNames.Num());
+	}
+	OutScan.RowNames = Columns->RowNames;
+	OutScan.RowDatas = Columns->RowDatas;
+	return true;
+}
+
+TConstArrayView<double> FUDBColumnStore::GetColumn(const UDataTable* Table, const FUDBRowFilter::FAccessor& Accessor)
+{
+	FTableColumns* Columns = IsColumnar(Accessor) ? Refresh(Table) : nullptr;
+	if (Columns == nullptr)
+	{
+		return TConstArrayView<double>();
+	}
+	return Columns->FindOrAddColumn(Accessor).Values;
+}
+
+bool FUDBColumnStore::Contains(const UDataTable* Table)
+{
+	return FUDBTableCacheEntry::Find(Tables, Table) != nullptr;
+}
+
+void FUDBColumnStore::ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows)
+{
+	FTableColumns* Entry = FUDBTableCacheEntry::Find(Tables, Table);
+	if (Entry == nullptr || !Entry->CanPatch(Table, StartGeneration))
+	{
+		return;
+	}
+
+	// Added and removed rows shift table order; only in-place updates can be patched
+	FTableColumns& Columns = *Entry;
+	if (RemovedRows.Num() > 0)
+	{
+		Columns.Invalidate();
+		return;
+	}
+	for (const FName& RowName : ChangedRows)
+	{
+		const int32* RowIndex = Columns.RowIndices.Find(RowName);
+		const uint8* RowData = Table->FindRowUnchecked(RowName);
+		if (RowIndex == nullptr || RowData == nullptr)
+		{
+			Columns.Invalidate();
+			return;
+		}
+
+		Columns.RowDatas[*RowIndex] = RowData;
+		for (const TPair<FString, TUniquePtr<FColumn>>& Pair : Columns.Columns)
+		{
+			const FUDBRowFilter::FAccessor& Accessor = Pair.Value->Accessor;
+			Pair.Value->Values[*RowIndex] = Accessor.ReadNumber(Accessor.GetLeafData(RowData));
+		}
+	}
+	Columns.Stamp(Table);
+}
+
+void FUDBColumnStore::Reset()
+{
+	if (Tables.Num() > 0)
+	{
+		UE_LOG(LogUDBColumnStore, Log, TEXT("Dropped columns of %d tables"), Tables.Num());
+	}
+	Tables.Empty();
+}
+
+FUDBColumnStore::FTableColumns* FUDBColumnStore::Refresh(const UDataTable* Table)
+{
+	if (!IsEnabled(Table))
+	{
+		Tables.Remove(Table);
+		return nullptr;
+	}
+
+	FTableColumns& Columns = FUDBTableCacheEntry::FindOrAdd(Tables, Table);
+	if (Columns.IsCurrent(Table))
+	{
+		return &Columns;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	if (Columns.RowStruct != Table->GetRowStruct())
+	{
+		// Field paths were resolved against the old struct
+		Columns.Columns.Reset();
+	}
+
+	const TMap<FName, uint8*>& RowMap = Table->GetRowMap();
+	Columns.RowNames.Reset(RowMap.Num());
+	Columns.RowDatas.Reset(RowMap.Num());
+	Columns.RowIndices.Reset();
+	Columns.RowIndices.Reserve(RowMap.Num());
+	for (const TPair<FName, uint8*>& Row : RowMap)
+	{
+		Columns.RowIndices.Add(Row.Key, Columns.RowNames.Num());
+		Columns.RowNames.Add(Row.Key);
+		Columns.RowDatas.Add(Row.Value);
+	}
+	for (const TPair<FString, TUniquePtr<FColumn>>& Pair : Columns.Columns)
+	{
+		Pair.Value->Fill(Columns.RowDatas);
+	}
+	Columns.Stamp(Table);
+
+	UE_LOG(LogUDBColumnStore, Verbose, TEXT("Mirrored %s: %d rows, %d columns in %.2f ms"),
+		*Table->GetName(), Columns.RowNames.Num(), Columns.Columns.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return &Columns;
+}
+
+void FUDBColumnStore::EvaluateNode(FTableColumns& Columns, const TArray<FUDBRowFilter::FNode>& Nodes, int32 NodeIndex, TArray<uint8>& OutMask)
+{
+	using namespace UDBColumnStorePrivate;
+	using EOp = FUDBRowFilter::EOp;
+	using FNode = FUDBRowFilter::FNode;
+
+	const FNode& Node = Nodes[NodeIndex];
+	switch (Node.Kind)
+	{
+	case FNode::EKind::And:
+	case FNode::EKind::Or:
+	{
+		EvaluateNode(Columns, Nodes, Node.Left, OutMask);
+		TArray<uint8> RightMask;
+		EvaluateNode(Columns, Nodes, Node.Right, RightMask);
+
+		uint8* RESTRICT Target = OutMask.GetData();
+		const uint8* RESTRICT Source = RightMask.GetData();
+		const int32 Num = OutMask.Num();
+		if (Node.Kind == FNode::EKind::And)
+		{
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				Target[Index] &= Source[Index];
+			}
+		}
+		else
+		{
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				Target[Index] |= Source[Index];
+			}
+		}
+		return;
+	}
+
+	case FNode::EKind::Not:
+	{
+		EvaluateNode(Columns, Nodes, Node.Left, OutMask);
+		uint8* RESTRICT Target = OutMask.GetData();
+		const int32 Num = OutMask.Num();
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Target[Index] ^= 1;
+		}
+		return;
+	}
+
+	default:
+		break;
+	}
+
+	const TConstArrayView<double> Values = Columns.FindOrAddColumn(Node.Accessor).Values;
+	if (Node.Op == EOp::Truthy)
+	{
+		FillMask(Values, OutMask, [](double Value) { return Value != 0.0; });
+		return;
+	}
+
+	// Same comparisons as FUDBRowFilter's row-wise evaluation; bools are 0/1 on both sides
+	const FUDBRowFilter::FLiteral& First = Node.Literals[0];
+	const double Literal = Node.Accessor.Kind == FUDBRowFilter::ELeafKind::Bool ? (First.bBool ? 1.0 : 0.0) : First.Number;
+	switch (Node.Op)
+	{
+	case EOp::Equal:        FillMask(Values, OutMask, [Literal](double Value) { return Value == Literal; }); break;
+	case EOp::NotEqual:     FillMask(Values, OutMask, [Literal](double Value) { return !(Value == Literal); }); break;
+	case EOp::Less:         FillMask(Values, OutMask, [Literal](double Value) { return Value < Literal; }); break;
+	case EOp::LessEqual:    FillMask(Values, OutMask, [Literal](double Value) { return !(Literal < Value); }); break;
+	case EOp::Greater:      FillMask(Values, OutMask, [Literal](double Value) { return Literal < Value; }); break;
+	case EOp::GreaterEqual: FillMask(Values, OutMask, [Literal](double Value) { return !(Value < Literal); }); break;
+	default:
+		// In: one pass per literal
+		FillMask(Values, OutMask, [Literal](double Value) { return Value == Literal; });
+		for (int32 LiteralIndex = 1; LiteralIndex < Node.Literals.Num(); ++LiteralIndex)
+		{
+			OrEqualMask(Values, Node.Literals[LiteralIndex].Number, OutMask);
+		}
+		break;
+	}
+}
+
+bool FUDBColumnStore::CanEvaluate(const FUDBRowFilter::FNode& Node)
+{
+	using EOp = FUDBRowFilter::EOp;
+
+	if (Node.Kind != FUDBRowFilter::FNode::EKind::Condition)
+	{
+		return true;
+	}
+	if (!IsColumnar(Node.Accessor))
+	{
+		return false;
+	}
+
+	if (Node.Accessor.Kind == FUDBRowFilter::ELeafKind::Bool)
+	{
+		return Node.Op == EOp::Truthy || Node.Op == EOp::Equal || Node.Op == EOp::NotEqual;
+	}
+	switch (Node.Op)
+	{
+	case EOp::Equal:
+	case EOp::NotEqual:
+	case EOp::Less:
+	case EOp::LessEqual:
+	case EOp::Greater:
+	case EOp::GreaterEqual:
+	case EOp::In:
+		return true;
+	default:
+		return false;
+	}
+}
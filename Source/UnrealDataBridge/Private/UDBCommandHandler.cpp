@@ -1,5 +1,6 @@
 
 #include "UDBCommandHandler.h"
+#include "UDBMsgPack.h"
 #include "Operations/UDBDataTableOps.h"
 #include "Operations/UDBGameplayTagOps.h"
 #include "Operations/UDBDataAssetOps.h"
@@ -11,8 +12,6 @@
 #include "AssetRegistry/IAssetRegistry.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
-#include "Serialization/JsonWriter.h"
-#include "Serialization/JsonSerializer.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUDBCommandHandler, Log, All);
 
@@ -66,6 +65,10 @@ FUDBCommandResult FUDBCommandHandler::Execute(const FString& Command, const TSha
 	{
 		return FUDBDataTableOps::SearchDatatableContent(Params);
 	}
+	else if (Command == TEXT("search_all_content"))
+	{
+		return FUDBDataTableOps::SearchAllContent(Params);
+	}
 	else if (Command == TEXT("get_data_catalog"))
 	{
 		return FUDBDataTableOps::GetDataCatalog(Params);
@@ -130,6 +133,22 @@ FUDBCommandResult FUDBCommandHandler::Execute(const FString& Command, const TSha
 	{
 		return FUDBDataTableOps::ResolveTags(Params);
 	}
+	else if (Command == TEXT("get_composite_layout"))
+	{
+		return FUDBDataTableOps::GetCompositeLayout(Params);
+	}
+	else if (Command == TEXT("create_index"))
+	{
+		return FUDBDataTableOps::CreateIndex(Params);
+	}
+	else if (Command == TEXT("drop_index"))
+	{
+		return FUDBDataTableOps::DropIndex(Params);
+	}
+	else if (Command == TEXT("aggregate_datatable"))
+	{
+		return FUDBDataTableOps::AggregateDatatable(Params);
+	}
 	else if (Command == TEXT("batch"))
 	{
 		return HandleBatch(Params);
@@ -141,48 +160,78 @@ FUDBCommandResult FUDBCommandHandler::Execute(const FString& Command, const TSha
 
 FString FUDBCommandHandler::ResultToJson(const FUDBCommandResult& Result, double TimingMs)
 {
-	TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
-	ResponseJson->SetBoolField(TEXT("success"), Result.bSuccess);
+	FUDBJsonBytes Utf8;
+	ResultToUtf8(Result, TimingMs, Utf8);
 
-	if (Result.bSuccess)
+	FUTF8ToTCHAR Converter(Utf8.GetData(), Utf8.Num());
+	return FString(Converter.Length(), Converter.Get());
+}
+
+namespace UDBCommandHandlerPrivate
+{
+	/** Write the response envelope; shared by the JSON and MessagePack encoders */
+	template <typename WriterType>
+	void WriteEnvelope(WriterType& Writer, const FUDBCommandResult& Result, double TimingMs)
 	{
-		if (Result.Data.IsValid())
-		{
-			ResponseJson->SetObjectField(TEXT("data"), Result.Data);
-		}
+		Writer.WriteObjectStart();
+
+		Writer.WriteIdentifier(TEXT("success"));
+		Writer.WriteBool(Result.bSuccess);
 
-		if (Result.Warnings.Num() > 0)
+		if (Result.bSuccess)
 		{
-			TArray<TSharedPtr<FJsonValue>> WarningsArray;
-			for (const FString& Warning : Result.Warnings)
+			if (Result.Data.IsValid())
 			{
-				WarningsArray.Add(MakeShared<FJsonValueString>(Warning));
+				Writer.WriteIdentifier(TEXT("data"));
+				Writer.WriteObject(Result.Data);
 			}
-			ResponseJson->SetArrayField(TEXT("warnings"), WarningsArray);
-		}
-	}
-	else
-	{
-		TSharedRef<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
-		ErrorObj->SetStringField(TEXT("code"), Result.ErrorCode);
-		ErrorObj->SetStringField(TEXT("message"), Result.ErrorMessage);
 
-		if (Result.ErrorDetails.IsValid())
+			if (Result.Warnings.Num() > 0)
+			{
+				Writer.WriteIdentifier(TEXT("warnings"));
+				Writer.WriteArrayStart();
+				for (const FString& Warning : Result.Warnings)
+				{
+					Writer.WriteString(Warning);
+				}
+				Writer.WriteArrayEnd();
+			}
+		}
+		else
 		{
-			ErrorObj->SetObjectField(TEXT("details"), Result.ErrorDetails);
+			Writer.WriteIdentifier(TEXT("error"));
+			Writer.WriteObjectStart();
+			Writer.WriteIdentifier(TEXT("code"));
+			Writer.WriteString(Result.ErrorCode);
+			Writer.WriteIdentifier(TEXT("message"));
+			Writer.WriteString(Result.ErrorMessage);
+
+			if (Result.ErrorDetails.IsValid())
+			{
+				Writer.WriteIdentifier(TEXT("details"));
+				Writer.WriteObject(Result.ErrorDetails);
+			}
+			Writer.WriteObjectEnd();
 		}
 
-		ResponseJson->SetObjectField(TEXT("error"), ErrorObj);
-	}
+		Writer.WriteIdentifier(TEXT("timing_ms"));
+		Writer.WriteNumber(TimingMs);
 
-	ResponseJson->SetNumberField(TEXT("timing_ms"), TimingMs);
+		Writer.WriteObjectEnd();
+	}
+}
 
-	FString OutputString;
-	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
-		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutputString);
-	FJsonSerializer::Serialize(ResponseJson, Writer);
+void FUDBCommandHandler::ResultToUtf8(const FUDBCommandResult& Result, double TimingMs, FUDBJsonBytes& OutBuffer)
+{
+	FUDBJsonWriter Writer(OutBuffer, &Result.PreserializedObjects);
+	UDBCommandHandlerPrivate::WriteEnvelope(Writer, Result, TimingMs);
+}
 
-	return OutputString;
+void FUDBCommandHandler::ResultToMsgPack(const FUDBCommandResult& Result, double TimingMs, TArray<uint8>& OutBuffer)
+{
+	// Pre-serialized fragments are JSON text, so MessagePack always walks the DOM
+	FUDBMsgPackWriter Writer(OutBuffer);
+	UDBCommandHandlerPrivate::WriteEnvelope(Writer, Result, TimingMs);
 }
 
 FUDBCommandResult FUDBCommandHandler::Success(TSharedPtr<FJsonObject> Data)
@@ -193,6 +242,22 @@ FUDBCommandResult FUDBCommandHandler::Success(TSharedPtr<FJsonObject> Data)
 	return Result;
 }
 
+FUDBCommandResult FUDBCommandHandler::NotModified(const FString& ETag)
+{
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetBoolField(TEXT("not_modified"), true);
+	Data->SetStringField(TEXT("etag"), ETag);
+	return Success(Data);
+}
+
+bool FUDBCommandHandler::MatchesIfNoneMatch(const TSharedPtr<FJsonObject>& Params, const FString& ETag)
+{
+	FString IfNoneMatch;
+	return Params.IsValid()
+		&& Params->TryGetStringField(TEXT("if_none_match"), IfNoneMatch)
+		&& IfNoneMatch == ETag;
+}
+
 FUDBCommandResult FUDBCommandHandler::Error(const FString& Code, const FString& Message, TSharedPtr<FJsonObject> Details)
 {
 	FUDBCommandResult Result;
@@ -207,6 +272,12 @@ FUDBCommandResult FUDBCommandHandler::HandlePing(const TSharedPtr<FJsonObject>&
 {
 	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
 	Data->SetStringField(TEXT("message"), TEXT("pong"));
+
+	// Wire encodings the TCP server accepts; clients pick one by how they frame requests
+	TArray<TSharedPtr<FJsonValue>> Encodings;
+	Encodings.Add(MakeShared<FJsonValueString>(TEXT("json")));
+	Encodings.Add(MakeShared<FJsonValueString>(TEXT("msgpack")));
+	Data->SetArrayField(TEXT("encodings"), Encodings);
 	return Success(Data);
 }
 
@@ -229,6 +300,7 @@ FUDBCommandResult FUDBCommandHandler::HandleBatch(const TSharedPtr<FJsonObject>&
 	const double BatchStartTime = FPlatformTime::Seconds();
 
 	TArray<TSharedPtr<FJsonValue>> ResultsArray;
+	FUDBJsonFragmentMap BatchFragments;
 
 	for (int32 Index = 0; Index < CommandsArray->Num(); ++Index)
 	{
@@ -287,6 +359,7 @@ FUDBCommandResult FUDBCommandHandler::HandleBatch(const TSharedPtr<FJsonObject>&
 			if (SubResult.Data.IsValid())
 			{
 				EntryResult->SetObjectField(TEXT("data"), SubResult.Data);
+				BatchFragments.Append(SubResult.PreserializedObjects);
 			}
 		}
 		else
@@ -305,7 +378,9 @@ FUDBCommandResult FUDBCommandHandler::HandleBatch(const TSharedPtr<FJsonObject>&
 	Data->SetNumberField(TEXT("count"), ResultsArray.Num());
 	Data->SetNumberField(TEXT("total_timing_ms"), BatchElapsed);
 
-	return Success(Data);
+	FUDBCommandResult Result = Success(Data);
+	Result.PreserializedObjects = MoveTemp(BatchFragments);
+	return Result;
 }
 
 FUDBCommandResult FUDBCommandHandler::HandleGetStatus(const TSharedPtr<FJsonObject>& Params)
@@ -0,0 +1,240 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBCompositeLayout.h"
+#include "Engine/DataTable.h"
+#include "Engine/CompositeDataTable.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUDBCompositeLayout, Log, All);
+
+TMap<const UCompositeDataTable*, TUniquePtr<FUDBCompositeLayout::FEntry>> FUDBCompositeLayout::Composites;
+
+// --- FEntry ---
+
+void FUDBCompositeLayout::FEntry::Build(const UCompositeDataTable* Composite)
+{
+	Layout = FLayout();
+	Stamps.Reset();
+
+	TArray<const UCompositeDataTable*> Visiting;
+	Flatten(Composite, Visiting);
+	Layout.Parents = Stamps[0].Parents;
+
+	// Sources are in override order, so each row's chain comes out ascending
+	for (int32 SourceIndex = 0; SourceIndex < Layout.Sources.Num(); ++SourceIndex)
+	{
+		for (const TPair<FName, uint8*>& Row : Layout.Sources[SourceIndex]->GetRowMap())
+		{
+			TArray<int32, TInlineAllocator<2>>& Chain = Layout.Chains.FindOrAdd(Row.Key);
+			if (Chain.Num() == 0)
+			{
+				Layout.RowNames.Add(Row.Key);
+			}
+			Chain.Add(SourceIndex);
+		}
+	}
+}
+
+void FUDBCompositeLayout::FEntry::Flatten(const UCompositeDataTable* Composite, TArray<const UCompositeDataTable*>& Visiting)
+{
+	// A composite listing itself, directly or not, contributes nothing the second time
+	if (Visiting.Contains(Composite))
+	{
+		return;
+	}
+	Visiting.Push(Composite);
+
+	FStamp& CompositeStamp = Stamps.AddDefaulted_GetRef();
+	CompositeStamp.Stamp(Composite);
+	CompositeStamp.bComposite = true;
+	CompositeStamp.Parents = ReadParentTables(Composite);
+
+	const TArray<UDataTable*> Parents = CompositeStamp.Parents;
+	for (UDataTable* Parent : Parents)
+	{
+		if (const UCompositeDataTable* Nested = Cast<UCompositeDataTable>(Parent))
+		{
+			Flatten(Nested, Visiting);
+			continue;
+		}
+
+		// A table listed twice overrides from its last position
+		if (Layout.Sources.Remove(Parent) == 0)
+		{
+			Stamps.AddDefaulted_GetRef().Stamp(Parent);
+		}
+		Layout.Sources.Add(Parent);
+	}
+
+	Visiting.Pop();
+}
+
+bool FUDBCompositeLayout::FEntry::IsCurrent()
+{
+	for (FStamp& TableStamp : Stamps)
+	{
+		const UDataTable* Table = TableStamp.Table.Get();
+		if (Table == nullptr)
+		{
+			return false;
+		}
+		if (TableStamp.IsCurrent(Table))
+		{
+			continue;
+		}
+
+		// A composite also changes whenever a parent's rows do; only a new parent list matters here
+		if (!TableStamp.bComposite || ReadParentTables(CastChecked<UCompositeDataTable>(Table)) != TableStamp.Parents)
+		{
+			return false;
+		}
+		TableStamp.Stamp(Table);
+	}
+	return true;
+}
+
+// --- FUDBCompositeLayout ---
+
+const FUDBCompositeLayout::FLayout* FUDBCompositeLayout::Get(const UCompositeDataTable* Composite)
+{
+	if (Composite == nullptr)
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<FEntry>& Entry = Composites.FindOrAdd(Composite);
+	if (!Entry.IsValid())
+	{
+		Entry = MakeUnique<FEntry>();
+	}
+	else if (Entry->IsCurrent())
+	{
+		return &Entry->Layout;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	Entry->Build(Composite);
+	UE_LOG(LogUDBCompositeLayout, Verbose, TEXT("Mapped composite %s: %d rows from %d sources in %.2f ms"),
+		*Composite->GetName(), Entry->Layout.RowNames.Num(), Entry->Layout.Sources.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return &Entry->Layout;
+}
+
+UDataTable* FUDBCompositeLayout::FindSourceTable(const UCompositeDataTable* Composite, FName RowName)
+{
+	const FLayout* Layout = Get(Composite);
+	const TArray<int32, TInlineAllocator<2>>* Chain = Layout != nullptr ? Layout->Chains.Find(RowName) : nullptr;
+	return Chain != nullptr ? Layout->Sources[Chain->Last()] : nullptr;
+}
+
+TArray<UDataTable*> FUDBCompositeLayout::ReadParentTables(const UCompositeDataTable* Composite)
+{
+	TArray<UDataTable*> Result;
+	if (Composite == nullptr)
+	{
+		return Result;
+	}
+
+	static const FArrayProperty* ParentTablesProp = CastField<FArrayProperty>(
+		UCompositeDataTable::StaticClass()->FindPropertyByName(TEXT("ParentTables"))
+	);
+	if (ParentTablesProp == nullptr)
+	{
+		UE_LOG(LogUDBCompositeLayout, Warning, TEXT("Could not find ParentTables property on UCompositeDataTable"));
+		return Result;
+	}
+
+	FScriptArrayHelper ArrayHelper(ParentTablesProp, ParentTablesProp->ContainerPtrToValuePtr<void>(Composite));
+	const FObjectProperty* InnerProp = CastField<FObjectProperty>(ParentTablesProp->Inner);
+	if (InnerProp == nullptr)
+	{
+		return Result;
+	}
+
+	for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+	{
+		if (UDataTable* Table = Cast<UDataTable>(InnerProp->GetObjectPropertyValue(ArrayHelper.GetRawPtr(Index))))
+		{
+			Result.Add(Table);
+		}
+	}
+
+	return Result;
+}
+
+bool FUDBCompositeLayout::Contains(const UDataTable* Table)
+{
+	for (const TPair<const UCompositeDataTable*, TUniquePtr<FEntry>>& Pair : Composites)
+	{
+		if (Pair.Value->Layout.Sources.Contains(Table))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FUDBCompositeLayout::ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows)
+{
+	for (const TPair<const UCompositeDataTable*, TUniquePtr<FEntry>>& Pair : Composites)
+	{
+		FEntry& Entry = *Pair.Value;
+		FLayout& Layout = Entry.Layout;
+		const int32 SourceIndex = Layout.Sources.IndexOfByKey(Table);
+		if (SourceIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		FStamp* SourceStamp = Entry.Stamps.FindByPredicate([Table](const FStamp& TableStamp) { return TableStamp.IsFor(Table); });
+		if (SourceStamp == nullptr || !SourceStamp->CanPatch(Table, StartGeneration))
+		{
+			continue;
+		}
+
+		auto RemoveRow = [&Layout, SourceIndex](FName RowName)
+		{
+			TArray<int32, TInlineAllocator<2>>* Chain = Layout.Chains.Find(RowName);
+			if (Chain != nullptr && Chain->Remove(SourceIndex) > 0 && Chain->Num() == 0)
+			{
+				Layout.Chains.Remove(RowName);
+				Layout.RowNames.Remove(RowName);
+			}
+		};
+
+		for (const FName& RowName : RemovedRows)
+		{
+			RemoveRow(RowName);
+		}
+		for (const FName& RowName : ChangedRows)
+		{
+			if (Table->FindRowUnchecked(RowName) == nullptr)
+			{
+				RemoveRow(RowName);
+				continue;
+			}
+
+			// Updates leave ownership alone; a new row joins its chain in override order
+			TArray<int32, TInlineAllocator<2>>& Chain = Layout.Chains.FindOrAdd(RowName);
+			if (Chain.Num() == 0)
+			{
+				Layout.RowNames.Add(RowName);
+			}
+			const int32 Slot = Algo::LowerBound(Chain, SourceIndex);
+			if (Slot == Chain.Num() || Chain[Slot] != SourceIndex)
+			{
+				Chain.Insert(SourceIndex, Slot);
+			}
+		}
+		SourceStamp->Stamp(Table);
+	}
+}
+
+void FUDBCompositeLayout::Reset()
+{
+	if (Composites.Num() > 0)
+	{
+		UE_LOG(LogUDBCompositeLayout, Log, TEXT("Dropped row layouts of %d composite tables"), Composites.Num());
+	}
+	Composites.Empty();
+}
@@ -1,6 +1,8 @@
 // Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
 
 #include "UDBEditorUtils.h"
+#include "UDBTableVersions.h"
+#include "Engine/DataTable.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUDBEditorUtils, Log, All);
 
@@ -14,5 +16,11 @@ void FUDBEditorUtils::NotifyAssetModified(UObject* Asset)
 	// Broadcast PostEditChange so open editors (DataTable viewer, etc.) refresh
 	Asset->PostEditChange();
 
+	// Not every row write broadcasts OnDataTableChanged (AddRow/RemoveRow don't), so advance the table here
+	if (const UDataTable* DataTable = Cast<UDataTable>(Asset))
+	{
+		FUDBTableVersions::MarkChanged(DataTable);
+	}
+
 	UE_LOG(LogUDBEditorUtils, Verbose, TEXT("Notified editor of modified asset: %s"), *Asset->GetName());
 }
@@ -0,0 +1,256 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBFieldPath.h"
+#include "UObject/UnrealType.h"
+#include "GameplayTagContainer.h"
+#include "StructUtils/InstancedStruct.h"
+#include "UObject/SoftObjectPath.h"
+#include "Hash/CityHash.h"
+
+namespace UDBFieldPathPrivate
+{
+	/** Fields a "[*]" segment may address */
+	static bool HasElements(const FProperty* Property)
+	{
+		return Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>();
+	}
+
+	static void Validate(const UStruct* StructType, const FUDBFieldProjection& Projection, const FString& Prefix, TArray<FString>& OutErrors)
+	{
+		for (const TPair<FString, TSharedPtr<FUDBFieldProjection>>& Pair : Projection.Children)
+		{
+			const FProperty* Property = StructType->FindPropertyByName(FName(*Pair.Key));
+			if (Property == nullptr || !Pair.Value.IsValid())
+			{
+				continue;
+			}
+
+			const FString Path = Prefix.IsEmpty() ? Pair.Key : Prefix + TEXT(".") + Pair.Key;
+			if (Pair.Value->bAllElements && !HasElements(Property))
+			{
+				OutErrors.Add(FString::Printf(TEXT("'%s' is not an array or set, so '%s[*]' selects nothing"), *Path, *Path));
+				continue;
+			}
+
+			if (const UStruct* ChildStruct = FUDBCompiledProjection::GetProjectableStruct(Property))
+			{
+				Validate(ChildStruct, *Pair.Value, Pair.Value->bAllElements ? Path + TEXT("[*]") : Path, OutErrors);
+			}
+		}
+	}
+
+	static TSharedRef<const FUDBCompiledProjection> Compile(
+		const UStruct* StructType,
+		const FUDBFieldProjection& Projection,
+		const FUDBFieldProjection* AnyDepthRoot)
+	{
+		TSharedRef<FUDBCompiledProjection> Compiled = MakeShared<FUDBCompiledProjection>();
+		Compiled->Struct = StructType;
+
+		if (StructType == nullptr)
+		{
+			return Compiled;
+		}
+
+		for (TFieldIterator<FProperty> It(StructType); It; ++It)
+		{
+			const FProperty* Property = *It;
+			const FString Name = Property->GetName();
+
+			TSharedPtr<FUDBFieldProjection> Node = Projection.Children.FindRef(Name);
+			if (!Node.IsValid() && AnyDepthRoot != nullptr && AnyDepthRoot != &Projection)
+			{
+				const TSharedPtr<FUDBFieldProjection> RootNode = AnyDepthRoot->Children.FindRef(Name);
+				if (RootNode.IsValid() && RootNode->IsEmpty())
+				{
+					Node = RootNode;
+				}
+			}
+			if (!Node.IsValid() || (Node->bAllElements && !HasElements(Property)))
+			{
+				continue;
+			}
+
+			FUDBCompiledProjection::FField& Field = Compiled->Fields.AddDefaulted_GetRef();
+			Field.Property = Property;
+			Field.Name = Name;
+
+			if (!Node->IsEmpty())
+			{
+				Field.Source = Node;
+				if (const UStruct* ChildStruct = FUDBCompiledProjection::GetProjectableStruct(Property))
+				{
+					Field.Child = Compile(ChildStruct, *Node, AnyDepthRoot);
+				}
+			}
+		}
+
+		return Compiled;
+	}
+}
+
+bool FUDBFieldPath::Parse(const FString& PathString, FUDBFieldPath& OutPath, FString& OutError)
+{
+	OutPath.Segments.Reset();
+
+	TArray<FString> Parts;
+	PathString.ParseIntoArray(Parts, TEXT("."), false);
+	if (Parts.Num() == 0)
+	{
+		OutError = TEXT("Empty field path");
+		return false;
+	}
+
+	for (FString& Part : Parts)
+	{
+		Part.TrimStartAndEndInline();
+
+		FUDBFieldPathSegment Segment;
+		if (Part.EndsWith(TEXT("[*]")))
+		{
+			Segment.bAllElements = true;
+			Part.LeftChopInline(3);
+		}
+
+		if (Part.IsEmpty() || Part.Contains(TEXT("[")) || Part.Contains(TEXT("]")))
+		{
+			OutError = FString::Printf(TEXT("Malformed field path '%s'"), *PathString);
+			return false;
+		}
+
+		Segment.Name = MoveTemp(Part);
+		OutPath.Segments.Add(MoveTemp(Segment));
+	}
+
+	return true;
+}
+
+FString FUDBFieldPath::ToString() const
+{
+	FString Result;
+	for (const FUDBFieldPathSegment& Segment : Segments)
+	{
+		if (!Result.IsEmpty())
+		{
+			Result += TEXT(".");
+		}
+		Result += Segment.Name;
+		if (Segment.bAllElements)
+		{
+			Result += TEXT("[*]");
+		}
+	}
+	return Result;
+}
+
+void FUDBFieldProjection::AddPath(const FUDBFieldPath& Path)
+{
+	FUDBFieldProjection* Node = this;
+	for (int32 Index = 0; Index < Path.Segments.Num(); ++Index)
+	{
+		TSharedPtr<FUDBFieldProjection>& Child = Node->Children.FindOrAdd(Path.Segments[Index].Name);
+		if (!Child.IsValid())
+		{
+			Child = MakeShared<FUDBFieldProjection>();
+		}
+		else if (Child->IsEmpty())
+		{
+			// Already selected whole
+			return;
+		}
+		Child->bAllElements |= Path.Segments[Index].bAllElements;
+		Node = Child.Get();
+	}
+
+	// The leaf selects the whole value, dropping any narrower paths added earlier
+	Node->Children.Empty();
+}
+
+uint64 FUDBFieldProjection::GetHash() const
+{
+	// Map order is insertion order; sort so the same selection always hashes the same
+	TArray<FString> Names;
+	Children.GetKeys(Names);
+	Names.Sort([](const FString& A, const FString& B) { return A.Compare(B, ESearchCase::IgnoreCase) < 0; });
+
+	uint64 Hash = 0;
+	for (const FString& Name : Names)
+	{
+		const FString LowerName = Name.ToLower();
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(*LowerName), LowerName.Len() * sizeof(TCHAR), Hash);
+
+		const TSharedPtr<FUDBFieldProjection>& Child = Children.FindChecked(Name);
+		const uint64 ChildHash[2] = { Child.IsValid() ? Child->GetHash() : 0, Child.IsValid() && Child->bAllElements ? 1ull : 0ull };
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(ChildHash), sizeof(ChildHash), Hash);
+	}
+	return Hash;
+}
+
+void FUDBFieldProjection::Validate(const UStruct* StructType, TArray<FString>& OutErrors) const
+{
+	if (StructType != nullptr)
+	{
+		UDBFieldPathPrivate::Validate(StructType, *this, FString(), OutErrors);
+	}
+}
+
+FUDBFieldProjection FUDBFieldProjection::FromStrings(const TArray<FString>& PathStrings, TArray<FString>& OutErrors)
+{
+	FUDBFieldProjection Projection;
+	for (const FString& PathString : PathStrings)
+	{
+		FUDBFieldPath Path;
+		FString Error;
+		if (FUDBFieldPath::Parse(PathString, Path, Error))
+		{
+			Projection.AddPath(Path);
+		}
+		else
+		{
+			OutErrors.Add(Error);
+		}
+	}
+	return Projection;
+}
+
+TSharedRef<const FUDBCompiledProjection> FUDBCompiledProjection::Compile(
+	const UStruct* StructType,
+	const FUDBFieldProjection& Projection,
+	bool bMatchRootNamesAtAnyDepth)
+{
+	return UDBFieldPathPrivate::Compile(StructType, Projection, bMatchRootNamesAtAnyDepth ? &Projection : nullptr);
+}
+
+const UStruct* FUDBCompiledProjection::GetProjectableStruct(const FProperty* Property)
+{
+	if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+	{
+		Property = ArrayProp->Inner;
+	}
+	else if (const FSetProperty* SetProp = CastField<FSetProperty>(Property))
+	{
+		Property = SetProp->ElementProp;
+	}
+	else if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		Property = MapProp->ValueProp;
+	}
+
+	const FStructProperty* StructProp = CastField<FStructProperty>(Property);
+	if (StructProp == nullptr)
+	{
+		return nullptr;
+	}
+
+	// Serialized as strings / string arrays, or typed per row
+	const UScriptStruct* Struct = StructProp->Struct;
+	if (Struct == FGameplayTag::StaticStruct()
+		|| Struct == FGameplayTagContainer::StaticStruct()
+		|| Struct == TBaseStructure<FSoftObjectPath>::Get()
+		|| Struct == FInstancedStruct::StaticStruct())
+	{
+		return nullptr;
+	}
+
+	return Struct;
+}
@@ -0,0 +1,280 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBJsonWriter.h"
+#include "Dom/JsonValue.h"
+#include <charconv>
+
+FUDBJsonWriter::FUDBJsonWriter(FUDBJsonBytes& InBuffer, const FUDBJsonFragmentMap* InFragments)
+	: Buffer(InBuffer)
+	, Fragments(InFragments)
+	, StartNum(InBuffer.Num())
+{
+}
+
+void FUDBJsonWriter::WriteSeparator()
+{
+	// A value or key follows anything except an opening bracket or a key's colon
+	if (Buffer.Num() > StartNum)
+	{
+		const ANSICHAR Last = Buffer.Last();
+		if (Last != '{' && Last != '[' && Last != ':')
+		{
+			Buffer.Add(',');
+		}
+	}
+}
+
+void FUDBJsonWriter::WriteObjectStart()
+{
+	WriteSeparator();
+	Buffer.Add('{');
+}
+
+void FUDBJsonWriter::WriteObjectEnd()
+{
+	Buffer.Add('}');
+}
+
+void FUDBJsonWriter::WriteArrayStart()
+{
+	WriteSeparator();
+	Buffer.Add('[');
+}
+
+void FUDBJsonWriter::WriteArrayEnd()
+{
+	Buffer.Add(']');
+}
+
+void FUDBJsonWriter::WriteIdentifier(const FString& Identifier)
+{
+	WriteSeparator();
+	WriteQuotedString(Identifier);
+	Buffer.Add(':');
+}
+
+void FUDBJsonWriter::WriteString(const FString& Value)
+{
+	WriteSeparator();
+	WriteQuotedString(Value);
+}
+
+void FUDBJsonWriter::WriteNumber(double Value)
+{
+	WriteSeparator();
+
+	if (!FMath::IsFinite(Value))
+	{
+		// JSON has no representation for NaN/Inf
+		Buffer.Append("null", 4);
+		return;
+	}
+
+	// Shortest text that parses back to the same double: 0.1 stays "0.1", not "0.10000000000000001"
+	ANSICHAR NumberBuffer[40];
+	std::to_chars_result Result;
+	if (Value == FMath::FloorToDouble(Value) && FMath::Abs(Value) < 9007199254740992.0)
+	{
+		Result = std::to_chars(NumberBuffer, NumberBuffer + UE_ARRAY_COUNT(NumberBuffer), static_cast<int64>(Value));
+	}
+	else
+	{
+		Result = std::to_chars(NumberBuffer, NumberBuffer + UE_ARRAY_COUNT(NumberBuffer), Value);
+	}
+	Buffer.Append(NumberBuffer, static_cast<int32>(Result.ptr - NumberBuffer));
+}
+
+void FUDBJsonWriter::WriteNumberText(const FString& Text)
+{
+	WriteSeparator();
+	Buffer.Reserve(Buffer.Num() + Text.Len());
+	for (const TCHAR Char : Text)
+	{
+		Buffer.Add(static_cast<ANSICHAR>(Char));
+	}
+}
+
+void FUDBJsonWriter::WriteBool(bool bValue)
+{
+	WriteSeparator();
+	if (bValue)
+	{
+		Buffer.Append("true", 4);
+	}
+	else
+	{
+		Buffer.Append("false", 5);
+	}
+}
+
+void FUDBJsonWriter::WriteNull()
+{
+	WriteSeparator();
+	Buffer.Append("null", 4);
+}
+
+void FUDBJsonWriter::WriteRawValue(const ANSICHAR* Data, int32 Num)
+{
+	WriteSeparator();
+	Buffer.Append(Data, Num);
+}
+
+void FUDBJsonWriter::WriteValue(const TSharedPtr<FJsonValue>& Value)
+{
+	if (!Value.IsValid())
+	{
+		WriteNull();
+		return;
+	}
+
+	switch (Value->Type)
+	{
+	case EJson::String:
+		WriteString(Value->AsString());
+		break;
+
+	case EJson::Number:
+		if (Value->PreferStringRepresentation())
+		{
+			// Exact text chosen by the producer (a float's shortest digits, a parsed request number)
+			WriteNumberText(Value->AsString());
+		}
+		else
+		{
+			WriteNumber(Value->AsNumber());
+		}
+		break;
+
+	case EJson::Boolean:
+		WriteBool(Value->AsBool());
+		break;
+
+	case EJson::Array:
+		WriteArrayStart();
+		for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+		{
+			WriteValue(Element);
+		}
+		WriteArrayEnd();
+		break;
+
+	case EJson::Object:
+		WriteObject(Value->AsObject());
+		break;
+
+	default:
+		WriteNull();
+		break;
+	}
+}
+
+void FUDBJsonWriter::WriteObject(const TSharedPtr<FJsonObject>& Object)
+{
+	if (!Object.IsValid())
+	{
+		WriteNull();
+		return;
+	}
+
+	if (Fragments != nullptr)
+	{
+		if (const FUDBJsonFragment* Fragment = Fragments->Find(Object.Get()))
+		{
+			WriteRawValue(Fragment->GetData(), Fragment->Num);
+			return;
+		}
+	}
+
+	WriteObjectStart();
+	for (const auto& Pair : Object->Values)
+	{
+		WriteIdentifier(Pair.Key);
+		WriteValue(Pair.Value);
+	}
+	WriteObjectEnd();
+}
+
+FUDBJsonBytes FUDBJsonWriter::ToBytes(const TSharedPtr<FJsonObject>& Object)
+{
+	FUDBJsonBytes Bytes;
+	FUDBJsonWriter Writer(Bytes);
+	Writer.WriteObject(Object);
+	return Bytes;
+}
+
+void FUDBJsonWriter::WriteQuotedString(const FString& Value)
+{
+	static const ANSICHAR HexDigits[] = "0123456789abcdef";
+
+	Buffer.Reserve(Buffer.Num() + Value.Len() + 2);
+	Buffer.Add('"');
+
+	const TCHAR* Chars = *Value;
+	const int32 Len = Value.Len();
+	for (int32 Index = 0; Index < Len; ++Index)
+	{
+		uint32 CodePoint = static_cast<uint32>(Chars[Index]);
+
+		if (CodePoint < 0x80)
+		{
+			switch (CodePoint)
+			{
+			case '"':  Buffer.Append("\\\"", 2); break;
+			case '\\': Buffer.Append("\\\\", 2); break;
+			case '\b': Buffer.Append("\\b", 2); break;
+			case '\f': Buffer.Append("\\f", 2); break;
+			case '\n': Buffer.Append("\\n", 2); break;
+			case '\r': Buffer.Append("\\r", 2); break;
+			case '\t': Buffer.Append("\\t", 2); break;
+			default:
+				if (CodePoint < 0x20)
+				{
+					const ANSICHAR Escape[6] = { '\\', 'u', '0', '0', HexDigits[(CodePoint >> 4) & 0xF], HexDigits[CodePoint & 0xF] };
+					Buffer.Append(Escape, 6);
+				}
+				else
+				{
+					Buffer.Add(static_cast<ANSICHAR>(CodePoint));
+				}
+				break;
+			}
+			continue;
+		}
+
+		// Combine UTF-16 surrogate pairs; lone surrogates become U+FFFD
+		if (sizeof(TCHAR) == 2 && CodePoint >= 0xD800 && CodePoint <= 0xDFFF)
+		{
+			const uint32 Next = (Index + 1 < Len) ? static_cast<uint32>(Chars[Index + 1]) : 0;
+			if (CodePoint <= 0xDBFF && Next >= 0xDC00 && Next <= 0xDFFF)
+			{
+				CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Next - 0xDC00);
+				++Index;
+			}
+			else
+			{
+				CodePoint = 0xFFFD;
+			}
+		}
+
+		if (CodePoint < 0x800)
+		{
+			Buffer.Add(static_cast<ANSICHAR>(0xC0 | (CodePoint >> 6)));
+			Buffer.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			Buffer.Add(static_cast<ANSICHAR>(0xE0 | (CodePoint >> 12)));
+			Buffer.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Buffer.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+		else
+		{
+			Buffer.Add(static_cast<ANSICHAR>(0xF0 | (CodePoint >> 18)));
+			Buffer.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 12) & 0x3F)));
+			Buffer.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			Buffer.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+	}
+
+	Buffer.Add('"');
+}
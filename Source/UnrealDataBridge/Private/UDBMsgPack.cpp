@@ -0,0 +1,542 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBMsgPack.h"
+#include "Dom/JsonValue.h"
+
+FUDBMsgPackWriter::FUDBMsgPackWriter(TArray<uint8>& InBuffer)
+	: Buffer(InBuffer)
+{
+}
+
+void FUDBMsgPackWriter::NoteValue()
+{
+	if (OpenContainers.Num() > 0 && !OpenContainers.Last().bIsMap)
+	{
+		++OpenContainers.Last().Count;
+	}
+}
+
+void FUDBMsgPackWriter::WriteObjectStart()
+{
+	NoteValue();
+	OpenContainers.Add({ Buffer.Num(), 0, true });
+	Buffer.Add(0xdf);
+	AppendBigEndian(0, 4);
+}
+
+void FUDBMsgPackWriter::WriteObjectEnd()
+{
+	EndContainer(true);
+}
+
+void FUDBMsgPackWriter::WriteArrayStart()
+{
+	NoteValue();
+	OpenContainers.Add({ Buffer.Num(), 0, false });
+	Buffer.Add(0xdd);
+	AppendBigEndian(0, 4);
+}
+
+void FUDBMsgPackWriter::WriteArrayEnd()
+{
+	EndContainer(false);
+}
+
+void FUDBMsgPackWriter::EndContainer(bool bIsMap)
+{
+	check(OpenContainers.Num() > 0 && OpenContainers.Last().bIsMap == bIsMap);
+	const FOpenContainer Container = OpenContainers.Pop();
+
+	// Patch the count reserved after the map32/array32 marker
+	uint8* Header = Buffer.GetData() + Container.HeaderOffset + 1;
+	Header[0] = static_cast<uint8>(Container.Count >> 24);
+	Header[1] = static_cast<uint8>(Container.Count >> 16);
+	Header[2] = static_cast<uint8>(Container.Count >> 8);
+	Header[3] = static_cast<uint8>(Container.Count);
+}
+
+void FUDBMsgPackWriter::WriteIdentifier(const FString& Identifier)
+{
+	if (OpenContainers.Num() > 0 && OpenContainers.Last().bIsMap)
+	{
+		++OpenContainers.Last().Count;
+	}
+	EncodeString(Identifier);
+}
+
+void FUDBMsgPackWriter::WriteString(const FString& Value)
+{
+	NoteValue();
+	EncodeString(Value);
+}
+
+void FUDBMsgPackWriter::WriteNumber(double Value)
+{
+	NoteValue();
+	EncodeNumber(Value);
+}
+
+void FUDBMsgPackWriter::WriteBool(bool bValue)
+{
+	NoteValue();
+	Buffer.Add(bValue ? 0xc3 : 0xc2);
+}
+
+void FUDBMsgPackWriter::WriteNull()
+{
+	NoteValue();
+	Buffer.Add(0xc0);
+}
+
+void FUDBMsgPackWriter::WriteValue(const TSharedPtr<FJsonValue>& Value)
+{
+	NoteValue();
+	EncodeValue(Value);
+}
+
+void FUDBMsgPackWriter::WriteObject(const TSharedPtr<FJsonObject>& Object)
+{
+	NoteValue();
+	EncodeObject(Object);
+}
+
+TArray<uint8> FUDBMsgPackWriter::ToBytes(const TSharedPtr<FJsonObject>& Object)
+{
+	TArray<uint8> Bytes;
+	FUDBMsgPackWriter Writer(Bytes);
+	Writer.WriteObject(Object);
+	return Bytes;
+}
+
+void FUDBMsgPackWriter::EncodeString(const FString& Value)
+{
+	FTCHARToUTF8 Converter(*Value, Value.Len());
+	const uint32 Length = static_cast<uint32>(Converter.Length());
+
+	if (Length < 32)
+	{
+		Buffer.Add(static_cast<uint8>(0xa0 | Length));
+	}
+	else if (Length <= MAX_uint8)
+	{
+		Buffer.Add(0xd9);
+		AppendBigEndian(Length, 1);
+	}
+	else if (Length <= MAX_uint16)
+	{
+		Buffer.Add(0xda);
+		AppendBigEndian(Length, 2);
+	}
+	else
+	{
+		Buffer.Add(0xdb);
+		AppendBigEndian(Length, 4);
+	}
+
+	Buffer.Append(reinterpret_cast<const uint8*>(Converter.Get()), Length);
+}
+
+void FUDBMsgPackWriter::EncodeNumber(double Value)
+{
+	// Integral values within int64 range take the compact int encodings; everything else
+	// (fractions, NaN/Inf, huge magnitudes) is sent bit-exact as float64
+	if (Value == FMath::FloorToDouble(Value) && FMath::Abs(Value) < 9223372036854775808.0)
+	{
+		EncodeInteger(static_cast<int64>(Value));
+		return;
+	}
+
+	uint64 Bits = 0;
+	FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+	Buffer.Add(0xcb);
+	AppendBigEndian(Bits, 8);
+}
+
+void FUDBMsgPackWriter::EncodeInteger(int64 Value)
+{
+	if (Value >= 0)
+	{
+		if (Value < 128)
+		{
+			Buffer.Add(static_cast<uint8>(Value));
+		}
+		else if (Value <= MAX_uint8)
+		{
+			Buffer.Add(0xcc);
+			AppendBigEndian(static_cast<uint64>(Value), 1);
+		}
+		else if (Value <= MAX_uint16)
+		{
+			Buffer.Add(0xcd);
+			AppendBigEndian(static_cast<uint64>(Value), 2);
+		}
+		else if (Value <= MAX_uint32)
+		{
+			Buffer.Add(0xce);
+			AppendBigEndian(static_cast<uint64>(Value), 4);
+		}
+		else
+		{
+			Buffer.Add(0xcf);
+			AppendBigEndian(static_cast<uint64>(Value), 8);
+		}
+	}
+	else if (Value >= -32)
+	{
+		Buffer.Add(static_cast<uint8>(static_cast<int8>(Value)));
+	}
+	else if (Value >= MIN_int8)
+	{
+		Buffer.Add(0xd0);
+		AppendBigEndian(static_cast<uint64>(Value), 1);
+	}
+	else if (Value >= MIN_int16)
+	{
+		Buffer.Add(0xd1);
+		AppendBigEndian(static_cast<uint64>(Value), 2);
+	}
+	else if (Value >= MIN_int32)
+	{
+		Buffer.Add(0xd2);
+		AppendBigEndian(static_cast<uint64>(Value), 4);
+	}
+	else
+	{
+		Buffer.Add(0xd3);
+		AppendBigEndian(static_cast<uint64>(Value), 8);
+	}
+}
+
+void FUDBMsgPackWriter::EncodeValue(const TSharedPtr<FJsonValue>& Value)
+{
+	if (!Value.IsValid())
+	{
+		Buffer.Add(0xc0);
+		return;
+	}
+
+	switch (Value->Type)
+	{
+	case EJson::String:
+		EncodeString(Value->AsString());
+		break;
+
+	case EJson::Number:
+		EncodeNumber(Value->AsNumber());
+		break;
+
+	case EJson::Boolean:
+		Buffer.Add(Value->AsBool() ? 0xc3 : 0xc2);
+		break;
+
+	case EJson::Array:
+	{
+		const TArray<TSharedPtr<FJsonValue>>& Elements = Value->AsArray();
+		EncodeContainerHeader(static_cast<uint32>(Elements.Num()), false);
+		for (const TSharedPtr<FJsonValue>& Element : Elements)
+		{
+			EncodeValue(Element);
+		}
+		break;
+	}
+
+	case EJson::Object:
+		EncodeObject(Value->AsObject());
+		break;
+
+	default:
+		Buffer.Add(0xc0);
+		break;
+	}
+}
+
+void FUDBMsgPackWriter::EncodeObject(const TSharedPtr<FJsonObject>& Object)
+{
+	if (!Object.IsValid())
+	{
+		Buffer.Add(0xc0);
+		return;
+	}
+
+	EncodeContainerHeader(static_cast<uint32>(Object->Values.Num()), true);
+	for (const auto& Pair : Object->Values)
+	{
+		EncodeString(Pair.Key);
+		EncodeValue(Pair.Value);
+	}
+}
+
+void FUDBMsgPackWriter::EncodeContainerHeader(uint32 Count, bool bIsMap)
+{
+	if (Count < 16)
+	{
+		Buffer.Add(static_cast<uint8>((bIsMap ? 0x80 : 0x90) | Count));
+	}
+	else if (Count <= MAX_uint16)
+	{
+		Buffer.Add(bIsMap ? 0xde : 0xdc);
+		AppendBigEndian(Count, 2);
+	}
+	else
+	{
+		Buffer.Add(bIsMap ? 0xdf : 0xdd);
+		AppendBigEndian(Count, 4);
+	}
+}
+
+void FUDBMsgPackWriter::AppendBigEndian(uint64 Value, int32 NumBytes)
+{
+	for (int32 Shift = (NumBytes - 1) * 8; Shift >= 0; Shift -= 8)
+	{
+		Buffer.Add(static_cast<uint8>(Value >> Shift));
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Reader
+// ---------------------------------------------------------------------------
+
+FUDBMsgPackReader::FUDBMsgPackReader(const uint8* InData, int32 InNum)
+	: Data(InData)
+	, Num(InNum)
+{
+}
+
+bool FUDBMsgPackReader::ReadObject(const uint8* Data, int32 Num, TSharedPtr<FJsonObject>& OutObject, FString& OutError)
+{
+	FUDBMsgPackReader Reader(Data, Num);
+	TSharedPtr<FJsonValue> Root = Reader.ReadValue(0);
+
+	if (!Root.IsValid())
+	{
+		OutError = Reader.Error;
+		return false;
+	}
+	if (Reader.Offset != Num)
+	{
+		OutError = FString::Printf(TEXT("%d trailing bytes after MessagePack value"), Num - Reader.Offset);
+		return false;
+	}
+	if (Root->Type != EJson::Object)
+	{
+		OutError = TEXT("MessagePack request must be a map");
+		return false;
+	}
+
+	OutObject = Root->AsObject();
+	return true;
+}
+
+TSharedPtr<FJsonValue> FUDBMsgPackReader::Fail(const FString& Message)
+{
+	if (Error.IsEmpty())
+	{
+		Error = FString::Printf(TEXT("%s at byte %d"), *Message, Offset);
+	}
+	return nullptr;
+}
+
+bool FUDBMsgPackReader::ReadBigEndian(int32 NumBytes, uint64& OutValue)
+{
+	if (Offset + NumBytes > Num)
+	{
+		return false;
+	}
+
+	OutValue = 0;
+	for (int32 Index = 0; Index < NumBytes; ++Index)
+	{
+		OutValue = (OutValue << 8) | Data[Offset++];
+	}
+	return true;
+}
+
+bool FUDBMsgPackReader::ReadString(uint32 Length, FString& OutString)
+{
+	if (static_cast<int64>(Offset) + Length > Num)
+	{
+		return false;
+	}
+
+	FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data + Offset), static_cast<int32>(Length));
+	OutString = FString(Converter.Length(), Converter.Get());
+	Offset += static_cast<int32>(Length);
+	return true;
+}
+
+TSharedPtr<FJsonValue> FUDBMsgPackReader::ReadArray(uint32 Count, int32 Depth)
+{
+	// Every element takes at least one byte, which bounds the reservation on hostile input
+	if (Count > static_cast<uint32>(Num - Offset))
+	{
+		return Fail(TEXT("Array length exceeds payload"));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Elements;
+	Elements.Reserve(Count);
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		TSharedPtr<FJsonValue> Element = ReadValue(Depth + 1);
+		if (!Element.IsValid())
+		{
+			return nullptr;
+		}
+		Elements.Add(MoveTemp(Element));
+	}
+	return MakeShared<FJsonValueArray>(MoveTemp(Elements));
+}
+
+TSharedPtr<FJsonValue> FUDBMsgPackReader::ReadMap(uint32 Count, int32 Depth)
+{
+	if (Count > static_cast<uint32>(Num - Offset) / 2)
+	{
+		return Fail(TEXT("Map length exceeds payload"));
+	}
+
+	TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		TSharedPtr<FJsonValue> Key = ReadValue(Depth + 1);
+		if (!Key.IsValid())
+		{
+			return nullptr;
+		}
+		if (Key->Type != EJson::String)
+		{
+			return Fail(TEXT("Map keys must be strings"));
+		}
+
+		TSharedPtr<FJsonValue> Value = ReadValue(Depth + 1);
+		if (!Value.IsValid())
+		{
+			return nullptr;
+		}
+		Object->SetField(Key->AsString(), Value);
+	}
+	return MakeShared<FJsonValueObject>(Object);
+}
+
+TSharedPtr<FJsonValue> FUDBMsgPackReader::ReadValue(int32 Depth)
+{
+	if (Depth > MaxDepth)
+	{
+		return Fail(TEXT("Nesting too deep"));
+	}
+	if (Offset >= Num)
+	{
+		return Fail(TEXT("Unexpected end of payload"));
+	}
+
+	const uint8 Marker = Data[Offset++];
+	uint64 Raw = 0;
+
+	// Fixed-size families
+	if (Marker <= 0x7f)
+	{
+		return MakeShared<FJsonValueNumber>(Marker);
+	}
+	if (Marker >= 0xe0)
+	{
+		return MakeShared<FJsonValueNumber>(static_cast<int8>(Marker));
+	}
+	if ((Marker & 0xf0) == 0x80)
+	{
+		return ReadMap(Marker & 0x0f, Depth);
+	}
+	if ((Marker & 0xf0) == 0x90)
+	{
+		return ReadArray(Marker & 0x0f, Depth);
+	}
+	if ((Marker & 0xe0) == 0xa0)
+	{
+		FString String;
+		if (!ReadString(Marker & 0x1f, String))
+		{
+			return Fail(TEXT("Truncated string"));
+		}
+		return MakeShared<FJsonValueString>(String);
+	}
+
+	switch (Marker)
+	{
+	case 0xc0:
+		return MakeShared<FJsonValueNull>();
+	case 0xc2:
+		return MakeShared<FJsonValueBoolean>(false);
+	case 0xc3:
+		return MakeShared<FJsonValueBoolean>(true);
+
+	case 0xca:
+	{
+		if (!ReadBigEndian(4, Raw))
+		{
+			return Fail(TEXT("Truncated float32"));
+		}
+		const uint32 Bits = static_cast<uint32>(Raw);
+		float Value = 0.0f;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return MakeShared<FJsonValueNumber>(Value);
+	}
+	case 0xcb:
+	{
+		if (!ReadBigEndian(8, Raw))
+		{
+			return Fail(TEXT("Truncated float64"));
+		}
+		double Value = 0.0;
+		FMemory::Memcpy(&Value, &Raw, sizeof(Value));
+		return MakeShared<FJsonValueNumber>(Value);
+	}
+
+	case 0xcc: case 0xcd: case 0xce: case 0xcf:
+	{
+		const int32 Size = 1 << (Marker - 0xcc);
+		if (!ReadBigEndian(Size, Raw))
+		{
+			return Fail(TEXT("Truncated unsigned integer"));
+		}
+		return MakeShared<FJsonValueNumber>(static_cast<double>(Raw));
+	}
+	case 0xd0: case 0xd1: case 0xd2: case 0xd3:
+	{
+		const int32 Size = 1 << (Marker - 0xd0);
+		if (!ReadBigEndian(Size, Raw))
+		{
+			return Fail(TEXT("Truncated signed integer"));
+		}
+		// Sign-extend from the encoded width
+		const int32 Shift = 64 - Size * 8;
+		const int64 Value = static_cast<int64>(Raw << Shift) >> Shift;
+		return MakeShared<FJsonValueNumber>(static_cast<double>(Value));
+	}
+
+	case 0xd9: case 0xda: case 0xdb:
+	{
+		const int32 Size = 1 << (Marker - 0xd9);
+		FString String;
+		if (!ReadBigEndian(Size, Raw) || !ReadString(static_cast<uint32>(Raw), String))
+		{
+			return Fail(TEXT("Truncated string"));
+		}
+		return MakeShared<FJsonValueString>(String);
+	}
+
+	case 0xdc: case 0xdd:
+		if (!ReadBigEndian(Marker == 0xdc ? 2 : 4, Raw))
+		{
+			return Fail(TEXT("Truncated array header"));
+		}
+		return ReadArray(static_cast<uint32>(Raw), Depth);
+
+	case 0xde: case 0xdf:
+		if (!ReadBigEndian(Marker == 0xde ? 2 : 4, Raw))
+		{
+			return Fail(TEXT("Truncated map header"));
+		}
+		return ReadMap(static_cast<uint32>(Raw), Depth);
+
+	default:
+		// bin, ext and the reserved marker have no JSON equivalent
+		return Fail(FString::Printf(TEXT("Unsupported MessagePack type 0x%02x"), Marker));
+	}
+}
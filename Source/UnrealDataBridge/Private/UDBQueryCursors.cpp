@@ -0,0 +1,120 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBQueryCursors.h"
+#include "UDBTableVersions.h"
+#include "Engine/DataTable.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUDBQueryCursors, Log, All);
+
+TArray<FUDBQueryCursors::FSnapshot> FUDBQueryCursors::Snapshots;
+uint64 FUDBQueryCursors::LastSnapshotId = 0;
+uint64 FUDBQueryCursors::UseCounter = 0;
+
+namespace UDBQueryCursorsPrivate
+{
+	/** Whole-string hex number; false on anything else */
+	static bool ParseHex(const FString& Text, uint64& OutValue)
+	{
+		if (Text.IsEmpty() || Text.Len() > 16)
+		{
+			return false;
+		}
+
+		OutValue = 0;
+		for (const TCHAR Char : Text)
+		{
+			if (!FChar::IsHexDigit(Char))
+			{
+				return false;
+			}
+			OutValue = (OutValue << 4) | FParse::HexDigit(Char);
+		}
+		return true;
+	}
+}
+
+FString FUDBQueryCursors::MakeCursor(const FSnapshot& Snapshot, int32 Position)
+{
+	// Snapshot, generation, position; callers treat it as opaque
+	return FString::Printf(TEXT("%llx-%llx-%x"), Snapshot.Id, Snapshot.Generation, Position);
+}
+
+FString FUDBQueryCursors::Save(const UDataTable* Table, TArray<FName>&& OrderedRows, int32 Position)
+{
+	if (Table == nullptr || Position >= OrderedRows.Num())
+	{
+		return FString();
+	}
+
+	if (Snapshots.Num() >= MaxSnapshots)
+	{
+		int32 Oldest = 0;
+		for (int32 Index = 1; Index < Snapshots.Num(); ++Index)
+		{
+			if (Snapshots[Index].LastUsed < Snapshots[Oldest].LastUsed)
+			{
+				Oldest = Index;
+			}
+		}
+		UE_LOG(LogUDBQueryCursors, Verbose, TEXT("Dropped cursor snapshot %llx (%d rows)"), Snapshots[Oldest].Id, Snapshots[Oldest].RowNames.Num());
+		Snapshots.RemoveAtSwap(Oldest);
+	}
+
+	FSnapshot& Snapshot = Snapshots.AddDefaulted_GetRef();
+	Snapshot.Id = ++LastSnapshotId;
+	Snapshot.Table = Table;
+	Snapshot.Generation = FUDBTableVersions::GetGeneration(Table);
+	Snapshot.RowNames = MoveTemp(OrderedRows);
+	Snapshot.LastUsed = ++UseCounter;
+	return MakeCursor(Snapshot, Position);
+}
+
+FUDBQueryCursors::EReadResult FUDBQueryCursors::ReadPage(const UDataTable* Table, const FString& Cursor, int32 Limit, FPage& OutPage)
+{
+	TArray<FString> Parts;
+	uint64 Id = 0;
+	uint64 Generation = 0;
+	uint64 Position = 0;
+	if (Cursor.ParseIntoArray(Parts, TEXT("-")) != 3
+		|| !UDBQueryCursorsPrivate::ParseHex(Parts[0], Id)
+		|| !UDBQueryCursorsPrivate::ParseHex(Parts[1], Generation)
+		|| !UDBQueryCursorsPrivate::ParseHex(Parts[2], Position))
+	{
+		return EReadResult::Invalid;
+	}
+
+	FSnapshot* Snapshot = Snapshots.FindByPredicate([Id](const FSnapshot& Candidate) { return Candidate.Id == Id; });
+	if (Snapshot == nullptr)
+	{
+		// Ids are never reused, so one we handed out and no longer hold was dropped
+		return Id != 0 && Id <= LastSnapshotId ? EReadResult::Expired : EReadResult::Invalid;
+	}
+	if (Snapshot->Table.Get() != Table || Snapshot->Generation != Generation || Position > static_cast<uint64>(Snapshot->RowNames.Num()))
+	{
+		return EReadResult::Invalid;
+	}
+
+	Snapshot->LastUsed = ++UseCounter;
+
+	const int32 Total = Snapshot->RowNames.Num();
+	const int32 Start = static_cast<int32>(Position);
+	const int32 End = Start + FMath::Min(FMath::Max(Limit, 0), Total - Start);
+	OutPage.RowNames.Reset(End - Start);
+	OutPage.RowNames.Append(Snapshot->RowNames.GetData() + Start, End - Start);
+	OutPage.Position = Start;
+	OutPage.TotalCount = Total;
+	OutPage.SnapshotGeneration = Snapshot->Generation;
+	OutPage.NextCursor = End < Total ? MakeCursor(*Snapshot, End) : FString();
+	OutPage.bConsistencyBreak = FUDBTableVersions::GetGeneration(Table) != Snapshot->Generation;
+	return EReadResult::Ok;
+}
+
+void FUDBQueryCursors::Reset()
+{
+	if (Snapshots.Num() > 0)
+	{
+		UE_LOG(LogUDBQueryCursors, Log, TEXT("Dropped %d cursor snapshots"), Snapshots.Num());
+	}
+	Snapshots.Empty();
+}
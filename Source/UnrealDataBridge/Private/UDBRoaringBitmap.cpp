@@ -0,0 +1,183 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBRoaringBitmap.h"
+#include "Algo/BinarySearch.h"
+
+void FUDBRoaringBitmap::FContainer::ToBitmap()
+{
+	Words.SetNumZeroed(WordsPerContainer);
+	for (const uint16 Low : Values)
+	{
+		Words[Low >> 6] |= uint64(1) << (Low & 63);
+	}
+	Values.Empty();
+}
+
+void FUDBRoaringBitmap::FContainer::ToArray()
+{
+	Values.Reset(Cardinality);
+	for (int32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex)
+	{
+		for (uint64 Word = Words[WordIndex]; Word != 0; Word &= Word - 1)
+		{
+			Values.Add(static_cast<uint16>((WordIndex << 6) + FMath::CountTrailingZeros64(Word)));
+		}
+	}
+	Words.Empty();
+}
+
+int32 FUDBRoaringBitmap::LowerBound(uint16 Key) const
+{
+	return Algo::LowerBoundBy(Containers, Key, &FContainer::Key);
+}
+
+void FUDBRoaringBitmap::Add(uint32 Value)
+{
+	const uint16 Key = static_cast<uint16>(Value >> 16);
+	const uint16 Low = static_cast<uint16>(Value & 0xFFFF);
+
+	int32 Position = LowerBound(Key);
+	if (Position == Containers.Num() || Containers[Position].Key != Key)
+	{
+		Containers.Insert(FContainer(), Position);
+		Containers[Position].Key = Key;
+	}
+	FContainer& Container = Containers[Position];
+
+	if (Container.IsBitmap())
+	{
+		uint64& Word = Container.Words[Low >> 6];
+		const uint64 Bit = uint64(1) << (Low & 63);
+		Container.Cardinality += (Word & Bit) == 0 ? 1 : 0;
+		Word |= Bit;
+		return;
+	}
+
+	const int32 Slot = Algo::LowerBound(Container.Values, Low);
+	if (Slot < Container.Values.Num() && Container.Values[Slot] == Low)
+	{
+		return;
+	}
+	Container.Values.Insert(Low, Slot);
+	if (++Container.Cardinality > MaxArrayValues)
+	{
+		Container.ToBitmap();
+	}
+}
+
+void FUDBRoaringBitmap::Remove(uint32 Value)
+{
+	const uint16 Key = static_cast<uint16>(Value >> 16);
+	const uint16 Low = static_cast<uint16>(Value & 0xFFFF);
+
+	const int32 Position = LowerBound(Key);
+	if (Position == Containers.Num() || Containers[Position].Key != Key)
+	{
+		return;
+	}
+	FContainer& Container = Containers[Position];
+
+	if (Container.IsBitmap())
+	{
+		uint64& Word = Container.Words[Low >> 6];
+		const uint64 Bit = uint64(1) << (Low & 63);
+		if ((Word & Bit) == 0)
+		{
+			return;
+		}
+		Word &= ~Bit;
+		if (--Container.Cardinality <= MaxArrayValues)
+		{
+			Container.ToArray();
+		}
+	}
+	else
+	{
+		const int32 Slot = Algo::LowerBound(Container.Values, Low);
+		if (Slot == Container.Values.Num() || Container.Values[Slot] != Low)
+		{
+			return;
+		}
+		Container.Values.RemoveAt(Slot, 1, EAllowShrinking::No);
+		--Container.Cardinality;
+	}
+
+	if (Container.Cardinality == 0)
+	{
+		Containers.RemoveAt(Position);
+	}
+}
+
+bool FUDBRoaringBitmap::Contains(uint32 Value) const
+{
+	const uint16 Key = static_cast<uint16>(Value >> 16);
+	const uint16 Low = static_cast<uint16>(Value & 0xFFFF);
+
+	const int32 Position = LowerBound(Key);
+	if (Position == Containers.Num() || Containers[Position].Key != Key)
+	{
+		return false;
+	}
+
+	const FContainer& Container = Containers[Position];
+	if (Container.IsBitmap())
+	{
+		return (Container.Words[Low >> 6] & (uint64(1) << (Low & 63))) != 0;
+	}
+	return Algo::BinarySearch(Container.Values, Low) != INDEX_NONE;
+}
+
+int64 FUDBRoaringBitmap::Num() const
+{
+	int64 Count = 0;
+	for (const FContainer& Container : Containers)
+	{
+		Count += Container.Cardinality;
+	}
+	return Count;
+}
+
+void FUDBRoaringBitmap::OrInto(TArrayView<uint64> Words) const
+{
+	const int32 NumWords = Words.Num();
+	for (const FContainer& Container : Containers)
+	{
+		const int32 FirstWord = int32(Container.Key) * WordsPerContainer;
+		if (FirstWord >= NumWords)
+		{
+			break;
+		}
+
+		if (Container.IsBitmap())
+		{
+			const int32 Count = FMath::Min(WordsPerContainer, NumWords - FirstWord);
+			uint64* RESTRICT Target = Words.GetData() + FirstWord;
+			const uint64* RESTRICT Source = Container.Words.GetData();
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				Target[Index] |= Source[Index];
+			}
+		}
+		else
+		{
+			for (const uint16 Low : Container.Values)
+			{
+				const int32 WordIndex = FirstWord + (Low >> 6);
+				if (WordIndex < NumWords)
+				{
+					Words[WordIndex] |= uint64(1) << (Low & 63);
+				}
+			}
+		}
+	}
+}
+
+SIZE_T FUDBRoaringBitmap::GetAllocatedSize() const
+{
+	SIZE_T Size = Containers.GetAllocatedSize();
+	for (const FContainer& Container : Containers)
+	{
+		Size += Container.Values.GetAllocatedSize() + Container.Words.GetAllocatedSize();
+	}
+	return Size;
+}
@@ -0,0 +1,166 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBRowCache.h"
+#include "UDBSerializer.h"
+#include "UDBSettings.h"
+#include "Engine/DataTable.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Hash/CityHash.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUDBRowCache, Log, All);
+
+TLruCache<FUDBRowCache::FKey, FUDBRowCache::FEntry> FUDBRowCache::Entries(FUDBRowCache::MaxEntries);
+int64 FUDBRowCache::CachedBytes = 0;
+
+bool FUDBRowCache::IsEnabled()
+{
+	return UUDBSettings::Get()->RowCacheSizeMB > 0;
+}
+
+uint64 FUDBRowCache::MakeVariantKey(const FUDBFieldProjection& Projection, const FUDBSerializeOptions& Options)
+{
+	// The defaults instance is per struct, so only whether it is used matters
+	const int32 OptionBits[2] = { Options.DefaultData != nullptr ? 1 : 0, Options.FloatPrecision };
+	return CityHash64WithSeed(reinterpret_cast<const char*>(OptionBits), sizeof(OptionBits), Projection.GetHash());
+}
+
+bool FUDBRowCache::Find(const UDataTable* Table, FName RowName, uint64 VariantKey, FUDBCachedRow& OutRow)
+{
+	const FKey Key{ Table, RowName, VariantKey };
+	const FEntry* Entry = Entries.FindAndTouch(Key);
+	if (Entry == nullptr)
+	{
+		return false;
+	}
+
+	if (!Entry->IsCurrent(Table))
+	{
+		RemoveEntry(Key);
+		return false;
+	}
+
+	OutRow = Entry->Row;
+	return true;
+}
+
+namespace
+{
+	/** Node and container overhead of a DOM subtree; string contents are charged separately */
+	int64 EstimateDomOverhead(const FJsonValue& Value);
+
+	int64 EstimateDomOverhead(const FJsonObject& Object)
+	{
+		int64 Bytes = sizeof(FJsonObject) + Object.Values.GetAllocatedSize();
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object.Values)
+		{
+			if (Pair.Value.IsValid())
+			{
+				Bytes += EstimateDomOverhead(*Pair.Value);
+			}
+		}
+		return Bytes;
+	}
+
+	int64 EstimateDomOverhead(const FJsonValue& Value)
+	{
+		// Largest value node plus its shared reference controller
+		int64 Bytes = sizeof(FJsonValueObject) + 2 * sizeof(void*);
+		if (Value.Type == EJson::Object)
+		{
+			const TSharedPtr<FJsonObject>& Object = Value.AsObject();
+			if (Object.IsValid())
+			{
+				Bytes += EstimateDomOverhead(*Object) + 2 * sizeof(void*);
+			}
+		}
+		else if (Value.Type == EJson::Array)
+		{
+			const TArray<TSharedPtr<FJsonValue>>& Array = Value.AsArray();
+			Bytes += Array.GetAllocatedSize();
+			for (const TSharedPtr<FJsonValue>& Element : Array)
+			{
+				if (Element.IsValid())
+				{
+					Bytes += EstimateDomOverhead(*Element);
+				}
+			}
+		}
+		return Bytes;
+	}
+}
+
+int64 FUDBRowCache::EstimateEntryBytes(const FJsonObject& Json, const FUDBJsonFragment& Utf8)
+{
+	// Keys and string values are held as TCHARs in the DOM; every one of their characters is at
+	// least one byte of the UTF-8 form, so that bounds them without walking the strings
+	return Utf8.Num + static_cast<int64>(Utf8.Num) * sizeof(TCHAR) + EstimateDomOverhead(Json);
+}
+
+void FUDBRowCache::Add(const UDataTable* Table, FName RowName, uint64 VariantKey, const TSharedPtr<const FJsonObject>& Json, const FUDBJsonFragment& Utf8)
+{
+	if (Table == nullptr || !Json.IsValid() || !Utf8.IsValid())
+	{
+		return;
+	}
+
+	const int64 BudgetBytes = static_cast<int64>(UUDBSettings::Get()->RowCacheSizeMB) * 1024 * 1024;
+	const int64 EntryBytes = EstimateEntryBytes(*Json, Utf8);
+	if (EntryBytes > BudgetBytes)
+	{
+		return;
+	}
+
+	const FKey Key{ Table, RowName, VariantKey };
+	RemoveEntry(Key);
+
+	while (Entries.Num() > 0 && (CachedBytes + EntryBytes > BudgetBytes || Entries.Num() >= Entries.Max()))
+	{
+		EvictLeastRecent();
+	}
+
+	FEntry Entry;
+	Entry.Stamp(Table);
+	Entry.Row.Json = Json;
+	Entry.Row.Utf8 = FUDBJsonFragment(MakeShared<FUDBJsonBytes>(Utf8.GetData(), Utf8.Num));
+	Entry.ChargedBytes = EntryBytes;
+
+	CachedBytes += EntryBytes;
+	Entries.Add(Key, MoveTemp(Entry));
+}
+
+void FUDBRowCache::Reset()
+{
+	if (Entries.Num() > 0)
+	{
+		UE_LOG(LogUDBRowCache, Log, TEXT("Cleared %d cached rows (%lld bytes)"), Entries.Num(), CachedBytes);
+	}
+
+	Entries.Empty(MaxEntries);
+	CachedBytes = 0;
+}
+
+int32 FUDBRowCache::Num()
+{
+	return Entries.Num();
+}
+
+int64 FUDBRowCache::GetCachedBytes()
+{
+	return CachedBytes;
+}
+
+void FUDBRowCache::RemoveEntry(const FKey& Key)
+{
+	if (const FEntry* Existing = Entries.Find(Key))
+	{
+		CachedBytes -= Existing->ChargedBytes;
+		Entries.Remove(Key);
+	}
+}
+
+void FUDBRowCache::EvictLeastRecent()
+{
+	const FEntry Evicted = Entries.RemoveLeastRecent();
+	CachedBytes -= Evicted.ChargedBytes;
+}
@@ -0,0 +1,955 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBRowFilter.h"
+#include "UDBFieldPath.h"
+#include "UObject/UnrealType.h"
+#include "UObject/TextProperty.h"
+#include "UObject/EnumProperty.h"
+#include "StructUtils/InstancedStruct.h"
+#include <charconv>
+
+namespace UDBRowFilterPrivate
+{
+	enum class ETokenType : uint8
+	{
+		Word,
+		String,
+		Number,
+		Compare,
+		LParen,
+		RParen,
+		Comma,
+		End,
+	};
+
+	struct FToken
+	{
+		ETokenType Type = ETokenType::End;
+		FString Text;
+		double Number = 0.0;
+		FUDBRowFilter::EOp Op = FUDBRowFilter::EOp::Truthy;
+		int32 Position = 0;
+	};
+
+	static bool IsWordStart(TCHAR Char)
+	{
+		return FChar::IsAlpha(Char) || Char == TEXT('_');
+	}
+
+	static bool IsWordChar(TCHAR Char)
+	{
+		return FChar::IsAlnum(Char) || Char == TEXT('_') || Char == TEXT('.') || Char == TEXT('[') || Char == TEXT(']') || Char == TEXT('*');
+	}
+
+	static bool Tokenize(const FString& Expression, TArray<FToken>& OutTokens, FString& OutError)
+	{
+		const TCHAR* Chars = *Expression;
+		const int32 Len = Expression.Len();
+		int32 Index = 0;
+
+		while (Index < Len)
+		{
+			const TCHAR Char = Chars[Index];
+			if (FChar::IsWhitespace(Char))
+			{
+				++Index;
+				continue;
+			}
+
+			FToken Token;
+			Token.Position = Index;
+
+			if (IsWordStart(Char))
+			{
+				const int32 Start = Index;
+				while (Index < Len && IsWordChar(Chars[Index]))
+				{
+					++Index;
+				}
+				Token.Type = ETokenType::Word;
+				Token.Text = Expression.Mid(Start, Index - Start);
+			}
+			else if (FChar::IsDigit(Char) || ((Char == TEXT('-') || Char == TEXT('.')) && Index + 1 < Len && FChar::IsDigit(Chars[Index + 1])))
+			{
+				const int32 Start = Index++;
+				while (Index < Len && (FChar::IsDigit(Chars[Index]) || Chars[Index] == TEXT('.')
+					|| Chars[Index] == TEXT('e') || Chars[Index] == TEXT('E')
+					|| ((Chars[Index] == TEXT('-') || Chars[Index] == TEXT('+')) && (Chars[Index - 1] == TEXT('e') || Chars[Index - 1] == TEXT('E')))))
+				{
+					++Index;
+				}
+				Token.Type = ETokenType::Number;
+				Token.Text = Expression.Mid(Start, Index - Start);
+				if (!LexTryParseString(Token.Number, *Token.Text))
+				{
+					OutError = FString::Printf(TEXT("Malformed number '%s' at %d"), *Token.Text, Start);
+					return false;
+				}
+			}
+			else if (Char == TEXT('"') || Char == TEXT('\''))
+			{
+				const TCHAR Quote = Char;
+				++Index;
+				bool bClosed = false;
+				while (Index < Len)
+				{
+					const TCHAR Current = Chars[Index++];
+					if (Current == Quote)
+					{
+						bClosed = true;
+						break;
+					}
+					if (Current == TEXT('\\') && Index < Len)
+					{
+						Token.Text.AppendChar(Chars[Index++]);
+						continue;
+					}
+					Token.Text.AppendChar(Current);
+				}
+				if (!bClosed)
+				{
+					OutError = FString::Printf(TEXT("Unterminated string at %d"), Token.Position);
+					return false;
+				}
+				Token.Type = ETokenType::String;
+			}
+			else
+			{
+				const TCHAR Next = Index + 1 < Len ? Chars[Index + 1] : TEXT('\0');
+				int32 Width = 1;
+				switch (Char)
+				{
+				case TEXT('('): Token.Type = ETokenType::LParen; break;
+				case TEXT(')'): Token.Type = ETokenType::RParen; break;
+				case TEXT(','): Token.Type = ETokenType::Comma; break;
+				case TEXT('='):
+					Token.Type = ETokenType::Compare;
+					Token.Op = FUDBRowFilter::EOp::Equal;
+					Width = Next == TEXT('=') ? 2 : 1;
+					break;
+				case TEXT('!'):
+					if (Next == TEXT('='))
+					{
+						Token.Type = ETokenType::Compare;
+						Token.Op = FUDBRowFilter::EOp::NotEqual;
+						Width = 2;
+					}
+					else
+					{
+						Token.Type = ETokenType::Word;
+						Token.Text = TEXT("not");
+					}
+					break;
+				case TEXT('<'):
+					Token.Type = ETokenType::Compare;
+					Token.Op = Next == TEXT('=') ? FUDBRowFilter::EOp::LessEqual : FUDBRowFilter::EOp::Less;
+					Width = Next == TEXT('=') ? 2 : 1;
+					break;
+				case TEXT('>'):
+					Token.Type = ETokenType::Compare;
+					Token.Op = Next == TEXT('=') ? FUDBRowFilter::EOp::GreaterEqual : FUDBRowFilter::EOp::Greater;
+					Width = Next == TEXT('=') ? 2 : 1;
+					break;
+				case TEXT('&'):
+				case TEXT('|'):
+					if (Next != Char)
+					{
+						OutError = FString::Printf(TEXT("Unexpected '%c' at %d (use '%c%c')"), Char, Index, Char, Char);
+						return false;
+					}
+					Token.Type = ETokenType::Word;
+					Token.Text = Char == TEXT('&') ? TEXT("and") : TEXT("or");
+					Width = 2;
+					break;
+				default:
+					OutError = FString::Printf(TEXT("Unexpected '%c' at %d"), Char, Index);
+					return false;
+				}
+				Index += Width;
+			}
+
+			OutTokens.Add(MoveTemp(Token));
+		}
+
+		FToken EndToken;
+		EndToken.Position = Len;
+		OutTokens.Add(EndToken);
+		return true;
+	}
+
+	static bool IsKeyword(const FToken& Token, const TCHAR* Keyword)
+	{
+		return Token.Type == ETokenType::Word && Token.Text.Equals(Keyword, ESearchCase::IgnoreCase);
+	}
+
+	static const TCHAR* DescribeKind(FUDBRowFilter::ELeafKind Kind)
+	{
+		switch (Kind)
+		{
+		case FUDBRowFilter::ELeafKind::Numeric:      return TEXT("number");
+		case FUDBRowFilter::ELeafKind::Enum:         return TEXT("enum");
+		case FUDBRowFilter::ELeafKind::Bool:         return TEXT("bool");
+		case FUDBRowFilter::ELeafKind::String:       return TEXT("string");
+		case FUDBRowFilter::ELeafKind::Name:         return TEXT("name");
+		case FUDBRowFilter::ELeafKind::Text:         return TEXT("text");
+		case FUDBRowFilter::ELeafKind::Tag:          return TEXT("gameplay tag");
+		case FUDBRowFilter::ELeafKind::TagContainer: return TEXT("gameplay tag container");
+		}
+		return TEXT("value");
+	}
+
+	static const TCHAR* DescribeOp(FUDBRowFilter::EOp Op)
+	{
+		switch (Op)
+		{
+		case FUDBRowFilter::EOp::Truthy:       return TEXT("a bare test");
+		case FUDBRowFilter::EOp::Equal:        return TEXT("==");
+		case FUDBRowFilter::EOp::NotEqual:     return TEXT("!=");
+		case FUDBRowFilter::EOp::Less:         return TEXT("<");
+		case FUDBRowFilter::EOp::LessEqual:    return TEXT("<=");
+		case FUDBRowFilter::EOp::Greater:      return TEXT(">");
+		case FUDBRowFilter::EOp::GreaterEqual: return TEXT(">=");
+		case FUDBRowFilter::EOp::In:           return TEXT("in");
+		case FUDBRowFilter::EOp::Contains:     return TEXT("contains");
+		case FUDBRowFilter::EOp::Matches:      return TEXT("matches");
+		}
+		return TEXT("?");
+	}
+
+	static bool IsOrdering(FUDBRowFilter::EOp Op)
+	{
+		return Op == FUDBRowFilter::EOp::Less || Op == FUDBRowFilter::EOp::LessEqual
+			|| Op == FUDBRowFilter::EOp::Greater || Op == FUDBRowFilter::EOp::GreaterEqual;
+	}
+
+	static bool IsOpSupported(FUDBRowFilter::ELeafKind Kind, FUDBRowFilter::EOp Op)
+	{
+		using EOp = FUDBRowFilter::EOp;
+		switch (Kind)
+		{
+		case FUDBRowFilter::ELeafKind::Numeric:
+		case FUDBRowFilter::ELeafKind::Enum:
+			return Op == EOp::Equal || Op == EOp::NotEqual || Op == EOp::In || IsOrdering(Op);
+		case FUDBRowFilter::ELeafKind::Bool:
+			return Op == EOp::Truthy || Op == EOp::Equal || Op == EOp::NotEqual;
+		case FUDBRowFilter::ELeafKind::String:
+		case FUDBRowFilter::ELeafKind::Name:
+		case FUDBRowFilter::ELeafKind::Text:
+			return Op != EOp::Truthy;
+		case FUDBRowFilter::ELeafKind::Tag:
+			return Op == EOp::Equal || Op == EOp::NotEqual || Op == EOp::In || Op == EOp::Matches;
+		case FUDBRowFilter::ELeafKind::TagContainer:
+			return Op == EOp::Truthy || Op == EOp::Contains || Op == EOp::Matches;
+		}
+		return false;
+	}
+
+	static bool ClassifyLeaf(const FProperty* Property, FUDBRowFilter::ELeafKind& OutKind)
+	{
+		if (CastField<FBoolProperty>(Property) != nullptr)
+		{
+			OutKind = FUDBRowFilter::ELeafKind::Bool;
+		}
+		else if (CastField<FEnumProperty>(Property) != nullptr)
+		{
+			OutKind = FUDBRowFilter::ELeafKind::Enum;
+		}
+		else if (const FNumericProperty* NumericProp = CastField<FNumericProperty>(Property))
+		{
+			OutKind = NumericProp->IsEnum() ? FUDBRowFilter::ELeafKind::Enum : FUDBRowFilter::ELeafKind::Numeric;
+		}
+		else if (CastField<FStrProperty>(Property) != nullptr)
+		{
+			OutKind = FUDBRowFilter::ELeafKind::String;
+		}
+		else if (CastField<FNameProperty>(Property) != nullptr)
+		{
+			OutKind = FUDBRowFilter::ELeafKind::Name;
+		}
+		else if (CastField<FTextProperty>(Property) != nullptr)
+		{
+			OutKind = FUDBRowFilter::ELeafKind::Text;
+		}
+		else if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+		{
+			if (StructProp->Struct == FGameplayTag::StaticStruct())
+			{
+				OutKind = FUDBRowFilter::ELeafKind::Tag;
+			}
+			else if (StructProp->Struct == FGameplayTagContainer::StaticStruct())
+			{
+				OutKind = FUDBRowFilter::ELeafKind::TagContainer;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		else
+		{
+			return false;
+		}
+		return true;
+	}
+
+	static const UEnum* GetLeafEnum(const FProperty* Property)
+	{
+		if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+		{
+			return EnumProp->GetEnum();
+		}
+		if (const FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+		{
+			return ByteProp->Enum;
+		}
+		return nullptr;
+	}
+
+	template <typename T>
+	static bool CompareOrdered(const T& Value, const T& Literal, FUDBRowFilter::EOp Op)
+	{
+		switch (Op)
+		{
+		case FUDBRowFilter::EOp::Equal:        return Value == Literal;
+		case FUDBRowFilter::EOp::NotEqual:     return !(Value == Literal);
+		case FUDBRowFilter::EOp::Less:         return Value < Literal;
+		case FUDBRowFilter::EOp::LessEqual:    return !(Literal < Value);
+		case FUDBRowFilter::EOp::Greater:      return Literal < Value;
+		case FUDBRowFilter::EOp::GreaterEqual: return !(Value < Literal);
+		default:                               return false;
+		}
+	}
+
+	static bool CompareStrings(const FString& Value, const FUDBRowFilter::FNode& Node)
+	{
+		using EOp = FUDBRowFilter::EOp;
+		switch (Node.Op)
+		{
+		case EOp::In:
+			for (const FUDBRowFilter::FLiteral& Literal : Node.Literals)
+			{
+				if (Value.Equals(Literal.String, ESearchCase::IgnoreCase))
+				{
+					return true;
+				}
+			}
+			return false;
+		case EOp::Contains:
+			return Value.Contains(Node.Literals[0].String, ESearchCase::IgnoreCase);
+		case EOp::Matches:
+			return Value.MatchesWildcard(Node.Literals[0].String, ESearchCase::IgnoreCase);
+		default:
+			return CompareOrdered(Value.Compare(Node.Literals[0].String, ESearchCase::IgnoreCase), 0, Node.Op);
+		}
+	}
+}
+
+/** Recursive-descent parser producing FUDBRowFilter nodes; the root is appended last */
+class FUDBRowFilterParser
+{
+public:
+	FUDBRowFilterParser(const UStruct* InStruct, TArray<UDBRowFilterPrivate::FToken>&& InTokens, FUDBRowFilter& InFilter)
+		: Struct(InStruct)
+		, Tokens(MoveTemp(InTokens))
+		, Filter(InFilter)
+	{
+	}
+
+	bool Parse(FString& OutError)
+	{
+		const int32 Root = ParseOr();
+		if (Root != INDEX_NONE && Peek().Type != UDBRowFilterPrivate::ETokenType::End)
+		{
+			Fail(FString::Printf(TEXT("Unexpected '%s' at %d"), *Describe(Peek()), Peek().Position));
+		}
+		if (!Error.IsEmpty())
+		{
+			OutError = Error;
+			return false;
+		}
+
+		// Evaluation starts at the last node; nodes are added after their operands, so the root is last
+		check(Root == Filter.Nodes.Num() - 1);
+		return true;
+	}
+
+private:
+	using ETokenType = UDBRowFilterPrivate::ETokenType;
+	using FToken = UDBRowFilterPrivate::FToken;
+	using EOp = FUDBRowFilter::EOp;
+	using ELeafKind = FUDBRowFilter::ELeafKind;
+
+	const FToken& Peek() const { return Tokens[Cursor]; }
+	const FToken& Next() { return Tokens[FMath::Min(Cursor++, Tokens.Num() - 1)]; }
+
+	int32 Fail(const FString& Message)
+	{
+		if (Error.IsEmpty())
+		{
+			Error = Message;
+		}
+		return INDEX_NONE;
+	}
+
+	static FString Describe(const FToken& Token)
+	{
+		return Token.Type == ETokenType::End ? FString(TEXT("end of expression")) : Token.Text.IsEmpty() ? FString(TEXT("operator")) : Token.Text;
+	}
+
+	int32 AddBinary(FUDBRowFilter::FNode::EKind Kind, int32 Left, int32 Right)
+	{
+		FUDBRowFilter::FNode& Node = Filter.Nodes.AddDefaulted_GetRef();
+		Node.Kind = Kind;
+		Node.Left = Left;
+		Node.Right = Right;
+		return Filter.Nodes.Num() - 1;
+	}
+
+	int32 ParseOr()
+	{
+		int32 Left = ParseAnd();
+		while (Left != INDEX_NONE && UDBRowFilterPrivate::IsKeyword(Peek(), TEXT("or")))
+		{
+			Next();
+			const int32 Right = ParseAnd();
+			if (Right == INDEX_NONE)
+			{
+				return INDEX_NONE;
+			}
+			Left = AddBinary(FUDBRowFilter::FNode::EKind::Or, Left, Right);
+		}
+		return Left;
+	}
+
+	int32 ParseAnd()
+	{
+		int32 Left = ParseUnary();
+		while (Left != INDEX_NONE && UDBRowFilterPrivate::IsKeyword(Peek(), TEXT("and")))
+		{
+			Next();
+			const int32 Right = ParseUnary();
+			if (Right == INDEX_NONE)
+			{
+				return INDEX_NONE;
+			}
+			Left = AddBinary(FUDBRowFilter::FNode::EKind::And, Left, Right);
+		}
+		return Left;
+	}
+
+	int32 ParseUnary()
+	{
+		if (UDBRowFilterPrivate::IsKeyword(Peek(), TEXT("not")))
+		{
+			Next();
+			const int32 Operand = ParseUnary();
+			return Operand == INDEX_NONE ? INDEX_NONE : AddBinary(FUDBRowFilter::FNode::EKind::Not, Operand, INDEX_NONE);
+		}
+
+		if (Peek().Type == ETokenType::LParen)
+		{
+			Next();
+			const int32 Inner = ParseOr();
+			if (Inner == INDEX_NONE)
+			{
+				return INDEX_NONE;
+			}
+			if (Next().Type != ETokenType::RParen)
+			{
+				return Fail(FString::Printf(TEXT("Expected ')' at %d"), Tokens[Cursor - 1].Position));
+			}
+			return Inner;
+		}
+
+		return ParseCondition();
+	}
+
+	int32 ParseCondition()
+	{
+		const FToken& PathToken = Next();
+		if (PathToken.Type != ETokenType::Word)
+		{
+			return Fail(FString::Printf(TEXT("Expected a field path at %d, got '%s'"), PathToken.Position, *Describe(PathToken)));
+		}
+
+		FUDBRowFilter::FNode Node;
+		if (!ResolveAccessor(PathToken.Text, Node.Accessor))
+		{
+			return INDEX_NONE;
+		}
+
+		// Operator
+		const FToken& OpToken = Peek();
+		if (OpToken.Type == ETokenType::Compare)
+		{
+			Node.Op = OpToken.Op;
+		}
+		else if (UDBRowFilterPrivate::IsKeyword(OpToken, TEXT("in")))
+		{
+			Node.Op = EOp::In;
+		}
+		else if (UDBRowFilterPrivate::IsKeyword(OpToken, TEXT("contains")))
+		{
+			Node.Op = EOp::Contains;
+		}
+		else if (UDBRowFilterPrivate::IsKeyword(OpToken, TEXT("matches")))
+		{
+			Node.Op = EOp::Matches;
+		}
+		if (Node.Op != EOp::Truthy)
+		{
+			Next();
+		}
+
+		// "contains" on an array of scalars means "some element equals"
+		const bool bArrayLeaf = Node.Accessor.Steps.Last().Array != nullptr;
+		if (Node.Op == EOp::Contains && bArrayLeaf && Node.Accessor.Kind != ELeafKind::TagContainer)
+		{
+			Node.Op = EOp::Equal;
+		}
+
+		if (!UDBRowFilterPrivate::IsOpSupported(Node.Accessor.Kind, Node.Op))
+		{
+			return Fail(FString::Printf(TEXT("'%s' is a %s and does not support %s"),
+				*Node.Accessor.Path, UDBRowFilterPrivate::DescribeKind(Node.Accessor.Kind), UDBRowFilterPrivate::DescribeOp(Node.Op)));
+		}
+
+		// Literals
+		if (Node.Op == EOp::In)
+		{
+			if (Next().Type != ETokenType::LParen)
+			{
+				return Fail(FString::Printf(TEXT("Expected '(' after 'in' for '%s'"), *Node.Accessor.Path));
+			}
+			do
+			{
+				if (!ParseLiteral(Node.Accessor, Node.Literals.AddDefaulted_GetRef()))
+				{
+					return INDEX_NONE;
+				}
+			}
+			while (Peek().Type == ETokenType::Comma && (Next(), true));
+			if (Next().Type != ETokenType::RParen)
+			{
+				return Fail(FString::Printf(TEXT("Expected ')' to close the 'in' list for '%s'"), *Node.Accessor.Path));
+			}
+		}
+		else if (Node.Op != EOp::Truthy)
+		{
+			if (!ParseLiteral(Node.Accessor, Node.Literals.AddDefaulted_GetRef()))
+			{
+				return INDEX_NONE;
+			}
+		}
+
+		Filter.Nodes.Add(MoveTemp(Node));
+		return Filter.Nodes.Num() - 1;
+	}
+
+	bool ResolveAccessor(const FString& PathString, FUDBRowFilter::FAccessor& OutAccessor)
+	{
+		FString PathError;
+		if (!FUDBRowFilter::ResolveAccessor(Struct, PathString, OutAccessor, PathError))
+		{
+			Fail(PathError);
+			return false;
+		}
+		return true;
+	}
+
+	bool ParseLiteral(const FUDBRowFilter::FAccessor& Accessor, FUDBRowFilter::FLiteral& OutLiteral)
+	{
+		const FToken& Token = Next();
+		const bool bTextual = Token.Type == ETokenType::String || Token.Type == ETokenType::Word;
+		if (!bTextual && Token.Type != ETokenType::Number)
+		{
+			Fail(FString::Printf(TEXT("Expected a value for '%s' at %d, got '%s'"), *Accessor.Path, Token.Position, *Describe(Token)));
+			return false;
+		}
+
+		switch (Accessor.Kind)
+		{
+		case ELeafKind::Numeric:
+			if (Token.Type != ETokenType::Number)
+			{
+				Fail(FString::Printf(TEXT("'%s' is a number; '%s' is not"), *Accessor.Path, *Token.Text));
+				return false;
+			}
+			OutLiteral.Number = Token.Number;
+			return true;
+
+		case ELeafKind::Enum:
+		{
+			if (Token.Type == ETokenType::Number)
+			{
+				OutLiteral.Number = Token.Number;
+				return true;
+			}
+			const UEnum* Enum = UDBRowFilterPrivate::GetLeafEnum(Accessor.Leaf);
+			for (int32 EnumIndex = 0; Enum != nullptr && EnumIndex < Enum->NumEnums(); ++EnumIndex)
+			{
+				if (Enum->GetNameStringByIndex(EnumIndex).Equals(Token.Text, ESearchCase::IgnoreCase))
+				{
+					OutLiteral.Number = static_cast<double>(Enum->GetValueByIndex(EnumIndex));
+					OutLiteral.String = Token.Text;
+					return true;
+				}
+			}
+			Fail(FString::Printf(TEXT("'%s' is not a value of %s"), *Token.Text, Enum != nullptr ? *Enum->GetName() : TEXT("the enum")));
+			return false;
+		}
+
+		case ELeafKind::Bool:
+			if (Token.Type == ETokenType::Word && (Token.Text.Equals(TEXT("true"), ESearchCase::IgnoreCase) || Token.Text.Equals(TEXT("false"), ESearchCase::IgnoreCase)))
+			{
+				OutLiteral.bBool = Token.Text.Equals(TEXT("true"), ESearchCase::IgnoreCase);
+				return true;
+			}
+			Fail(FString::Printf(TEXT("'%s' is a bool; expected true or false"), *Accessor.Path));
+			return false;
+
+		case ELeafKind::Tag:
+		case ELeafKind::TagContainer:
+			OutLiteral.String = Token.Text;
+			OutLiteral.Tag = FGameplayTag::RequestGameplayTag(FName(*Token.Text), false);
+			if (!OutLiteral.Tag.IsValid())
+			{
+				Fail(FString::Printf(TEXT("Unknown gameplay tag '%s'"), *Token.Text));
+				return false;
+			}
+			return true;
+
+		default:
+			OutLiteral.String = Token.Text;
+			OutLiteral.Name = FName(*Token.Text);
+			return true;
+		}
+	}
+
+	const UStruct* Struct;
+	TArray<FToken> Tokens;
+	int32 Cursor = 0;
+	FUDBRowFilter& Filter;
+	FString Error;
+};
+
+bool FUDBRowFilter::ResolveAccessor(const UStruct* StructType, const FString& PathString, FAccessor& OutAccessor, FString& OutError)
+{
+	FUDBFieldPath Path;
+	if (!FUDBFieldPath::Parse(PathString, Path, OutError))
+	{
+		return false;
+	}
+
+	OutAccessor = FAccessor();
+	OutAccessor.Path = Path.ToString();
+	const UStruct* Current = StructType;
+	for (int32 Index = 0; Index < Path.Segments.Num(); ++Index)
+	{
+		const FString& Name = Path.Segments[Index].Name;
+		const FProperty* Property = Current != nullptr ? Current->FindPropertyByName(FName(*Name)) : nullptr;
+		if (Property == nullptr)
+		{
+			OutError = FString::Printf(TEXT("Unknown field '%s' in '%s'"), *Name, *PathString);
+			return false;
+		}
+
+		FAccessor::FStep& Step = OutAccessor.Steps.AddDefaulted_GetRef();
+		Step.Property = Property;
+		Step.Array = CastField<FArrayProperty>(Property);
+		if (Path.Segments[Index].bAllElements && Step.Array == nullptr)
+		{
+			OutError = FString::Printf(TEXT("'%s' is not an array in '%s'"), *Name, *PathString);
+			return false;
+		}
+		const FProperty* Value = Step.Array != nullptr ? Step.Array->Inner : Property;
+
+		if (Index == Path.Segments.Num() - 1)
+		{
+			if (!UDBRowFilterPrivate::ClassifyLeaf(Value, OutAccessor.Kind))
+			{
+				OutError = FString::Printf(TEXT("'%s' (%s) cannot be filtered on"), *PathString, *Value->GetCPPType());
+				return false;
+			}
+			OutAccessor.Leaf = Value;
+			return true;
+		}
+
+		const FStructProperty* StructProp = CastField<FStructProperty>(Value);
+		if (StructProp == nullptr || StructProp->Struct == FInstancedStruct::StaticStruct()
+			|| StructProp->Struct == FGameplayTag::StaticStruct() || StructProp->Struct == FGameplayTagContainer::StaticStruct())
+		{
+			OutError = FString::Printf(TEXT("'%s' has no sub-fields to filter on in '%s'"), *Name, *PathString);
+			return false;
+		}
+		Current = StructProp->Struct;
+	}
+
+	OutError = TEXT("Empty field path");
+	return false;
+}
+
+bool FUDBRowFilter::FAccessor::HasArrays() const
+{
+	for (const FStep& Step : Steps)
+	{
+		if (Step.Array != nullptr)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+const void* FUDBRowFilter::FAccessor::GetLeafData(const void* StructData) const
+{
+	check(!HasArrays());
+	const void* Data = StructData;
+	for (const FStep& Step : Steps)
+	{
+		Data = Step.Property->ContainerPtrToValuePtr<void>(Data);
+	}
+	return Data;
+}
+
+double FUDBRowFilter::FAccessor::ReadNumber(const void* LeafData) const
+{
+	if (Kind == ELeafKind::Bool)
+	{
+		return CastFieldChecked<FBoolProperty>(Leaf)->GetPropertyValue(LeafData) ? 1.0 : 0.0;
+	}
+	if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Leaf))
+	{
+		return static_cast<double>(EnumProp->GetUnderlyingProperty()->GetSignedIntPropertyValue(LeafData));
+	}
+	const FNumericProperty* NumericProp = CastFieldChecked<FNumericProperty>(Leaf);
+	return NumericProp->IsFloatingPoint()
+		? NumericProp->GetFloatingPointPropertyValue(LeafData)
+		: static_cast<double>(NumericProp->GetSignedIntPropertyValue(LeafData));
+}
+
+FString FUDBRowFilter::FAccessor::ReadString(const void* LeafData) const
+{
+	switch (Kind)
+	{
+	case ELeafKind::String: return *static_cast<const FString*>(LeafData);
+	case ELeafKind::Name:   return static_cast<const FName*>(LeafData)->ToString();
+	case ELeafKind::Text:   return static_cast<const FText*>(LeafData)->ToString();
+	case ELeafKind::Tag:    return static_cast<const FGameplayTag*>(LeafData)->ToString();
+	case ELeafKind::TagContainer: return static_cast<const FGameplayTagContainer*>(LeafData)->ToStringSimple();
+	case ELeafKind::Bool:   return ReadNumber(LeafData) != 0.0 ? TEXT("true") : TEXT("false");
+	case ELeafKind::Enum:
+		if (const UEnum* Enum = UDBRowFilterPrivate::GetLeafEnum(Leaf))
+		{
+			return Enum->GetNameStringByValue(static_cast<int64>(ReadNumber(LeafData)));
+		}
+		return LexToString(static_cast<int64>(ReadNumber(LeafData)));
+	default:
+		break;
+	}
+
+	// Shortest text that reads back as the same value; "%f" would merge values past six decimals
+	const FNumericProperty* NumericProp = CastFieldChecked<FNumericProperty>(Leaf);
+	if (!NumericProp->IsFloatingPoint())
+	{
+		return NumericProp->GetNumericPropertyValueToString(LeafData);
+	}
+	ANSICHAR Digits[40];
+	const std::to_chars_result Result = NumericProp->IsA<FFloatProperty>()
+		? std::to_chars(Digits, Digits + UE_ARRAY_COUNT(Digits), *static_cast<const float*>(LeafData))
+		: std::to_chars(Digits, Digits + UE_ARRAY_COUNT(Digits), NumericProp->GetFloatingPointPropertyValue(LeafData));
+	return FString(static_cast<int32>(Result.ptr - Digits), Digits);
+}
+
+void FUDBRowFilter::FAccessor::ForEachLeaf(const void* StructData, TFunctionRef<void(const void*)> Visitor) const
+{
+	VisitLeaves(0, StructData, Visitor);
+}
+
+void FUDBRowFilter::FAccessor::VisitLeaves(int32 StepIndex, const void* Container, TFunctionRef<void(const void*)> Visitor) const
+{
+	const FStep& Step = Steps[StepIndex];
+	const void* ValuePtr = Step.Property->ContainerPtrToValuePtr<void>(Container);
+	const bool bLast = StepIndex == Steps.Num() - 1;
+
+	auto Visit = [&](const void* Value)
+	{
+		if (bLast)
+		{
+			Visitor(Value);
+		}
+		else
+		{
+			VisitLeaves(StepIndex + 1, Value, Visitor);
+		}
+	};
+
+	if (Step.Array == nullptr)
+	{
+		Visit(ValuePtr);
+		return;
+	}
+
+	FScriptArrayHelper Helper(Step.Array, ValuePtr);
+	for (int32 Index = 0; Index < Helper.Num(); ++Index)
+	{
+		Visit(Helper.GetRawPtr(Index));
+	}
+}
+
+TSharedPtr<const FUDBRowFilter> FUDBRowFilter::Compile(const UStruct* StructType, const FString& Expression, FString& OutError)
+{
+	if (StructType == nullptr)
+	{
+		OutError = TEXT("No struct to filter");
+		return nullptr;
+	}
+
+	TArray<UDBRowFilterPrivate::FToken> Tokens;
+	if (!UDBRowFilterPrivate::Tokenize(Expression, Tokens, OutError))
+	{
+		return nullptr;
+	}
+
+	TSharedRef<FUDBRowFilter> Filter = MakeShared<FUDBRowFilter>();
+	Filter->Struct = StructType;
+
+	FUDBRowFilterParser Parser(StructType, MoveTemp(Tokens), *Filter);
+	if (!Parser.Parse(OutError))
+	{
+		return nullptr;
+	}
+	return Filter;
+}
+
+bool FUDBRowFilter::Matches(const void* StructData) const
+{
+	return Nodes.Num() == 0 || EvaluateNode(Nodes.Num() - 1, StructData);
+}
+
+bool FUDBRowFilter::EvaluateNode(int32 NodeIndex, const void* StructData) const
+{
+	const FNode& Node = Nodes[NodeIndex];
+	switch (Node.Kind)
+	{
+	case FNode::EKind::And:
+		return EvaluateNode(Node.Left, StructData) && EvaluateNode(Node.Right, StructData);
+	case FNode::EKind::Or:
+		return EvaluateNode(Node.Left, StructData) || EvaluateNode(Node.Right, StructData);
+	case FNode::EKind::Not:
+		return !EvaluateNode(Node.Left, StructData);
+	default:
+		return EvaluateCondition(Node, 0, StructData);
+	}
+}
+
+bool FUDBRowFilter::EvaluateCondition(const FNode& Node, int32 StepIndex, const void* Container)
+{
+	// Walk the steps, fanning out over array elements; the condition holds if any leaf does
+	const FAccessor::FStep& Step = Node.Accessor.Steps[StepIndex];
+	const void* ValuePtr = Step.Property->ContainerPtrToValuePtr<void>(Container);
+	const bool bLast = StepIndex == Node.Accessor.Steps.Num() - 1;
+
+	if (Step.Array == nullptr)
+	{
+		return bLast ? EvaluateLeaf(Node, ValuePtr) : EvaluateCondition(Node, StepIndex + 1, ValuePtr);
+	}
+
+	FScriptArrayHelper Helper(Step.Array, ValuePtr);
+	for (int32 Index = 0; Index < Helper.Num(); ++Index)
+	{
+		const void* Element = Helper.GetRawPtr(Index);
+		if (bLast ? EvaluateLeaf(Node, Element) : EvaluateCondition(Node, StepIndex + 1, Element))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FUDBRowFilter::EvaluateLeaf(const FNode& Node, const void* LeafData)
+{
+	using namespace UDBRowFilterPrivate;
+	const FProperty* Leaf = Node.Accessor.Leaf;
+
+	switch (Node.Accessor.Kind)
+	{
+	case ELeafKind::Numeric:
+	case ELeafKind::Enum:
+	{
+		const double Value = Node.Accessor.ReadNumber(LeafData);
+		if (Node.Op == EOp::In)
+		{
+			for (const FLiteral& Literal : Node.Literals)
+			{
+				if (Value == Literal.Number)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		return CompareOrdered(Value, Node.Literals[0].Number, Node.Op);
+	}
+
+	case ELeafKind::Bool:
+	{
+		const bool bValue = CastFieldChecked<FBoolProperty>(Leaf)->GetPropertyValue(LeafData);
+		if (Node.Op == EOp::Truthy)
+		{
+			return bValue;
+		}
+		return (bValue == Node.Literals[0].bBool) == (Node.Op == EOp::Equal);
+	}
+
+	case ELeafKind::String:
+		return CompareStrings(*static_cast<const FString*>(LeafData), Node);
+
+	case ELeafKind::Name:
+	{
+		const FName Value = *static_cast<const FName*>(LeafData);
+		if (Node.Op == EOp::Equal || Node.Op == EOp::NotEqual)
+		{
+			// FName comparison is case-insensitive and avoids building a string
+			return (Value == Node.Literals[0].Name) == (Node.Op == EOp::Equal);
+		}
+		return CompareStrings(Value.ToString(), Node);
+	}
+
+	case ELeafKind::Text:
+		return CompareStrings(Node.Accessor.ReadString(LeafData), Node);
+
+	case ELeafKind::Tag:
+	{
+		const FGameplayTag& Tag = *static_cast<const FGameplayTag*>(LeafData);
+		switch (Node.Op)
+		{
+		case EOp::Equal:    return Tag == Node.Literals[0].Tag;
+		case EOp::NotEqual: return Tag != Node.Literals[0].Tag;
+		case EOp::Matches:  return Tag.MatchesTag(Node.Literals[0].Tag);
+		default:
+			for (const FLiteral& Literal : Node.Literals)
+			{
+				if (Tag == Literal.Tag)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+	}
+
+	case ELeafKind::TagContainer:
+	{
+		const FGameplayTagContainer& Container = *static_cast<const FGameplayTagContainer*>(LeafData);
+		switch (Node.Op)
+		{
+		case EOp::Truthy:   return !Container.IsEmpty();
+		case EOp::Contains: return Container.HasTagExact(Node.Literals[0].Tag);
+		default:            return Container.HasTag(Node.Literals[0].Tag);
+		}
+	}
+	}
+
+	return false;
+}
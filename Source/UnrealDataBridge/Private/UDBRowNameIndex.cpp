@@ -0,0 +1,276 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBRowNameIndex.h"
+#include "UDBSettings.h"
+#include "Engine/DataTable.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/StringBuilder.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUDBRowNameIndex, Log, All);
+
+TMap<const UDataTable*, TUniquePtr<FUDBRowNameIndex::FTableNames>> FUDBRowNameIndex::Tables;
+uint64 FUDBRowNameIndex::UseCounter = 0;
+
+namespace UDBRowNameIndexPrivate
+{
+	static void FoldInPlace(TCHAR* Chars, int32 Len)
+	{
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			Chars[Index] = FChar::ToLower(Chars[Index]);
+		}
+	}
+
+	/** Glob match with single-star backtracking: linear for the usual one or two stars */
+	static bool MatchGlob(const TCHAR* Text, int32 TextLen, const TCHAR* Pattern, int32 PatternLen)
+	{
+		int32 TextPos = 0;
+		int32 PatternPos = 0;
+		int32 StarPattern = INDEX_NONE;
+		int32 StarText = 0;
+		while (TextPos < TextLen)
+		{
+			// A star in the pattern is always a wildcard, even where the row name has a literal '*'
+			if (PatternPos < PatternLen && Pattern[PatternPos] == TEXT('*'))
+			{
+				StarPattern = PatternPos++;
+				StarText = TextPos;
+			}
+			else if (PatternPos < PatternLen && (Pattern[PatternPos] == TEXT('?') || Pattern[PatternPos] == Text[TextPos]))
+			{
+				++TextPos;
+				++PatternPos;
+			}
+			else if (StarPattern != INDEX_NONE)
+			{
+				PatternPos = StarPattern + 1;
+				TextPos = ++StarText;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		while (PatternPos < PatternLen && Pattern[PatternPos] == TEXT('*'))
+		{
+			++PatternPos;
+		}
+		return PatternPos == PatternLen;
+	}
+
+	/** Folded strings compare ordinally; a prefix compares equal to every string it starts */
+	static int32 ComparePrefix(const FString& Text, FStringView Prefix)
+	{
+		return FCString::Strncmp(*Text, Prefix.GetData(), Prefix.Len());
+	}
+}
+
+// --- FPattern ---
+
+FUDBRowNameIndex::FPattern::FPattern(const FString& Pattern)
+	: Folded(Pattern)
+{
+	UDBRowNameIndexPrivate::FoldInPlace(Folded.GetCharArray().GetData(), Folded.Len());
+
+	int32 FirstWildcard = INDEX_NONE;
+	Folded.FindChar(TEXT('*'), FirstWildcard);
+	int32 FirstAny = INDEX_NONE;
+	if (Folded.FindChar(TEXT('?'), FirstAny) && (FirstWildcard == INDEX_NONE || FirstAny < FirstWildcard))
+	{
+		FirstWildcard = FirstAny;
+	}
+
+	PrefixLen = FirstWildcard == INDEX_NONE ? Folded.Len() : FirstWildcard;
+	bMatchesAll = Folded.IsEmpty() || Folded == TEXT("*");
+	bPrefixOnly = FirstWildcard != INDEX_NONE && FirstWildcard == Folded.Len() - 1 && Folded[FirstWildcard] == TEXT('*');
+}
+
+bool FUDBRowNameIndex::FPattern::Matches(FName Name) const
+{
+	if (bMatchesAll)
+	{
+		return true;
+	}
+
+	TStringBuilder<NAME_SIZE> Builder;
+	Name.AppendString(Builder);
+	UDBRowNameIndexPrivate::FoldInPlace(Builder.GetData(), Builder.Len());
+	return MatchesFolded(Builder.GetData(), Builder.Len());
+}
+
+bool FUDBRowNameIndex::FPattern::MatchesFolded(const TCHAR* Text, int32 Len) const
+{
+	return bMatchesAll || UDBRowNameIndexPrivate::MatchGlob(Text, Len, *Folded, Folded.Len());
+}
+
+// --- FTableNames ---
+
+void FUDBRowNameIndex::FTableNames::Build(const UDataTable* InTable)
+{
+	Stamp(InTable);
+	RowNames.Reset();
+	Folded.Reset();
+	Sorted.Reset();
+	LastPattern.Reset();
+	LastMatches.Reset();
+	bHasLastMatches = false;
+
+	const TMap<FName, uint8*>& RowMap = InTable->GetRowMap();
+	RowNames.Reserve(RowMap.Num());
+	Folded.Reserve(RowMap.Num());
+	Sorted.Reserve(RowMap.Num());
+	for (const TPair<FName, uint8*>& Row : RowMap)
+	{
+		FString& Text = Folded.Add_GetRef(Row.Key.ToString());
+		UDBRowNameIndexPrivate::FoldInPlace(Text.GetCharArray().GetData(), Text.Len());
+		Sorted.Add(RowNames.Add(Row.Key));
+	}
+
+	Sorted.Sort([this](int32 A, int32 B)
+	{
+		return FCString::Strcmp(*Folded[A], *Folded[B]) < 0;
+	});
+}
+
+void FUDBRowNameIndex::FTableNames::Match(const FPattern& Pattern, TArray<int32>& OutPositions) const
+{
+	OutPositions.Reset();
+	if (Pattern.MatchesAll())
+	{
+		OutPositions.SetNumUninitialized(RowNames.Num());
+		for (int32 Position = 0; Position < RowNames.Num(); ++Position)
+		{
+			OutPositions[Position] = Position;
+		}
+		return;
+	}
+
+	// No literal prefix: every name has to be tried
+	const FStringView Prefix = Pattern.GetPrefix();
+	if (Prefix.IsEmpty())
+	{
+		for (int32 Position = 0; Position < Folded.Num(); ++Position)
+		{
+			if (Pattern.MatchesFolded(*Folded[Position], Folded[Position].Len()))
+			{
+				OutPositions.Add(Position);
+			}
+		}
+		return;
+	}
+
+	// Names starting with the prefix are one range of the sorted order; only the rest of the pattern is left to check
+	const int32 First = Algo::LowerBoundBy(Sorted, 0, [this, Prefix](int32 Position)
+	{
+		return UDBRowNameIndexPrivate::ComparePrefix(Folded[Position], Prefix);
+	});
+	const int32 Last = Algo::UpperBoundBy(Sorted, 0, [this, Prefix](int32 Position)
+	{
+		return UDBRowNameIndexPrivate::ComparePrefix(Folded[Position], Prefix);
+	});
+	for (int32 Index = First; Index < Last; ++Index)
+	{
+		const FString& Text = Folded[Sorted[Index]];
+		if (Pattern.IsPrefixOnly() || Pattern.MatchesFolded(*Text, Text.Len()))
+		{
+			OutPositions.Add(Sorted[Index]);
+		}
+	}
+
+	// Back to table order
+	OutPositions.Sort();
+}
+
+// --- FUDBRowNameIndex ---
+
+bool FUDBRowNameIndex::IsEnabled(const UDataTable* Table)
+{
+	const int32 Threshold = UUDBSettings::Get()->RowNameIndexMinRows;
+	return Threshold > 0 && Table != nullptr && Table->GetRowMap().Num() >= Threshold;
+}
+
+int32 FUDBRowNameIndex::SelectPage(const UDataTable* Table, const FString& Pattern, int32 Offset, int32 Limit, TArray<FName>& OutPage)
+{
+	FTableNames& Names = Refresh(Table);
+	if (!Names.bHasLastMatches || !Names.LastPattern.Equals(Pattern, ESearchCase::CaseSensitive))
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Names.Match(FPattern(Pattern), Names.LastMatches);
+		Names.LastPattern = Pattern;
+		Names.bHasLastMatches = true;
+		UE_LOG(LogUDBRowNameIndex, Verbose, TEXT("Matched '%s' on %s: %d of %d rows in %.2f ms"),
+			*Pattern, *Table->GetName(), Names.LastMatches.Num(), Names.RowNames.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	const int32 Total = Names.LastMatches.Num();
+	const int32 Start = FMath::Clamp(Offset, 0, Total);
+	const int32 End = FMath::Clamp(Start + FMath::Max(Limit, 0), Start, Total);
+	OutPage.Reserve(OutPage.Num() + End - Start);
+	for (int32 Index = Start; Index < End; ++Index)
+	{
+		OutPage.Add(Names.RowNames[Names.LastMatches[Index]]);
+	}
+	return Total;
+}
+
+bool FUDBRowNameIndex::Contains(const UDataTable* Table)
+{
+	return FUDBTableCacheEntry::Find(Tables, Table) != nullptr;
+}
+
+void FUDBRowNameIndex::ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows)
+{
+	FTableNames* Names = FUDBTableCacheEntry::Find(Tables, Table);
+	if (Names == nullptr)
+	{
+		return;
+	}
+
+	// Only row updates keep the names; an added row shows in the row count since nothing was removed
+	if (!Names->CanPatch(Table, StartGeneration) || RemovedRows.Num() > 0 || Table->GetRowMap().Num() != Names->RowNames.Num())
+	{
+		Tables.Remove(Table);
+		return;
+	}
+	Names->Stamp(Table);
+}
+
+void FUDBRowNameIndex::Reset()
+{
+	if (Tables.Num() > 0)
+	{
+		UE_LOG(LogUDBRowNameIndex, Log, TEXT("Dropped row name indexes of %d tables"), Tables.Num());
+	}
+	Tables.Empty();
+}
+
+FUDBRowNameIndex::FTableNames& FUDBRowNameIndex::Refresh(const UDataTable* Table)
+{
+	if (!Tables.Contains(Table) && Tables.Num() >= MaxTables)
+	{
+		const UDataTable* Oldest = nullptr;
+		uint64 OldestUse = MAX_uint64;
+		for (const TPair<const UDataTable*, TUniquePtr<FTableNames>>& Pair : Tables)
+		{
+			if (Pair.Value->LastUsed < OldestUse)
+			{
+				Oldest = Pair.Key;
+				OldestUse = Pair.Value->LastUsed;
+			}
+		}
+		UE_LOG(LogUDBRowNameIndex, Verbose, TEXT("Dropped row name index of %d rows"), Tables.FindChecked(Oldest)->RowNames.Num());
+		Tables.Remove(Oldest);
+	}
+
+	FTableNames& Names = FUDBTableCacheEntry::FindOrAdd(Tables, Table);
+	Names.LastUsed = ++UseCounter;
+	if (!Names.IsCurrent(Table))
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Names.Build(Table);
+		UE_LOG(LogUDBRowNameIndex, Verbose, TEXT("Indexed row names of %s: %d rows in %.2f ms"),
+			*Table->GetName(), Names.RowNames.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+	return Names;
+}
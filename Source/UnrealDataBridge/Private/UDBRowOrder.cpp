@@ -0,0 +1,163 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBRowOrder.h"
+#include "Algo/Sort.h"
+
+TSharedPtr<const FUDBRowOrder> FUDBRowOrder::Compile(const UStruct* StructType, const TArray<FString>& KeySpecs, FString& OutError)
+{
+	TSharedRef<FUDBRowOrder> Order = MakeShared<FUDBRowOrder>();
+	for (const FString& Spec : KeySpecs)
+	{
+		TArray<FString> Parts;
+		Spec.ParseIntoArrayWS(Parts);
+		if (Parts.Num() == 0 || Parts.Num() > 2)
+		{
+			OutError = FString::Printf(TEXT("'%s' should be a field path optionally followed by asc or desc"), *Spec);
+			return nullptr;
+		}
+
+		FKey& Key = Order->Keys.AddDefaulted_GetRef();
+		if (Parts.Num() == 2)
+		{
+			if (Parts[1].Equals(TEXT("desc"), ESearchCase::IgnoreCase))
+			{
+				Key.bDescending = true;
+			}
+			else if (!Parts[1].Equals(TEXT("asc"), ESearchCase::IgnoreCase))
+			{
+				OutError = FString::Printf(TEXT("Unknown direction '%s' in '%s'. Must be one of: asc, desc"), *Parts[1], *Spec);
+				return nullptr;
+			}
+		}
+
+		if (!FUDBRowFilter::ResolveAccessor(StructType, Parts[0], Key.Accessor, OutError))
+		{
+			return nullptr;
+		}
+		if (Key.Accessor.HasArrays() || Key.Accessor.Kind == FUDBRowFilter::ELeafKind::TagContainer)
+		{
+			OutError = FString::Printf(TEXT("'%s' has several values per row and cannot be sorted on"), *Parts[0]);
+			return nullptr;
+		}
+	}
+
+	if (Order->Keys.Num() == 0)
+	{
+		OutError = TEXT("No sort keys");
+		return nullptr;
+	}
+	return Order;
+}
+
+void FUDBRowOrder::Select(TConstArrayView<const void*> Rows, int32 Offset, int32 Count, TArray<int32>& OutIndices) const
+{
+	OutIndices.Reset();
+	const int32 NumRows = Rows.Num();
+	const int32 End = static_cast<int32>(FMath::Min<int64>(static_cast<int64>(Offset) + Count, NumRows));
+	if (Offset >= End)
+	{
+		return;
+	}
+
+	// Extract every key once; comparisons then never touch row memory
+	const int32 NumKeys = Keys.Num();
+	TArray<FValue> Values;
+	Values.SetNum(NumRows * NumKeys);
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+		{
+			Values[Row * NumKeys + KeyIndex] = ExtractValue(Keys[KeyIndex], Rows[Row]);
+		}
+	}
+
+	// Strict total order: keys in turn, then input position
+	auto SortsBefore = [this, &Values, NumKeys](int32 A, int32 B)
+	{
+		for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+		{
+			const FKey& Key = Keys[KeyIndex];
+			const int32 Result = CompareValues(Key, Values[A * NumKeys + KeyIndex], Values[B * NumKeys + KeyIndex]);
+			if (Result != 0)
+			{
+				return Key.bDescending ? Result > 0 : Result < 0;
+			}
+		}
+		return A < B;
+	};
+
+	TArray<int32> Selected;
+	if (End < NumRows)
+	{
+		// Bounded heap whose top is the worst of the best End rows seen so far
+		auto SortsAfter = [&SortsBefore](int32 A, int32 B) { return SortsBefore(B, A); };
+		Selected.Reserve(End + 1);
+		for (int32 Row = 0; Row < NumRows; ++Row)
+		{
+			if (Selected.Num() < End)
+			{
+				Selected.HeapPush(Row, SortsAfter);
+			}
+			else if (SortsBefore(Row, Selected.HeapTop()))
+			{
+				int32 Evicted;
+				Selected.HeapPop(Evicted, SortsAfter, EAllowShrinking::No);
+				Selected.HeapPush(Row, SortsAfter);
+			}
+		}
+	}
+	else
+	{
+		Selected.SetNumUninitialized(NumRows);
+		for (int32 Row = 0; Row < NumRows; ++Row)
+		{
+			Selected[Row] = Row;
+		}
+	}
+
+	Algo::Sort(Selected, SortsBefore);
+	OutIndices.Append(Selected.GetData() + Offset, End - Offset);
+}
+
+FUDBRowOrder::FValue FUDBRowOrder::ExtractValue(const FKey& Key, const void* RowData) const
+{
+	const void* LeafData = Key.Accessor.GetLeafData(RowData);
+
+	FValue Value;
+	switch (Key.Accessor.Kind)
+	{
+	case FUDBRowFilter::ELeafKind::String:
+		Value.String = static_cast<const FString*>(LeafData);
+		break;
+	case FUDBRowFilter::ELeafKind::Text:
+		// The display string lives as long as the row's FText
+		Value.String = &static_cast<const FText*>(LeafData)->ToString();
+		break;
+	case FUDBRowFilter::ELeafKind::Name:
+		Value.Name = *static_cast<const FName*>(LeafData);
+		break;
+	case FUDBRowFilter::ELeafKind::Tag:
+		Value.Name = static_cast<const FGameplayTag*>(LeafData)->GetTagName();
+		break;
+	default:
+		Value.Number = Key.Accessor.ReadNumber(LeafData);
+		break;
+	}
+	return Value;
+}
+
+int32 FUDBRowOrder::CompareValues(const FKey& Key, const FValue& A, const FValue& B)
+{
+	switch (Key.Accessor.Kind)
+	{
+	case FUDBRowFilter::ELeafKind::String:
+	case FUDBRowFilter::ELeafKind::Text:
+		return A.String->Compare(*B.String, ESearchCase::IgnoreCase);
+	case FUDBRowFilter::ELeafKind::Name:
+	case FUDBRowFilter::ELeafKind::Tag:
+		// FName::Compare is lexical and case-insensitive
+		return A.Name.Compare(B.Name);
+	default:
+		return A.Number < B.Number ? -1 : (B.Number < A.Number ? 1 : 0);
+	}
+}
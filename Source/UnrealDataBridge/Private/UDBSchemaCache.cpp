@@ -0,0 +1,50 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBSchemaCache.h"
+#include "UDBSerializer.h"
+#include "Hash/CityHash.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUDBSchemaCache, Log, All);
+
+TMap<TPair<const UStruct*, bool>, FUDBSchemaCache::FEntry> FUDBSchemaCache::Entries;
+
+FUDBCachedSchema FUDBSchemaCache::Get(const UStruct* StructType, bool bIncludeInherited)
+{
+	const TPair<const UStruct*, bool> Key(StructType, bIncludeInherited);
+
+	// The weak pointer guards against a new struct reusing a collected struct's address
+	if (const FEntry* Existing = Entries.Find(Key))
+	{
+		if (Existing->Struct.Get() == StructType)
+		{
+			return Existing->Cached;
+		}
+	}
+
+	FEntry Entry;
+	Entry.Struct = StructType;
+	Entry.Cached.Schema = FUDBSerializer::GetStructSchema(StructType, bIncludeInherited);
+
+	TSharedRef<FUDBJsonBytes> Bytes = MakeShared<FUDBJsonBytes>(FUDBJsonWriter::ToBytes(Entry.Cached.Schema));
+	Entry.Cached.Hash = FString::Printf(TEXT("%016llx"), CityHash64(Bytes->GetData(), Bytes->Num()));
+	Entry.Cached.Utf8 = Bytes;
+
+	UE_LOG(LogUDBSchemaCache, Verbose, TEXT("Cached schema for %s (%d bytes, hash %s)"),
+		StructType != nullptr ? *StructType->GetName() : TEXT("None"), Bytes->Num(), *Entry.Cached.Hash);
+
+	return Entries.Add(Key, MoveTemp(Entry)).Cached;
+}
+
+void FUDBSchemaCache::Reset()
+{
+	if (Entries.Num() > 0)
+	{
+		UE_LOG(LogUDBSchemaCache, Log, TEXT("Cleared %d cached schemas"), Entries.Num());
+	}
+	Entries.Empty();
+}
+
+int32 FUDBSchemaCache::Num()
+{
+	return Entries.Num();
+}
@@ -7,10 +7,292 @@
 #include "StructUtils/InstancedStruct.h"
 #include "UObject/SoftObjectPath.h"
 #include "Dom/JsonValue.h"
+#include "Async/ParallelFor.h"
+#include "UObject/StructOnScope.h"
+#include "Misc/ScopeRWLock.h"
+#include <charconv>
 
 DEFINE_LOG_CATEGORY_STATIC(LogUDBSerializer, Log, All);
 
 TMap<const UScriptStruct*, TArray<UScriptStruct*>> FUDBSerializer::SubtypeCache;
+TMap<const UStruct*, TSharedPtr<FStructOnScope>> FUDBSerializer::DefaultsCache;
+
+namespace UDBSerializerPrivate
+{
+	/** In-memory type of a property that serializes as a plain JSON number */
+	enum class ENumericKind : uint8
+	{
+		None,
+		Int8,
+		Int16,
+		Int32,
+		Int64,
+		UInt8,
+		UInt16,
+		UInt32,
+		UInt64,
+		Float,
+		Double,
+	};
+
+	ENumericKind GetNumericKind(const FProperty* Property)
+	{
+		// Enum-backed bytes serialize as names, not numbers
+		const FNumericProperty* NumericProp = CastField<FNumericProperty>(Property);
+		if (NumericProp == nullptr || NumericProp->IsEnum())
+		{
+			return ENumericKind::None;
+		}
+
+		if (Property->IsA<FFloatProperty>())
+		{
+			return ENumericKind::Float;
+		}
+		if (Property->IsA<FDoubleProperty>())
+		{
+			return ENumericKind::Double;
+		}
+		if (Property->IsA<FIntProperty>())
+		{
+			return ENumericKind::Int32;
+		}
+		if (Property->IsA<FInt64Property>())
+		{
+			return ENumericKind::Int64;
+		}
+		if (Property->IsA<FByteProperty>())
+		{
+			return ENumericKind::UInt8;
+		}
+		if (Property->IsA<FInt8Property>())
+		{
+			return ENumericKind::Int8;
+		}
+		if (Property->IsA<FInt16Property>())
+		{
+			return ENumericKind::Int16;
+		}
+		if (Property->IsA<FUInt16Property>())
+		{
+			return ENumericKind::UInt16;
+		}
+		if (Property->IsA<FUInt32Property>())
+		{
+			return ENumericKind::UInt32;
+		}
+		if (Property->IsA<FUInt64Property>())
+		{
+			return ENumericKind::UInt64;
+		}
+		return ENumericKind::None;
+	}
+
+	/** Round to at most Precision decimal places (INDEX_NONE = unchanged) */
+	double ApplyPrecision(double Value, int32 Precision)
+	{
+		static const double PowersOfTen[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15 };
+		static_assert(UE_ARRAY_COUNT(PowersOfTen) == FUDBSerializeOptions::MaxFloatPrecision + 1, "One scale per precision");
+
+		if (Precision == INDEX_NONE || !FMath::IsFinite(Value))
+		{
+			return Value;
+		}
+
+		const double Scale = PowersOfTen[Precision];
+		const double Scaled = Value * Scale;
+		if (FMath::Abs(Scaled) >= 9007199254740992.0)
+		{
+			// Already coarser than the requested precision
+			return Value;
+		}
+		return FMath::RoundHalfFromZero(Scaled) / Scale;
+	}
+
+	template <typename T>
+	TSharedRef<FJsonValue> ToJsonNumber(T Value, int32 Precision)
+	{
+		return MakeShared<FJsonValueNumber>(static_cast<double>(Value));
+	}
+
+	TSharedRef<FJsonValue> ToJsonNumber(float Value, int32 Precision)
+	{
+		return Precision == INDEX_NONE ? FUDBSerializer::FloatToJsonValue(Value) : MakeShared<FJsonValueNumber>(ApplyPrecision(Value, Precision));
+	}
+
+	TSharedRef<FJsonValue> ToJsonNumber(double Value, int32 Precision)
+	{
+		return MakeShared<FJsonValueNumber>(ApplyPrecision(Value, Precision));
+	}
+
+	/** Convert Num contiguous values of one type in a single typed loop */
+	template <typename T>
+	void AppendNumbers(const void* Data, int32 Num, int32 Precision, TArray<TSharedPtr<FJsonValue>>& OutArray)
+	{
+		const T* Values = static_cast<const T*>(Data);
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			OutArray.Add(ToJsonNumber(Values[Index], Precision));
+		}
+	}
+
+	void AppendNumbers(ENumericKind Kind, const void* Data, int32 Num, int32 Precision, TArray<TSharedPtr<FJsonValue>>& OutArray)
+	{
+		switch (Kind)
+		{
+		case ENumericKind::Int8:   AppendNumbers<int8>(Data, Num, Precision, OutArray); break;
+		case ENumericKind::Int16:  AppendNumbers<int16>(Data, Num, Precision, OutArray); break;
+		case ENumericKind::Int32:  AppendNumbers<int32>(Data, Num, Precision, OutArray); break;
+		case ENumericKind::Int64:  AppendNumbers<int64>(Data, Num, Precision, OutArray); break;
+		case ENumericKind::UInt8:  AppendNumbers<uint8>(Data, Num, Precision, OutArray); break;
+		case ENumericKind::UInt16: AppendNumbers<uint16>(Data, Num, Precision, OutArray); break;
+		case ENumericKind::UInt32: AppendNumbers<uint32>(Data, Num, Precision, OutArray); break;
+		case ENumericKind::UInt64: AppendNumbers<uint64>(Data, Num, Precision, OutArray); break;
+		case ENumericKind::Float:  AppendNumbers<float>(Data, Num, Precision, OutArray); break;
+		case ENumericKind::Double: AppendNumbers<double>(Data, Num, Precision, OutArray); break;
+		default: break;
+		}
+	}
+
+	TSharedRef<FJsonValue> ReadNumber(ENumericKind Kind, const void* ValuePtr, int32 Precision)
+	{
+		switch (Kind)
+		{
+		case ENumericKind::Int8:   return ToJsonNumber(*static_cast<const int8*>(ValuePtr), Precision);
+		case ENumericKind::Int16:  return ToJsonNumber(*static_cast<const int16*>(ValuePtr), Precision);
+		case ENumericKind::Int32:  return ToJsonNumber(*static_cast<const int32*>(ValuePtr), Precision);
+		case ENumericKind::Int64:  return ToJsonNumber(*static_cast<const int64*>(ValuePtr), Precision);
+		case ENumericKind::UInt8:  return ToJsonNumber(*static_cast<const uint8*>(ValuePtr), Precision);
+		case ENumericKind::UInt16: return ToJsonNumber(*static_cast<const uint16*>(ValuePtr), Precision);
+		case ENumericKind::UInt32: return ToJsonNumber(*static_cast<const uint32*>(ValuePtr), Precision);
+		case ENumericKind::UInt64: return ToJsonNumber(*static_cast<const uint64*>(ValuePtr), Precision);
+		case ENumericKind::Float:  return ToJsonNumber(*static_cast<const float*>(ValuePtr), Precision);
+		case ENumericKind::Double: return ToJsonNumber(*static_cast<const double*>(ValuePtr), Precision);
+		default: return MakeShared<FJsonValueNumber>(0.0);
+		}
+	}
+
+	/** Members of a struct made only of plain numbers (FVector, FRotator, FLinearColor, FIntPoint, ...) */
+	struct FNumericStructLayout
+	{
+		struct FMember
+		{
+			const FProperty* Property;
+			FString Name;
+			ENumericKind Kind;
+		};
+		TArray<FMember> Members;
+	};
+
+	/** Layouts keyed by struct; null entries remember structs that don't qualify. Read from serializer workers. */
+	FRWLock NumericStructLayoutsLock;
+	TMap<const UScriptStruct*, TSharedPtr<const FNumericStructLayout>> NumericStructLayouts;
+
+	/** Numeric layout for a struct, or null if any member is not a plain number. Thread-safe.
+	 *  The pointer stays valid until ClearNumericStructLayouts, which only runs on reload. */
+	const FNumericStructLayout* FindNumericStructLayout(const UScriptStruct* Struct)
+	{
+		{
+			FReadScopeLock ReadLock(NumericStructLayoutsLock);
+			if (const TSharedPtr<const FNumericStructLayout>* Found = NumericStructLayouts.Find(Struct))
+			{
+				return Found->Get();
+			}
+		}
+
+		TSharedPtr<FNumericStructLayout> Layout = MakeShared<FNumericStructLayout>();
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			const ENumericKind Kind = GetNumericKind(*It);
+			if (Kind == ENumericKind::None || It->ArrayDim != 1)
+			{
+				Layout.Reset();
+				break;
+			}
+			Layout->Members.Add({ *It, It->GetName(), Kind });
+		}
+		if (Layout.IsValid() && Layout->Members.Num() == 0)
+		{
+			Layout.Reset();
+		}
+
+		FWriteScopeLock WriteLock(NumericStructLayoutsLock);
+		return NumericStructLayouts.FindOrAdd(Struct, Layout).Get();
+	}
+
+	TSharedPtr<FJsonObject> NumericStructToJson(const FNumericStructLayout& Layout, const void* StructData, int32 Precision)
+	{
+		TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->Values.Reserve(Layout.Members.Num());
+		for (const FNumericStructLayout::FMember& Member : Layout.Members)
+		{
+			const void* ValuePtr = Member.Property->ContainerPtrToValuePtr<void>(StructData);
+			Object->Values.Add(Member.Name, ReadNumber(Member.Kind, ValuePtr, Precision));
+		}
+		return Object;
+	}
+
+	bool CanDeserializeStructConcurrently(const UStruct* Struct, TArray<const UStruct*>& Visited);
+
+	bool CanDeserializePropertyConcurrently(const FProperty* Property, TArray<const UStruct*>& Visited)
+	{
+		// Hard references load their asset; soft references are only paths
+		if (Property->IsA<FObjectProperty>())
+		{
+			return false;
+		}
+		if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+		{
+			// The payload type is looked up by iterating every loaded struct
+			return StructProp->Struct != FInstancedStruct::StaticStruct() && CanDeserializeStructConcurrently(StructProp->Struct, Visited);
+		}
+		if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+		{
+			return CanDeserializePropertyConcurrently(ArrayProp->Inner, Visited);
+		}
+		if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+		{
+			return CanDeserializePropertyConcurrently(MapProp->KeyProp, Visited) && CanDeserializePropertyConcurrently(MapProp->ValueProp, Visited);
+		}
+		return true;
+	}
+
+	bool CanDeserializeStructConcurrently(const UStruct* Struct, TArray<const UStruct*>& Visited)
+	{
+		if (Visited.Contains(Struct))
+		{
+			return true;
+		}
+		Visited.Add(Struct);
+
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			if (!CanDeserializePropertyConcurrently(*It, Visited))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+FUDBSerializeOptions FUDBSerializeOptions::FromParams(const TSharedPtr<FJsonObject>& Params, const UStruct* StructType)
+{
+	FUDBSerializeOptions Options;
+
+	bool bOmitDefaults = false;
+	if (Params.IsValid() && Params->TryGetBoolField(TEXT("omit_defaults"), bOmitDefaults) && bOmitDefaults)
+	{
+		Options.DefaultData = FUDBSerializer::GetStructDefaults(StructType);
+	}
+
+	int32 FloatPrecision = INDEX_NONE;
+	if (Params.IsValid() && Params->TryGetNumberField(TEXT("float_precision"), FloatPrecision))
+	{
+		Options.FloatPrecision = FMath::Clamp(FloatPrecision, 0, MaxFloatPrecision);
+	}
+
+	return Options;
+}
 
 TSharedPtr<FJsonObject> FUDBSerializer::StructToJson(const UStruct* StructType, const void* StructData)
 {
@@ -55,6 +337,54 @@ TSharedPtr<FJsonObject> FUDBSerializer::StructToJson(const UStruct* StructType,
 		return StructToJson(StructType, StructData);
 	}
 
+	FUDBFieldProjection Projection;
+	for (const FString& FieldName : FieldFilter)
+	{
+		Projection.Children.Add(FieldName, MakeShared<FUDBFieldProjection>());
+	}
+	return StructToJson(StructType, StructData, Projection);
+}
+
+TSharedPtr<FJsonObject> FUDBSerializer::StructToJson(const UStruct* StructType, const void* StructData, const FUDBFieldProjection& Projection)
+{
+	if (Projection.IsEmpty())
+	{
+		return StructToJson(StructType, StructData);
+	}
+
+	// Projected paths continue through a top-level FInstancedStruct into its payload
+	if (StructType == FInstancedStruct::StaticStruct() && StructData != nullptr)
+	{
+		const FInstancedStruct* Instance = static_cast<const FInstancedStruct*>(StructData);
+		if (!Instance->IsValid())
+		{
+			return MakeShared<FJsonObject>();
+		}
+
+		TSharedPtr<FJsonObject> JsonObject = StructToJson(Instance->GetScriptStruct(), Instance->GetMemory(), Projection);
+		JsonObject->SetStringField(TEXT("_struct_type"), Instance->GetScriptStruct()->GetName());
+		return JsonObject;
+	}
+
+	return StructToJson(StructType, StructData, *FUDBCompiledProjection::Compile(StructType, Projection));
+}
+
+TSharedPtr<FJsonObject> FUDBSerializer::StructToJson(const UStruct* StructType, const void* StructData, const FUDBCompiledProjection& Projection)
+{
+	return StructToJson(StructType, StructData, &Projection, FUDBSerializeOptions());
+}
+
+TSharedPtr<FJsonObject> FUDBSerializer::StructToJson(
+	const UStruct* StructType,
+	const void* StructData,
+	const FUDBCompiledProjection* Projection,
+	const FUDBSerializeOptions& Options)
+{
+	if (Projection == nullptr && Options.IsDefault())
+	{
+		return StructToJson(StructType, StructData);
+	}
+
 	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
 
 	if (StructType == nullptr || StructData == nullptr)
@@ -62,61 +392,375 @@ TSharedPtr<FJsonObject> FUDBSerializer::StructToJson(const UStruct* StructType,
 		return JsonObject;
 	}
 
-	for (TFieldIterator<FProperty> It(StructType); It; ++It)
+	auto WriteField = [&](const FProperty* Property, const FString& Name, const FUDBCompiledProjection::FField* Field)
 	{
-		const FProperty* Property = *It;
-		if (!FieldFilter.Contains(Property->GetName()))
+		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(StructData);
+		const void* DefaultPtr = Options.DefaultData != nullptr ? Property->ContainerPtrToValuePtr<void>(Options.DefaultData) : nullptr;
+
+		if (DefaultPtr != nullptr && Property->Identical(ValuePtr, DefaultPtr, PPF_None))
 		{
-			continue;
+			return;
 		}
 
-		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(StructData);
+		TSharedPtr<FJsonValue> JsonValue;
+		const UStruct* NestedStruct = (DefaultPtr != nullptr && Property->IsA<FStructProperty>())
+			? FUDBCompiledProjection::GetProjectableStruct(Property)
+			: nullptr;
+
+		if (NestedStruct != nullptr)
+		{
+			// A changed nested struct still omits its own unchanged fields, compared against the default row's value
+			FUDBSerializeOptions NestedOptions = Options;
+			NestedOptions.DefaultData = DefaultPtr;
+			const FUDBCompiledProjection* NestedProjection = Field != nullptr ? Field->Child.Get() : nullptr;
+			JsonValue = MakeShared<FJsonValueObject>(StructToJson(NestedStruct, ValuePtr, NestedProjection, NestedOptions));
+		}
+		else if (Field != nullptr)
+		{
+			JsonValue = ProjectedPropertyToJson(Property, ValuePtr, *Field, Options);
+		}
+		else
+		{
+			JsonValue = PropertyToJson(Property, ValuePtr, Options);
+		}
 
-		TSharedPtr<FJsonValue> JsonValue = PropertyToJson(Property, ValuePtr);
 		if (JsonValue.IsValid())
 		{
-			JsonObject->SetField(Property->GetName(), JsonValue);
+			JsonObject->SetField(Name, JsonValue);
+		}
+	};
+
+	if (Projection != nullptr)
+	{
+		for (const FUDBCompiledProjection::FField& Field : Projection->Fields)
+		{
+			WriteField(Field.Property, Field.Name, &Field);
+		}
+	}
+	else
+	{
+		for (TFieldIterator<FProperty> It(StructType); It; ++It)
+		{
+			WriteField(*It, It->GetName(), nullptr);
 		}
 	}
 
 	return JsonObject;
 }
 
-TSharedPtr<FJsonValue> FUDBSerializer::PropertyToJson(const FProperty* Property, const void* ValuePtr)
+TSharedPtr<FJsonValue> FUDBSerializer::ProjectedPropertyToJson(const FProperty* Property, const void* ValuePtr, const FUDBCompiledProjection::FField& Field, const FUDBSerializeOptions& Options)
 {
-	if (Property == nullptr || ValuePtr == nullptr)
+	if (!Field.Source.IsValid())
 	{
-		return nullptr;
+		return PropertyToJson(Property, ValuePtr, Options);
 	}
 
-	// Bool
-	if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+	if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
 	{
-		return MakeShared<FJsonValueBoolean>(BoolProp->GetPropertyValue(ValuePtr));
+		if (StructProp->Struct == FInstancedStruct::StaticStruct())
+		{
+			// The payload type varies per row, so this is the one place the projection is compiled lazily
+			const FInstancedStruct* Instance = static_cast<const FInstancedStruct*>(ValuePtr);
+			if (!Instance->IsValid())
+			{
+				return MakeShared<FJsonValueNull>();
+			}
+
+			const TSharedRef<const FUDBCompiledProjection> PayloadProjection = FUDBCompiledProjection::Compile(Instance->GetScriptStruct(), *Field.Source);
+			TSharedPtr<FJsonObject> Obj = StructToJson(Instance->GetScriptStruct(), Instance->GetMemory(), &PayloadProjection.Get(), Options.ForNestedValue());
+			Obj->SetStringField(TEXT("_struct_type"), Instance->GetScriptStruct()->GetName());
+			return MakeShared<FJsonValueObject>(Obj);
+		}
+
+		if (Field.Child.IsValid())
+		{
+			return MakeShared<FJsonValueObject>(StructToJson(StructProp->Struct, ValuePtr, Field.Child.Get(), Options.ForNestedValue()));
+		}
+
+		// Leaf-like structs (tags, soft paths) have no sub-fields to select
+		return PropertyToJson(Property, ValuePtr, Options);
 	}
 
-	// Int
-	if (const FIntProperty* IntProp = CastField<FIntProperty>(Property))
+	if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
 	{
-		return MakeShared<FJsonValueNumber>(static_cast<double>(IntProp->GetPropertyValue(ValuePtr)));
+		FScriptArrayHelper ArrayHelper(ArrayProp, ValuePtr);
+		TArray<TSharedPtr<FJsonValue>> JsonArray;
+		JsonArray.Reserve(ArrayHelper.Num());
+
+		for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+		{
+			TSharedPtr<FJsonValue> ElementValue = ProjectedPropertyToJson(ArrayProp->Inner, ArrayHelper.GetRawPtr(Index), Field, Options);
+			if (ElementValue.IsValid())
+			{
+				JsonArray.Add(ElementValue);
+			}
+		}
+
+		return MakeShared<FJsonValueArray>(JsonArray);
 	}
 
-	// Int64
-	if (const FInt64Property* Int64Prop = CastField<FInt64Property>(Property))
+	if (const FSetProperty* SetProp = CastField<FSetProperty>(Property))
 	{
-		return MakeShared<FJsonValueNumber>(static_cast<double>(Int64Prop->GetPropertyValue(ValuePtr)));
+		FScriptSetHelper SetHelper(SetProp, ValuePtr);
+		TArray<TSharedPtr<FJsonValue>> JsonArray;
+
+		for (int32 Index = 0; Index < SetHelper.GetMaxIndex(); ++Index)
+		{
+			if (!SetHelper.IsValidIndex(Index))
+			{
+				continue;
+			}
+
+			TSharedPtr<FJsonValue> ElementValue = ProjectedPropertyToJson(SetProp->ElementProp, SetHelper.GetElementPtr(Index), Field, Options);
+			if (ElementValue.IsValid())
+			{
+				JsonArray.Add(ElementValue);
+			}
+		}
+
+		return MakeShared<FJsonValueArray>(JsonArray);
 	}
 
-	// Float
-	if (const FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
+	if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		FScriptMapHelper MapHelper(MapProp, ValuePtr);
+		TSharedPtr<FJsonObject> MapObj = MakeShared<FJsonObject>();
+
+		for (int32 Index = 0; Index < MapHelper.GetMaxIndex(); ++Index)
+		{
+			if (!MapHelper.IsValidIndex(Index))
+			{
+				continue;
+			}
+
+			FString KeyString;
+			MapProp->KeyProp->ExportTextItem_Direct(KeyString, MapHelper.GetKeyPtr(Index), nullptr, nullptr, PPF_None);
+
+			TSharedPtr<FJsonValue> JsonValue = ProjectedPropertyToJson(MapProp->ValueProp, MapHelper.GetValuePtr(Index), Field, Options);
+			if (JsonValue.IsValid())
+			{
+				MapObj->SetField(KeyString, JsonValue);
+			}
+		}
+
+		return MakeShared<FJsonValueObject>(MapObj);
+	}
+
+	// Scalars have no sub-fields; a path that runs past one selects the whole value
+	return PropertyToJson(Property, ValuePtr, Options);
+}
+
+void FUDBSerializer::StructsToJson(
+	const UStruct* StructType,
+	TConstArrayView<const void*> StructDatas,
+	const FUDBFieldProjection& Projection,
+	const FUDBSerializeOptions& Options,
+	int32 NumChunks,
+	TArray<TSharedPtr<FJsonObject>>& OutJson,
+	TArray<FUDBJsonFragment>* OutUtf8)
+{
+	const int32 NumRows = StructDatas.Num();
+	OutJson.Reset();
+	OutJson.SetNum(NumRows);
+	if (OutUtf8 != nullptr)
 	{
-		return MakeShared<FJsonValueNumber>(static_cast<double>(FloatProp->GetPropertyValue(ValuePtr)));
+		OutUtf8->Reset();
+		OutUtf8->SetNum(NumRows);
 	}
 
-	// Double
-	if (const FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(Property))
+	if (NumRows == 0)
+	{
+		return;
+	}
+
+	NumChunks = FMath::Clamp(NumChunks, 1, NumRows);
+	const int32 RowsPerChunk = FMath::DivideAndRoundUp(NumRows, NumChunks);
+
+	// Resolve the projection against the struct once; every row reuses it
+	TSharedPtr<const FUDBCompiledProjection> Compiled;
+	if (!Projection.IsEmpty() && StructType != FInstancedStruct::StaticStruct())
+	{
+		Compiled = FUDBCompiledProjection::Compile(StructType, Projection);
+	}
+
+	// Each chunk writes a disjoint slice of the output arrays: no locking, and order is preserved
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Begin = ChunkIndex * RowsPerChunk;
+		const int32 End = FMath::Min(Begin + RowsPerChunk, NumRows);
+
+		// All rows of the chunk are appended to one buffer; fragments are (offset, length) slices of it
+		TSharedPtr<FUDBJsonBytes> ChunkBytes;
+		if (OutUtf8 != nullptr)
+		{
+			ChunkBytes = MakeShared<FUDBJsonBytes>();
+		}
+
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			OutJson[Index] = (Compiled.IsValid() || !Options.IsDefault())
+				? StructToJson(StructType, StructDatas[Index], Compiled.Get(), Options)
+				: StructToJson(StructType, StructDatas[Index], Projection);
+			if (ChunkBytes.IsValid())
+			{
+				const int32 RowOffset = ChunkBytes->Num();
+				FUDBJsonWriter Writer(*ChunkBytes);
+				Writer.WriteObject(OutJson[Index]);
+				(*OutUtf8)[Index] = FUDBJsonFragment(nullptr, RowOffset, ChunkBytes->Num() - RowOffset);
+
+				// The first row sizes the buffer for the rest of the chunk instead of doubling up to it
+				if (Index == Begin)
+				{
+					const int64 Estimate = static_cast<int64>(ChunkBytes->Num()) * (End - Begin) * 9 / 8;
+					ChunkBytes->Reserve(static_cast<int32>(FMath::Min<int64>(Estimate, MAX_int32)));
+				}
+			}
+		}
+
+		// Storage is attached once the buffer can no longer move
+		if (ChunkBytes.IsValid())
+		{
+			const TSharedPtr<const FUDBJsonBytes> Storage = ChunkBytes;
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				(*OutUtf8)[Index].Storage = Storage;
+			}
+		}
+	}, NumChunks > 1 ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread);
+}
+
+TSharedPtr<FJsonObject> FUDBSerializer::StructsToColumns(
+	const UStruct* StructType,
+	TConstArrayView<const void*> StructDatas,
+	const FUDBFieldProjection& Projection,
+	const FUDBSerializeOptions& Options,
+	int32 NumChunks)
+{
+	TSharedPtr<FJsonObject> ColumnsObject = MakeShared<FJsonObject>();
+	if (StructType == nullptr)
+	{
+		return ColumnsObject;
+	}
+
+	// Without a projection every top-level property is a whole-value column
+	TSharedPtr<const FUDBCompiledProjection> Compiled;
+	if (!Projection.IsEmpty())
+	{
+		Compiled = FUDBCompiledProjection::Compile(StructType, Projection);
+	}
+	else
+	{
+		TSharedRef<FUDBCompiledProjection> AllFields = MakeShared<FUDBCompiledProjection>();
+		AllFields->Struct = StructType;
+		for (TFieldIterator<FProperty> It(StructType); It; ++It)
+		{
+			FUDBCompiledProjection::FField& Field = AllFields->Fields.AddDefaulted_GetRef();
+			Field.Property = *It;
+			Field.Name = It->GetName();
+		}
+		Compiled = AllFields;
+	}
+
+	const TArray<FUDBCompiledProjection::FField>& Fields = Compiled->Fields;
+	TArray<TSharedPtr<FJsonValue>> Columns;
+	Columns.SetNum(Fields.Num());
+
+	// Columns are independent, so they are the unit of parallelism here
+	ParallelFor(Fields.Num(), [&](int32 ColumnIndex)
+	{
+		Columns[ColumnIndex] = BuildColumn(StructDatas, Fields[ColumnIndex], Options);
+	}, NumChunks > 1 ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread);
+
+	for (int32 ColumnIndex = 0; ColumnIndex < Fields.Num(); ++ColumnIndex)
+	{
+		ColumnsObject->SetField(Fields[ColumnIndex].Name, Columns[ColumnIndex]);
+	}
+
+	return ColumnsObject;
+}
+
+TSharedPtr<FJsonValue> FUDBSerializer::BuildColumn(TConstArrayView<const void*> StructDatas, const FUDBCompiledProjection::FField& Field, const FUDBSerializeOptions& Options)
+{
+	const FProperty* Property = Field.Property;
+
+	const FByteProperty* ByteProp = CastField<FByteProperty>(Property);
+	const FStructProperty* StructProp = CastField<FStructProperty>(Property);
+	const bool bAlwaysDictionary = Property->IsA<FEnumProperty>()
+		|| Property->IsA<FNameProperty>()
+		|| (ByteProp != nullptr && ByteProp->GetIntPropertyEnum() != nullptr)
+		|| (StructProp != nullptr && StructProp->Struct == FGameplayTag::StaticStruct());
+	const bool bMaybeDictionary = Property->IsA<FStrProperty>() || Property->IsA<FTextProperty>();
+
+	TArray<TSharedPtr<FJsonValue>> Values;
+	Values.Reserve(StructDatas.Num());
+	for (const void* StructData : StructDatas)
+	{
+		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(StructData);
+		TSharedPtr<FJsonValue> Value = ProjectedPropertyToJson(Property, ValuePtr, Field, Options);
+		Values.Add(Value.IsValid() ? Value : MakeShared<FJsonValueNull>());
+	}
+
+	if (!bAlwaysDictionary && !bMaybeDictionary)
 	{
-		return MakeShared<FJsonValueNumber>(DoubleProp->GetPropertyValue(ValuePtr));
+		return MakeShared<FJsonValueArray>(Values);
+	}
+
+	TMap<FString, int32> DictionaryIndex;
+	TArray<TSharedPtr<FJsonValue>> Dictionary;
+	TArray<TSharedPtr<FJsonValue>> Codes;
+	Codes.Reserve(Values.Num());
+	for (const TSharedPtr<FJsonValue>& Value : Values)
+	{
+		const FString Key = Value->AsString();
+		int32 Code = INDEX_NONE;
+		if (const int32* Existing = DictionaryIndex.Find(Key))
+		{
+			// FString map keys ignore case; strings differing only in case can't share a code
+			if (bMaybeDictionary && !Dictionary[*Existing]->AsString().Equals(Key, ESearchCase::CaseSensitive))
+			{
+				return MakeShared<FJsonValueArray>(Values);
+			}
+			Code = *Existing;
+		}
+		else
+		{
+			Code = Dictionary.Num();
+			Dictionary.Add(Value);
+			DictionaryIndex.Add(Key, Code);
+		}
+		Codes.Add(MakeShared<FJsonValueNumber>(Code));
+	}
+
+	// Free-form strings only pay off when values repeat
+	if (bMaybeDictionary && Dictionary.Num() * 2 > Values.Num())
+	{
+		return MakeShared<FJsonValueArray>(Values);
+	}
+
+	TSharedPtr<FJsonObject> Encoded = MakeShared<FJsonObject>();
+	Encoded->SetArrayField(TEXT("dict"), Dictionary);
+	Encoded->SetArrayField(TEXT("codes"), Codes);
+	return MakeShared<FJsonValueObject>(Encoded);
+}
+
+TSharedPtr<FJsonValue> FUDBSerializer::PropertyToJson(const FProperty* Property, const void* ValuePtr, const FUDBSerializeOptions& Options)
+{
+	if (Property == nullptr || ValuePtr == nullptr)
+	{
+		return nullptr;
+	}
+
+	// Bool
+	if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+	{
+		return MakeShared<FJsonValueBoolean>(BoolProp->GetPropertyValue(ValuePtr));
+	}
+
+	// Plain numbers (int, float, double, unsigned and sized variants; not enum-backed bytes)
+	const UDBSerializerPrivate::ENumericKind NumericKind = UDBSerializerPrivate::GetNumericKind(Property);
+	if (NumericKind != UDBSerializerPrivate::ENumericKind::None)
+	{
+		return UDBSerializerPrivate::ReadNumber(NumericKind, ValuePtr, Options.FloatPrecision);
 	}
 
 	// FString
@@ -188,7 +832,7 @@ TSharedPtr<FJsonValue> FUDBSerializer::PropertyToJson(const FProperty* Property,
 			const FInstancedStruct* Instance = static_cast<const FInstancedStruct*>(ValuePtr);
 			if (Instance->IsValid())
 			{
-				TSharedPtr<FJsonObject> Obj = StructToJson(Instance->GetScriptStruct(), Instance->GetMemory());
+				TSharedPtr<FJsonObject> Obj = StructToJson(Instance->GetScriptStruct(), Instance->GetMemory(), nullptr, Options.ForNestedValue());
 				Obj->SetStringField(TEXT("_struct_type"), Instance->GetScriptStruct()->GetName());
 				return MakeShared<FJsonValueObject>(Obj);
 			}
@@ -202,8 +846,14 @@ TSharedPtr<FJsonValue> FUDBSerializer::PropertyToJson(const FProperty* Property,
 			return MakeShared<FJsonValueString>(SoftPath->ToString());
 		}
 
+		// All-numeric structs (FVector, FRotator, ...) skip per-member property dispatch
+		if (const UDBSerializerPrivate::FNumericStructLayout* Layout = UDBSerializerPrivate::FindNumericStructLayout(StructProp->Struct))
+		{
+			return MakeShared<FJsonValueObject>(UDBSerializerPrivate::NumericStructToJson(*Layout, ValuePtr, Options.FloatPrecision));
+		}
+
 		// Default: recursive struct serialization
-		TSharedPtr<FJsonObject> NestedObj = StructToJson(StructProp->Struct, ValuePtr);
+		TSharedPtr<FJsonObject> NestedObj = StructToJson(StructProp->Struct, ValuePtr, nullptr, Options.ForNestedValue());
 		return MakeShared<FJsonValueObject>(NestedObj);
 	}
 
@@ -214,10 +864,37 @@ TSharedPtr<FJsonValue> FUDBSerializer::PropertyToJson(const FProperty* Property,
 		TArray<TSharedPtr<FJsonValue>> JsonArray;
 		JsonArray.Reserve(ArrayHelper.Num());
 
+		if (ArrayHelper.Num() == 0)
+		{
+			return MakeShared<FJsonValueArray>(JsonArray);
+		}
+
+		// Contiguous plain numbers (curves, weights, ...): one typed pass over the raw buffer
+		const UDBSerializerPrivate::ENumericKind InnerKind = UDBSerializerPrivate::GetNumericKind(ArrayProp->Inner);
+		if (InnerKind != UDBSerializerPrivate::ENumericKind::None)
+		{
+			UDBSerializerPrivate::AppendNumbers(InnerKind, ArrayHelper.GetRawPtr(0), ArrayHelper.Num(), Options.FloatPrecision, JsonArray);
+			return MakeShared<FJsonValueArray>(JsonArray);
+		}
+
+		// Arrays of FVector-like structs resolve the member layout once for every element
+		const FStructProperty* InnerStructProp = CastField<FStructProperty>(ArrayProp->Inner);
+		if (const UDBSerializerPrivate::FNumericStructLayout* Layout = InnerStructProp != nullptr
+			? UDBSerializerPrivate::FindNumericStructLayout(InnerStructProp->Struct)
+			: nullptr)
+		{
+			for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+			{
+				JsonArray.Add(MakeShared<FJsonValueObject>(
+					UDBSerializerPrivate::NumericStructToJson(*Layout, ArrayHelper.GetRawPtr(Index), Options.FloatPrecision)));
+			}
+			return MakeShared<FJsonValueArray>(JsonArray);
+		}
+
 		for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
 		{
 			const void* ElementPtr = ArrayHelper.GetRawPtr(Index);
-			TSharedPtr<FJsonValue> ElementValue = PropertyToJson(ArrayProp->Inner, ElementPtr);
+			TSharedPtr<FJsonValue> ElementValue = PropertyToJson(ArrayProp->Inner, ElementPtr, Options);
 			if (ElementValue.IsValid())
 			{
 				JsonArray.Add(ElementValue);
@@ -247,7 +924,7 @@ TSharedPtr<FJsonValue> FUDBSerializer::PropertyToJson(const FProperty* Property,
 
 			// Get value
 			const void* MapValuePtr = MapHelper.GetValuePtr(Index);
-			TSharedPtr<FJsonValue> JsonValue = PropertyToJson(MapProp->ValueProp, MapValuePtr);
+			TSharedPtr<FJsonValue> JsonValue = PropertyToJson(MapProp->ValueProp, MapValuePtr, Options);
 			if (JsonValue.IsValid())
 			{
 				MapObj->SetField(KeyString, JsonValue);
@@ -271,7 +948,7 @@ TSharedPtr<FJsonValue> FUDBSerializer::PropertyToJson(const FProperty* Property,
 			}
 
 			const void* ElementPtr = SetHelper.GetElementPtr(Index);
-			TSharedPtr<FJsonValue> ElementValue = PropertyToJson(SetProp->ElementProp, ElementPtr);
+			TSharedPtr<FJsonValue> ElementValue = PropertyToJson(SetProp->ElementProp, ElementPtr, Options);
 			if (ElementValue.IsValid())
 			{
 				JsonArray.Add(ElementValue);
@@ -304,6 +981,17 @@ TSharedPtr<FJsonValue> FUDBSerializer::PropertyToJson(const FProperty* Property,
 	return nullptr;
 }
 
+bool FUDBSerializer::CanDeserializeConcurrently(const UStruct* StructType)
+{
+	if (StructType == nullptr)
+	{
+		return false;
+	}
+
+	TArray<const UStruct*> Visited;
+	return UDBSerializerPrivate::CanDeserializeStructConcurrently(StructType, Visited);
+}
+
 bool FUDBSerializer::JsonToStruct(const TSharedPtr<FJsonObject>& JsonObject, const UStruct* StructType, void* StructData, TArray<FString>& OutWarnings)
 {
 	if (!JsonObject.IsValid() || StructType == nullptr || StructData == nullptr)
@@ -911,3 +1599,63 @@ TArray<UScriptStruct*> FUDBSerializer::FindInstancedStructSubtypes(const UScript
 	SubtypeCache.Add(BaseStruct, Subtypes);
 	return Subtypes;
 }
+
+void FUDBSerializer::ClearSubtypeCache()
+{
+	SubtypeCache.Empty();
+}
+
+const void* FUDBSerializer::GetStructDefaults(const UStruct* StructType)
+{
+	if (StructType == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (const UClass* Class = Cast<UClass>(StructType))
+	{
+		return Class->GetDefaultObject();
+	}
+
+	// FStructOnScope holds its struct weakly, so a stale entry for a collected struct is detected here
+	if (const TSharedPtr<FStructOnScope>* Cached = DefaultsCache.Find(StructType))
+	{
+		if ((*Cached)->GetStruct() == StructType)
+		{
+			return (*Cached)->GetStructMemory();
+		}
+	}
+
+	TSharedPtr<FStructOnScope> Defaults = MakeShared<FStructOnScope>(StructType);
+	DefaultsCache.Add(StructType, Defaults);
+	return Defaults->GetStructMemory();
+}
+
+void FUDBSerializer::ClearStructDefaults()
+{
+	DefaultsCache.Empty();
+}
+
+void FUDBSerializer::ClearNumericStructLayouts()
+{
+	FWriteScopeLock WriteLock(UDBSerializerPrivate::NumericStructLayoutsLock);
+	UDBSerializerPrivate::NumericStructLayouts.Empty();
+}
+
+TSharedRef<FJsonValue> FUDBSerializer::FloatToJsonValue(float Value)
+{
+	const double Widened = static_cast<double>(Value);
+	if (!FMath::IsFinite(Value) || Widened == FMath::FloorToDouble(Widened))
+	{
+		return MakeShared<FJsonValueNumber>(Widened);
+	}
+
+	// Shortest digits that round-trip as float; the writer copies them instead of formatting a double
+	ANSICHAR Digits[32];
+	const std::to_chars_result Result = std::to_chars(Digits, Digits + UE_ARRAY_COUNT(Digits), Value);
+	if (Result.ec != std::errc())
+	{
+		return MakeShared<FJsonValueNumber>(Widened);
+	}
+	return MakeShared<FJsonValueNumberString>(FString(static_cast<int32>(Result.ptr - Digits), Digits));
+}
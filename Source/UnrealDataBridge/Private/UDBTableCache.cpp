@@ -0,0 +1,96 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBTableCache.h"
+#include "UDBTableVersions.h"
+#include "Engine/DataTable.h"
+
+// --- FUDBTableCacheEntry ---
+
+bool FUDBTableCacheEntry::IsCurrent(const UDataTable* InTable) const
+{
+	return IsFor(InTable) && RowStruct == InTable->GetRowStruct() && Generation == FUDBTableVersions::GetGeneration(InTable);
+}
+
+bool FUDBTableCacheEntry::CanPatch(const UDataTable* InTable, uint64 StartGeneration) const
+{
+	return IsFor(InTable) && RowStruct == InTable->GetRowStruct() && Generation == StartGeneration;
+}
+
+void FUDBTableCacheEntry::Stamp(const UDataTable* InTable)
+{
+	Table = InTable;
+	RowStruct = InTable->GetRowStruct();
+	Generation = FUDBTableVersions::GetGeneration(InTable);
+}
+
+// --- FUDBRowSlots ---
+
+int32 FUDBRowSlots::FindSlot(const UDataTable* Table, FName RowName)
+{
+	const FSetElementId RowId = Table->GetRowMap().FindId(RowName);
+	return RowId.IsValidId() ? RowId.AsInteger() : INDEX_NONE;
+}
+
+void FUDBRowSlots::Build(const UDataTable* Table, TFunctionRef<void(FName, int32, const uint8*)> Visitor)
+{
+	const TMap<FName, uint8*>& RowMap = Table->GetRowMap();
+	RowNames.Reset(RowMap.Num());
+	RowPositions.Reset();
+	RowPositions.Reserve(RowMap.Num());
+	for (TMap<FName, uint8*>::TConstIterator It = RowMap.CreateConstIterator(); It; ++It)
+	{
+		const int32 Slot = It.GetId().AsInteger();
+		if (RowNames.Num() <= Slot)
+		{
+			RowNames.SetNum(Slot + 1);
+		}
+		RowNames[Slot] = It.Key();
+		RowPositions.Add(It.Key(), Slot);
+		Visitor(It.Key(), Slot, It.Value());
+	}
+}
+
+int32 FUDBRowSlots::Place(const UDataTable* Table, FName RowName, TFunctionRef<void(int32 Position)> OnFreed)
+{
+	const int32 Slot = FindSlot(Table, RowName);
+	const int32* Existing = RowPositions.Find(RowName);
+	if (Existing != nullptr && *Existing == Slot)
+	{
+		return Slot;
+	}
+
+	const int32 OldPosition = Remove(RowName);
+	if (OldPosition != INDEX_NONE)
+	{
+		OnFreed(OldPosition);
+	}
+	if (Slot == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	if (RowNames.Num() <= Slot)
+	{
+		RowNames.SetNum(Slot + 1);
+	}
+	else if (!RowNames[Slot].IsNone())
+	{
+		// A row the cache still holds here was removed without being reported
+		Remove(RowNames[Slot]);
+		OnFreed(Slot);
+	}
+	RowNames[Slot] = RowName;
+	RowPositions.Add(RowName, Slot);
+	return Slot;
+}
+
+int32 FUDBRowSlots::Remove(FName RowName)
+{
+	int32 Position;
+	if (!RowPositions.RemoveAndCopyValue(RowName, Position))
+	{
+		return INDEX_NONE;
+	}
+	RowNames[Position] = NAME_None;
+	return Position;
+}
@@ -0,0 +1,568 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBTableIndexes.h"
+#include "UDBTableVersions.h"
+#include "UDBBitmapIndexes.h"
+#include "Engine/DataTable.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUDBTableIndexes, Log, All);
+
+TMap<const UDataTable*, TUniquePtr<FUDBTableIndexes::FTableIndexes>> FUDBTableIndexes::Tables;
+TArray<FUDBTableIndexes::FRowChangeListener> FUDBTableIndexes::RowChangeListeners;
+
+namespace UDBTableIndexesPrivate
+{
+	static bool IsNumericKind(FUDBRowFilter::ELeafKind Kind)
+	{
+		return Kind == FUDBRowFilter::ELeafKind::Numeric || Kind == FUDBRowFilter::ELeafKind::Enum || Kind == FUDBRowFilter::ELeafKind::Bool;
+	}
+
+	/** The top-level conjuncts of a filter: conditions every matching row must satisfy */
+	static void CollectConjuncts(const TArray<FUDBRowFilter::FNode>& Nodes, int32 NodeIndex, TArray<const FUDBRowFilter::FNode*>& OutConditions)
+	{
+		const FUDBRowFilter::FNode& Node = Nodes[NodeIndex];
+		if (Node.Kind == FUDBRowFilter::FNode::EKind::And)
+		{
+			CollectConjuncts(Nodes, Node.Left, OutConditions);
+			CollectConjuncts(Nodes, Node.Right, OutConditions);
+		}
+		else if (Node.Kind == FUDBRowFilter::FNode::EKind::Condition)
+		{
+			OutConditions.Add(&Node);
+		}
+	}
+}
+
+// --- FIndex ---
+
+FUDBTableIndexes::FKey FUDBTableIndexes::FIndex::MakeKey(const void* RowData) const
+{
+	const void* LeafData = Accessor.GetLeafData(RowData);
+
+	FKey Key;
+	if (UDBTableIndexesPrivate::IsNumericKind(Accessor.Kind))
+	{
+		Key.Number = Accessor.ReadNumber(LeafData);
+	}
+	else
+	{
+		Key.String = Accessor.ReadString(LeafData).ToLower();
+	}
+	return Key;
+}
+
+FUDBTableIndexes::FKey FUDBTableIndexes::FIndex::MakeKey(const FUDBRowFilter::FLiteral& Literal) const
+{
+	FKey Key;
+	switch (Accessor.Kind)
+	{
+	case FUDBRowFilter::ELeafKind::Bool:
+		Key.Number = Literal.bBool ? 1.0 : 0.0;
+		break;
+	case FUDBRowFilter::ELeafKind::Numeric:
+	case FUDBRowFilter::ELeafKind::Enum:
+		Key.Number = Literal.Number;
+		break;
+	case FUDBRowFilter::ELeafKind::Tag:
+		Key.String = Literal.Tag.ToString().ToLower();
+		break;
+	default:
+		Key.String = Literal.String.ToLower();
+		break;
+	}
+	return Key;
+}
+
+void FUDBTableIndexes::FIndex::Build(const UDataTable* Table)
+{
+	Rows.Reset();
+	Buckets.Reset();
+	Sorted.Reset();
+	Stamp(Table);
+
+	const TMap<FName, uint8*>& RowMap = Table->GetRowMap();
+	Rows.Reserve(RowMap.Num());
+	if (Type == EUDBIndexType::Sorted)
+	{
+		Sorted.Reserve(RowMap.Num());
+	}
+
+	for (TMap<FName, uint8*>::TConstIterator It = RowMap.CreateConstIterator(); It; ++It)
+	{
+		const FKey Key = MakeKey(It.Value());
+		Rows.Add(It.Key(), { Key, It.GetId().AsInteger() });
+		if (Type == EUDBIndexType::Hash)
+		{
+			Buckets.FindOrAdd(Key).Add(It.Key());
+		}
+		else
+		{
+			Sorted.Emplace(Key, It.Key());
+		}
+	}
+
+	// One sort instead of an insertion per row
+	Algo::SortBy(Sorted, &TPair<FKey, FName>::Key);
+}
+
+void FUDBTableIndexes::FIndex::Insert(FName RowName, int32 Slot, const void* RowData)
+{
+	Remove(RowName);
+
+	const FKey Key = MakeKey(RowData);
+	Rows.Add(RowName, { Key, Slot });
+	if (Type == EUDBIndexType::Hash)
+	{
+		Buckets.FindOrAdd(Key).Add(RowName);
+	}
+	else
+	{
+		const int32 Position = Algo::UpperBoundBy(Sorted, Key, &TPair<FKey, FName>::Key);
+		Sorted.Insert(TPair<FKey, FName>(Key, RowName), Position);
+	}
+}
+
+void FUDBTableIndexes::FIndex::Remove(FName RowName)
+{
+	FRowEntry Entry;
+	if (!Rows.RemoveAndCopyValue(RowName, Entry))
+	{
+		return;
+	}
+
+	if (Type == EUDBIndexType::Hash)
+	{
+		if (TArray<FName>* Bucket = Buckets.Find(Entry.Key))
+		{
+			Bucket->RemoveSingleSwap(RowName, EAllowShrinking::No);
+			if (Bucket->Num() == 0)
+			{
+				Buckets.Remove(Entry.Key);
+			}
+		}
+	}
+	else
+	{
+		for (int32 Position = Algo::LowerBoundBy(Sorted, Entry.Key, &TPair<FKey, FName>::Key);
+			Position < Sorted.Num() && Sorted[Position].Key == Entry.Key; ++Position)
+		{
+			if (Sorted[Position].Value == RowName)
+			{
+				Sorted.RemoveAt(Position, 1, EAllowShrinking::No);
+				break;
+			}
+		}
+	}
+}
+
+int32 FUDBTableIndexes::FIndex::NumKeys() const
+{
+	if (Type == EUDBIndexType::Hash)
+	{
+		return Buckets.Num();
+	}
+
+	int32 Count = 0;
+	for (int32 Position = 0; Position < Sorted.Num(); ++Position)
+	{
+		Count += (Position == 0 || !(Sorted[Position].Key == Sorted[Position - 1].Key)) ? 1 : 0;
+	}
+	return Count;
+}
+
+bool FUDBTableIndexes::FIndex::Lookup(const FUDBRowFilter::FNode& Condition, TArray<FName>& OutRows) const
+{
+	using EOp = FUDBRowFilter::EOp;
+	auto KeyOf = &TPair<FKey, FName>::Key;
+
+	if (Condition.Op == EOp::Equal || Condition.Op == EOp::In)
+	{
+		for (const FUDBRowFilter::FLiteral& Literal : Condition.Literals)
+		{
+			const FKey Key = MakeKey(Literal);
+			if (Type == EUDBIndexType::Hash)
+			{
+				if (const TArray<FName>* Bucket = Buckets.Find(Key))
+				{
+					OutRows.Append(*Bucket);
+				}
+			}
+			else
+			{
+				const int32 First = Algo::LowerBoundBy(Sorted, Key, KeyOf);
+				const int32 Last = Algo::UpperBoundBy(Sorted, Key, KeyOf);
+				for (int32 Position = First; Position < Last; ++Position)
+				{
+					OutRows.Add(Sorted[Position].Value);
+				}
+			}
+		}
+		return true;
+	}
+
+	// Ranges need key order, and string order here (case-folded) need not match the filter's
+	if (Type != EUDBIndexType::Sorted || !UDBTableIndexesPrivate::IsNumericKind(Accessor.Kind))
+	{
+		return false;
+	}
+
+	const FKey Bound = MakeKey(Condition.Literals[0]);
+	int32 First = 0;
+	int32 Last = Sorted.Num();
+	switch (Condition.Op)
+	{
+	case EOp::Less:         Last = Algo::LowerBoundBy(Sorted, Bound, KeyOf); break;
+	case EOp::LessEqual:    Last = Algo::UpperBoundBy(Sorted, Bound, KeyOf); break;
+	case EOp::Greater:      First = Algo::UpperBoundBy(Sorted, Bound, KeyOf); break;
+	case EOp::GreaterEqual: First = Algo::LowerBoundBy(Sorted, Bound, KeyOf); break;
+	default:                return false;
+	}
+
+	OutRows.Reserve(OutRows.Num() + FMath::Max(0, Last - First));
+	for (int32 Position = First; Position < Last; ++Position)
+	{
+		OutRows.Add(Sorted[Position].Value);
+	}
+	return true;
+}
+
+// --- FUDBTableIndexes ---
+
+bool FUDBTableIndexes::CreateIndex(const UDataTable* Table, const FString& Field, EUDBIndexType Type, FBuildStats& OutStats, FString& OutError)
+{
+	if (Table == nullptr || Table->GetRowStruct() == nullptr)
+	{
+		OutError = TEXT("DataTable has no row struct");
+		return false;
+	}
+
+	if (Type == EUDBIndexType::Bitmap)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		if (!FUDBBitmapIndexes::CreateIndex(Table, Field, OutStats.NumRows, OutStats.NumKeys, OutError))
+		{
+			return false;
+		}
+		OutStats.BuildMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		// One index per field: a bitmap replaces a hash or sorted index on the same path
+		FUDBRowFilter::FAccessor Accessor;
+		FString Unused;
+		FUDBRowFilter::ResolveAccessor(Table->GetRowStruct(), Field, Accessor, Unused);
+		RemoveIndexes(Table, Accessor.Path);
+
+		UE_LOG(LogUDBTableIndexes, Log, TEXT("Built bitmap index on %s.%s: %d rows, %d keys in %.2f ms"),
+			*Table->GetName(), *Accessor.Path, OutStats.NumRows, OutStats.NumKeys, OutStats.BuildMs);
+		return true;
+	}
+
+	TSharedPtr<FIndex> Index = MakeShared<FIndex>();
+	Index->Type = Type;
+	if (!FUDBRowFilter::ResolveAccessor(Table->GetRowStruct(), Field, Index->Accessor, OutError))
+	{
+		return false;
+	}
+	if (Index->Accessor.HasArrays() || Index->Accessor.Kind == FUDBRowFilter::ELeafKind::TagContainer)
+	{
+		OutError = FString::Printf(TEXT("'%s' has several values per row; indexes need a single-valued field"), *Field);
+		return false;
+	}
+	Index->Field = Index->Accessor.Path;
+
+	const double StartTime = FPlatformTime::Seconds();
+	Index->Build(Table);
+
+	OutStats.NumRows = Index->Rows.Num();
+	OutStats.NumKeys = Index->NumKeys();
+	OutStats.BuildMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	DropIndex(Table, Index->Field);
+	FUDBTableCacheEntry::FindOrAdd(Tables, Table).Indexes.Add(Index);
+
+	UE_LOG(LogUDBTableIndexes, Log, TEXT("Built %s index on %s.%s: %d rows, %d keys in %.2f ms"),
+		LexToString(Type), *Table->GetName(), *Index->Field, OutStats.NumRows, OutStats.NumKeys, OutStats.BuildMs);
+	return true;
+}
+
+bool FUDBTableIndexes::DropIndex(const UDataTable* Table, const FString& Field)
+{
+	const bool bRemovedBitmap = FUDBBitmapIndexes::DropIndex(Table, Field);
+	return RemoveIndexes(Table, Field) || bRemovedBitmap;
+}
+
+bool FUDBTableIndexes::RemoveIndexes(const UDataTable* Table, const FString& Field)
+{
+	FTableIndexes* Entry = FUDBTableCacheEntry::Find(Tables, Table);
+	if (Entry == nullptr)
+	{
+		return false;
+	}
+
+	const int32 Removed = Entry->Indexes.RemoveAll([&Field](const TSharedPtr<FIndex>& Index)
+	{
+		return Index->Field.Equals(Field, ESearchCase::IgnoreCase);
+	});
+	if (Entry->Indexes.Num() == 0)
+	{
+		Tables.Remove(Table);
+	}
+	return Removed > 0;
+}
+
+TArray<TPair<FString, EUDBIndexType>> FUDBTableIndexes::GetIndexes(const UDataTable* Table)
+{
+	TArray<TPair<FString, EUDBIndexType>> Result;
+	if (const FTableIndexes* Entry = FUDBTableCacheEntry::Find(Tables, Table))
+	{
+		for (const TSharedPtr<FIndex>& Index : Entry->Indexes)
+		{
+			Result.Emplace(Index->Field, Index->Type);
+		}
+	}
+	for (const FString& Field : FUDBBitmapIndexes::GetIndexes(Table))
+	{
+		Result.Emplace(Field, EUDBIndexType::Bitmap);
+	}
+	return Result;
+}
+
+bool FUDBTableIndexes::FindCandidates(const UDataTable* Table, const FUDBRowFilter& Filter, FUDBIndexLookup& OutLookup)
+{
+	FUDBIndexLookup BitmapLookup;
+	const bool bBitmap = FUDBBitmapIndexes::FindCandidates(Table, Filter, BitmapLookup);
+
+	FTableIndexes* Entry = FUDBTableCacheEntry::Find(Tables, Table);
+	if (Entry == nullptr || Filter.GetNodes().Num() == 0)
+	{
+		if (bBitmap)
+		{
+			OutLookup = MoveTemp(BitmapLookup);
+		}
+		return bBitmap;
+	}
+
+	TArray<const FUDBRowFilter::FNode*> Conditions;
+	UDBTableIndexesPrivate::CollectConjuncts(Filter.GetNodes(), Filter.GetNodes().Num() - 1, Conditions);
+
+	// Try every (condition, index) pair and keep the smallest candidate set
+	const FIndex* BestIndex = nullptr;
+	TArray<FName> BestRows;
+	for (int32 IndexPos = Entry->Indexes.Num() - 1; IndexPos >= 0; --IndexPos)
+	{
+		FIndex& Index = *Entry->Indexes[IndexPos];
+		const bool bUsable = Conditions.ContainsByPredicate([&Index](const FUDBRowFilter::FNode* Condition)
+		{
+			return Condition->Accessor.Path.Equals(Index.Field, ESearchCase::IgnoreCase);
+		});
+		if (!bUsable)
+		{
+			continue;
+		}
+
+		if (!Refresh(Table, Index))
+		{
+			UE_LOG(LogUDBTableIndexes, Warning, TEXT("Dropped index on %s.%s: the field no longer exists"), *Table->GetName(), *Index.Field);
+			Entry->Indexes.RemoveAt(IndexPos);
+			continue;
+		}
+
+		for (const FUDBRowFilter::FNode* Condition : Conditions)
+		{
+			TArray<FName> Rows;
+			if (Condition->Accessor.Path.Equals(Index.Field, ESearchCase::IgnoreCase)
+				&& Index.Lookup(*Condition, Rows)
+				&& (BestIndex == nullptr || Rows.Num() < BestRows.Num()))
+			{
+				BestIndex = &Index;
+				BestRows = MoveTemp(Rows);
+			}
+		}
+	}
+
+	if (BestIndex == nullptr || (bBitmap && BitmapLookup.Rows.Num() <= BestRows.Num()))
+	{
+		if (bBitmap)
+		{
+			OutLookup = MoveTemp(BitmapLookup);
+		}
+		return bBitmap;
+	}
+
+	// Back to table order; "in" lists may name a key twice
+	TArray<TPair<int32, FName>> Ordered;
+	Ordered.Reserve(BestRows.Num());
+	for (const FName& RowName : BestRows)
+	{
+		Ordered.Emplace(BestIndex->Rows.FindChecked(RowName).Slot, RowName);
+	}
+	Algo::SortBy(Ordered, &TPair<int32, FName>::Key);
+
+	OutLookup.Rows.Reset(Ordered.Num());
+	for (int32 Position = 0; Position < Ordered.Num(); ++Position)
+	{
+		if (Position == 0 || Ordered[Position].Key != Ordered[Position - 1].Key)
+		{
+			OutLookup.Rows.Add(Ordered[Position].Value);
+		}
+	}
+	OutLookup.Field = BestIndex->Field;
+	OutLookup.Type = BestIndex->Type;
+	return true;
+}
+
+void FUDBTableIndexes::Reset()
+{
+	if (Tables.Num() > 0)
+	{
+		UE_LOG(LogUDBTableIndexes, Log, TEXT("Dropped indexes on %d tables"), Tables.Num());
+	}
+	Tables.Empty();
+	FUDBBitmapIndexes::Reset();
+}
+
+const TCHAR* FUDBTableIndexes::LexToString(EUDBIndexType Type)
+{
+	switch (Type)
+	{
+	case EUDBIndexType::Sorted: return TEXT("sorted");
+	case EUDBIndexType::Bitmap: return TEXT("bitmap");
+	default:                    return TEXT("hash");
+	}
+}
+
+bool FUDBTableIndexes::LexFromString(const FString& String, EUDBIndexType& OutType)
+{
+	if (String.Equals(TEXT("hash"), ESearchCase::IgnoreCase))
+	{
+		OutType = EUDBIndexType::Hash;
+		return true;
+	}
+	if (String.Equals(TEXT("sorted"), ESearchCase::IgnoreCase))
+	{
+		OutType = EUDBIndexType::Sorted;
+		return true;
+	}
+	if (String.Equals(TEXT("bitmap"), ESearchCase::IgnoreCase))
+	{
+		OutType = EUDBIndexType::Bitmap;
+		return true;
+	}
+	return false;
+}
+
+bool FUDBTableIndexes::Refresh(const UDataTable* Table, FIndex& Index)
+{
+	if (Index.RowStruct != Table->GetRowStruct())
+	{
+		// The table was given a different row struct; the path must resolve again
+		FString Error;
+		FUDBRowFilter::FAccessor Accessor;
+		if (Table->GetRowStruct() == nullptr
+			|| !FUDBRowFilter::ResolveAccessor(Table->GetRowStruct(), Index.Field, Accessor, Error)
+			|| Accessor.HasArrays() || Accessor.Kind == FUDBRowFilter::ELeafKind::TagContainer)
+		{
+			return false;
+		}
+		Index.Accessor = MoveTemp(Accessor);
+	}
+
+	if (!Index.IsCurrent(Table))
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Index.Build(Table);
+		UE_LOG(LogUDBTableIndexes, Verbose, TEXT("Rebuilt index on %s.%s in %.2f ms"),
+			*Table->GetName(), *Index.Field, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+	return true;
+}
+
+void FUDBTableIndexes::AddRowChangeListener(const FRowChangeListener& Listener)
+{
+	check(Listener.Contains != nullptr && Listener.ApplyRowChanges != nullptr);
+	RowChangeListeners.Add(Listener);
+}
+
+void FUDBTableIndexes::RemoveRowChangeListeners()
+{
+	RowChangeListeners.Empty();
+}
+
+void FUDBTableIndexes::ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows)
+{
+	FUDBBitmapIndexes::ApplyRowChanges(Table, StartGeneration, ChangedRows, RemovedRows);
+
+	FTableIndexes* Entry = FUDBTableCacheEntry::Find(Tables, Table);
+	if (Entry == nullptr)
+	{
+		return;
+	}
+
+	for (const TSharedPtr<FIndex>& Index : Entry->Indexes)
+	{
+		if (!Index->CanPatch(Table, StartGeneration))
+		{
+			continue;
+		}
+
+		for (const FName& RowName : RemovedRows)
+		{
+			Index->Remove(RowName);
+		}
+		for (const FName& RowName : ChangedRows)
+		{
+			const int32 Slot = FUDBRowSlots::FindSlot(Table, RowName);
+			if (Slot != INDEX_NONE)
+			{
+				Index->Insert(RowName, Slot, Table->FindRowUnchecked(RowName));
+			}
+			else
+			{
+				Index->Remove(RowName);
+			}
+		}
+		Index->Stamp(Table);
+	}
+}
+
+// --- FScopedRowChanges ---
+
+FUDBTableIndexes::FScopedRowChanges::FScopedRowChanges(const UDataTable* InTable)
+	: Table(InTable)
+	, StartGeneration(0)
+{
+	// Only a table some cache holds is worth tracking
+	bool bTracked = FUDBTableCacheEntry::Find(Tables, InTable) != nullptr || FUDBBitmapIndexes::Contains(InTable);
+	for (int32 Index = 0; !bTracked && Index < RowChangeListeners.Num(); ++Index)
+	{
+		bTracked = RowChangeListeners[Index].Contains(InTable);
+	}
+	if (bTracked)
+	{
+		StartGeneration = FUDBTableVersions::GetGeneration(InTable);
+	}
+}
+
+FUDBTableIndexes::FScopedRowChanges::~FScopedRowChanges()
+{
+	if (StartGeneration != 0 && !bInvalidated && (ChangedRows.Num() > 0 || RemovedRows.Num() > 0))
+	{
+		ApplyRowChanges(Table, StartGeneration, ChangedRows, RemovedRows);
+		for (const FRowChangeListener& Listener : RowChangeListeners)
+		{
+			Listener.ApplyRowChanges(Table, StartGeneration, ChangedRows, RemovedRows);
+		}
+	}
+}
+
+void FUDBTableIndexes::FScopedRowChanges::RowChanged(FName RowName)
+{
+	ChangedRows.Add(RowName);
+}
+
+void FUDBTableIndexes::FScopedRowChanges::RowRemoved(FName RowName)
+{
+	RemovedRows.Add(RowName);
+}
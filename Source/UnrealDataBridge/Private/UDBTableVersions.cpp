@@ -0,0 +1,99 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBTableVersions.h"
+#include "UDBJsonWriter.h"
+#include "Engine/DataTable.h"
+#include "Hash/CityHash.h"
+#include "Misc/App.h"
+#include "Misc/TransactionObjectEvent.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUDBTableVersions, Log, All);
+
+TMap<const UDataTable*, FUDBTableVersions::FTableState> FUDBTableVersions::States;
+uint64 FUDBTableVersions::LastGeneration = 0;
+
+uint64 FUDBTableVersions::GetGeneration(const UDataTable* Table)
+{
+	return Table != nullptr ? GetState(Table).Generation : 0;
+}
+
+void FUDBTableVersions::MarkChanged(const UDataTable* Table)
+{
+	// Untracked tables need nothing: they get a fresh generation when first tracked
+	if (FTableState* State = States.Find(Table))
+	{
+		State->Generation = ++LastGeneration;
+		UE_LOG(LogUDBTableVersions, Verbose, TEXT("%s changed (generation %llu)"),
+			Table != nullptr ? *Table->GetName() : TEXT("None"), State->Generation);
+	}
+}
+
+FString FUDBTableVersions::MakeReadETag(const UDataTable* Table, const TSharedPtr<FJsonObject>& Params)
+{
+	// Hash the request params, minus the conditional itself, seeded with the session and generation
+	FUDBJsonBytes ParamBytes;
+	if (Params.IsValid())
+	{
+		FUDBJsonWriter Writer(ParamBytes);
+		Writer.WriteObjectStart();
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Params->Values)
+		{
+			if (Pair.Key != TEXT("if_none_match"))
+			{
+				Writer.WriteIdentifier(Pair.Key);
+				Writer.WriteValue(Pair.Value);
+			}
+		}
+		Writer.WriteObjectEnd();
+	}
+
+	const FGuid& InstanceId = FApp::GetInstanceId();
+	const uint64 Seed = CityHash64WithSeed(reinterpret_cast<const char*>(&InstanceId), sizeof(InstanceId), GetGeneration(Table));
+	return FString::Printf(TEXT("%016llx"), CityHash64WithSeed(ParamBytes.GetData(), ParamBytes.Num(), Seed));
+}
+
+FString FUDBTableVersions::MakeContentETag(const ANSICHAR* Data, int32 Num)
+{
+	return FString::Printf(TEXT("%016llx"), CityHash64(Data, Num));
+}
+
+void FUDBTableVersions::HandleObjectTransacted(UObject* Object, const FTransactionObjectEvent& Event)
+{
+	if (Event.GetEventType() == ETransactionObjectEventType::UndoRedo)
+	{
+		if (const UDataTable* Table = Cast<UDataTable>(Object))
+		{
+			MarkChanged(Table);
+		}
+	}
+}
+
+void FUDBTableVersions::Reset()
+{
+	for (TPair<const UDataTable*, FTableState>& Pair : States)
+	{
+		if (UDataTable* Table = const_cast<UDataTable*>(Pair.Value.Table.Get()))
+		{
+			Table->OnDataTableChanged().Remove(Pair.Value.ChangedHandle);
+		}
+	}
+	States.Empty();
+}
+
+FUDBTableVersions::FTableState& FUDBTableVersions::GetState(const UDataTable* Table)
+{
+	FTableState& State = States.FindOrAdd(Table);
+	if (State.Table.Get() != Table)
+	{
+		// First use, or a new table at a collected table's address
+		State.Table = Table;
+		State.Generation = ++LastGeneration;
+		State.ChangedHandle = const_cast<UDataTable*>(Table)->OnDataTableChanged().AddStatic(&FUDBTableVersions::HandleDataTableChanged, Table);
+	}
+	return State;
+}
+
+void FUDBTableVersions::HandleDataTableChanged(const UDataTable* Table)
+{
+	MarkChanged(Table);
+}
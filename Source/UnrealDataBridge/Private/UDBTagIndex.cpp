@@ -0,0 +1,282 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBTagIndex.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagsManager.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUDBTagIndex, Log, All);
+
+TMap<const UDataTable*, TUniquePtr<FUDBTagIndex::FTableTags>> FUDBTagIndex::Tables;
+
+// --- FFieldIndex ---
+
+void FUDBTagIndex::FFieldIndex::Insert(int32 Position, const uint8* RowData)
+{
+	if (RowTags.Num() <= Position)
+	{
+		RowTags.SetNum(Position + 1);
+	}
+
+	TArray<FGameplayTag>& Tags = RowTags[Position];
+	Tags.Reset();
+	const void* FieldPtr = Property->ContainerPtrToValuePtr<void>(RowData);
+	if (bContainer)
+	{
+		for (const FGameplayTag& Tag : *static_cast<const FGameplayTagContainer*>(FieldPtr))
+		{
+			if (Tag.IsValid())
+			{
+				Tags.AddUnique(Tag);
+			}
+		}
+	}
+	else if (static_cast<const FGameplayTag*>(FieldPtr)->IsValid())
+	{
+		Tags.Add(*static_cast<const FGameplayTag*>(FieldPtr));
+	}
+
+	// Slots ascend during a build, so most inserts are appends
+	for (const FGameplayTag& Tag : Tags)
+	{
+		TArray<int32>& Posting = Postings.FindOrAdd(Tag);
+		if (Posting.Num() == 0 || Posting.Last() < Position)
+		{
+			Posting.Add(Position);
+		}
+		else
+		{
+			const int32 Slot = Algo::LowerBound(Posting, Position);
+			if (Slot == Posting.Num() || Posting[Slot] != Position)
+			{
+				Posting.Insert(Position, Slot);
+			}
+		}
+	}
+}
+
+void FUDBTagIndex::FFieldIndex::Remove(int32 Position)
+{
+	if (!RowTags.IsValidIndex(Position))
+	{
+		return;
+	}
+
+	for (const FGameplayTag& Tag : RowTags[Position])
+	{
+		TArray<int32>* Posting = Postings.Find(Tag);
+		if (Posting == nullptr)
+		{
+			continue;
+		}
+
+		const int32 Slot = Algo::BinarySearch(*Posting, Position);
+		if (Slot != INDEX_NONE)
+		{
+			Posting->RemoveAt(Slot, 1, EAllowShrinking::No);
+		}
+		if (Posting->Num() == 0)
+		{
+			Postings.Remove(Tag);
+		}
+	}
+	RowTags[Position].Reset();
+}
+
+// --- FTableTags ---
+
+void FUDBTagIndex::FTableTags::Rebuild(const UDataTable* InTable)
+{
+	Stamp(InTable);
+	Slots.Build(InTable, [](FName, int32, const uint8*) {});
+
+	// A new row struct may have dropped or retyped a field
+	for (auto It = Fields.CreateIterator(); It; ++It)
+	{
+		FFieldIndex& Field = *It->Value;
+		Field.Property = FindTagProperty(RowStruct, It->Key, Field.bContainer);
+		if (Field.Property == nullptr)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+		BuildField(InTable, Field);
+	}
+}
+
+void FUDBTagIndex::FTableTags::BuildField(const UDataTable* InTable, FFieldIndex& Field)
+{
+	Field.Postings.Reset();
+	Field.RowTags.Reset();
+	Field.RowTags.SetNum(Slots.RowNames.Num());
+	for (int32 Position = 0; Position < Slots.RowNames.Num(); ++Position)
+	{
+		const FName RowName = Slots.RowNames[Position];
+		if (const uint8* RowData = RowName.IsNone() ? nullptr : InTable->FindRowUnchecked(RowName))
+		{
+			Field.Insert(Position, RowData);
+		}
+	}
+}
+
+void FUDBTagIndex::FTableTags::RemoveRow(FName RowName)
+{
+	const int32 Position = Slots.Remove(RowName);
+	if (Position != INDEX_NONE)
+	{
+		FreePosition(Position);
+	}
+}
+
+void FUDBTagIndex::FTableTags::FreePosition(int32 Position)
+{
+	for (const TPair<FName, TUniquePtr<FFieldIndex>>& Pair : Fields)
+	{
+		Pair.Value->Remove(Position);
+	}
+}
+
+// --- FUDBTagIndex ---
+
+bool FUDBTagIndex::FindRows(const UDataTable* Table, FName Field, TConstArrayView<FGameplayTag> Tags, bool bHierarchical,
+	TArray<FRowMatch>& OutMatches, TSet<FGameplayTag>& OutResolved)
+{
+	FTableTags* TableTags = nullptr;
+	const FFieldIndex* FieldIndex = Refresh(Table, Field, TableTags);
+	if (FieldIndex == nullptr)
+	{
+		return false;
+	}
+
+	// Position -> matched tags; a hierarchical lookup probes every descendant in the tag tree
+	TMap<int32, TArray<FGameplayTag>> MatchedByPosition;
+	for (const FGameplayTag& Requested : Tags)
+	{
+		TArray<FGameplayTag> Keys;
+		if (bHierarchical)
+		{
+			UGameplayTagsManager::Get().RequestGameplayTagChildren(Requested).GetGameplayTagArray(Keys);
+		}
+		Keys.Insert(Requested, 0);
+
+		for (const FGameplayTag& Key : Keys)
+		{
+			const TArray<int32>* Posting = FieldIndex->Postings.Find(Key);
+			if (Posting == nullptr)
+			{
+				continue;
+			}
+
+			OutResolved.Add(Requested);
+			for (const int32 Position : *Posting)
+			{
+				MatchedByPosition.FindOrAdd(Position).AddUnique(Key);
+			}
+		}
+	}
+
+	MatchedByPosition.KeySort(TLess<int32>());
+	OutMatches.Reset(MatchedByPosition.Num());
+	for (TPair<int32, TArray<FGameplayTag>>& Pair : MatchedByPosition)
+	{
+		FRowMatch& Match = OutMatches.AddDefaulted_GetRef();
+		Match.RowName = TableTags->Slots.RowNames[Pair.Key];
+		Match.Tags = MoveTemp(Pair.Value);
+	}
+	return true;
+}
+
+bool FUDBTagIndex::Contains(const UDataTable* Table)
+{
+	return FUDBTableCacheEntry::Find(Tables, Table) != nullptr;
+}
+
+void FUDBTagIndex::ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows)
+{
+	FTableTags* TableTags = FUDBTableCacheEntry::Find(Tables, Table);
+	if (TableTags == nullptr || !TableTags->CanPatch(Table, StartGeneration))
+	{
+		return;
+	}
+
+	for (const FName& RowName : RemovedRows)
+	{
+		TableTags->RemoveRow(RowName);
+	}
+	for (const FName& RowName : ChangedRows)
+	{
+		const int32 Position = TableTags->Slots.Place(Table, RowName, [TableTags](int32 Freed) { TableTags->FreePosition(Freed); });
+		if (Position == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const uint8* RowData = Table->FindRowUnchecked(RowName);
+		for (const TPair<FName, TUniquePtr<FFieldIndex>>& Pair : TableTags->Fields)
+		{
+			Pair.Value->Remove(Position);
+			Pair.Value->Insert(Position, RowData);
+		}
+	}
+	TableTags->Stamp(Table);
+}
+
+void FUDBTagIndex::Reset()
+{
+	if (Tables.Num() > 0)
+	{
+		UE_LOG(LogUDBTagIndex, Log, TEXT("Dropped tag indexes of %d tables"), Tables.Num());
+	}
+	Tables.Empty();
+}
+
+const FStructProperty* FUDBTagIndex::FindTagProperty(const UScriptStruct* RowStruct, FName Field, bool& bOutContainer)
+{
+	const FStructProperty* Property = RowStruct != nullptr ? CastField<FStructProperty>(RowStruct->FindPropertyByName(Field)) : nullptr;
+	if (Property == nullptr)
+	{
+		return nullptr;
+	}
+
+	bOutContainer = Property->Struct == FGameplayTagContainer::StaticStruct();
+	return bOutContainer || Property->Struct == FGameplayTag::StaticStruct() ? Property : nullptr;
+}
+
+FUDBTagIndex::FFieldIndex* FUDBTagIndex::Refresh(const UDataTable* Table, FName Field, FTableTags*& OutTableTags)
+{
+	if (Table == nullptr || Table->GetRowStruct() == nullptr)
+	{
+		return nullptr;
+	}
+
+	FTableTags& TableTags = FUDBTableCacheEntry::FindOrAdd(Tables, Table);
+	OutTableTags = &TableTags;
+
+	if (!TableTags.IsCurrent(Table))
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		TableTags.Rebuild(Table);
+		UE_LOG(LogUDBTagIndex, Verbose, TEXT("Rebuilt %d tag indexes on %s in %.2f ms"),
+			TableTags.Fields.Num(), *Table->GetName(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	if (TUniquePtr<FFieldIndex>* Existing = TableTags.Fields.Find(Field))
+	{
+		return Existing->Get();
+	}
+
+	TUniquePtr<FFieldIndex> FieldIndex = MakeUnique<FFieldIndex>();
+	FieldIndex->Property = FindTagProperty(TableTags.RowStruct, Field, FieldIndex->bContainer);
+	if (FieldIndex->Property == nullptr)
+	{
+		if (TableTags.Fields.Num() == 0)
+		{
+			Tables.Remove(Table);
+		}
+		return nullptr;
+	}
+
+	TableTags.BuildField(Table, *FieldIndex);
+	return TableTags.Fields.Add(Field, MoveTemp(FieldIndex)).Get();
+}
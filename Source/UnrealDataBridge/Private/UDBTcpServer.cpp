@@ -1,11 +1,13 @@
 
 #include "UDBTcpServer.h"
 #include "UDBCommandHandler.h"
+#include "UDBMsgPack.h"
 #include "UDBSettings.h"
 #include "Common/TcpListener.h"
 #include "SocketSubsystem.h"
 #include "Sockets.h"
 #include "Containers/Ticker.h"
+#include "Misc/MemStack.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
@@ -100,7 +102,7 @@ bool FUDBTcpServer::HandleConnectionAccepted(FSocket* InClientSocket, const FIPv
 {
 	UE_LOG(LogUDBTcpServer, Log, TEXT("Client connected from %s (total clients: %d)"), *ClientEndpoint.ToString(), ClientSockets.Num() + 1);
 	ClientSockets.Add(InClientSocket);
-	ReceiveBuffers.Add(InClientSocket, FString());
+	ReceiveBuffers.Add(InClientSocket, TArray<uint8>());
 	return true;
 }
 
@@ -154,16 +156,71 @@ bool FUDBTcpServer::ProcessSingleClient(FSocket* InClientSocket)
 		return true;
 	}
 
-	FString& ClientBuffer = ReceiveBuffers.FindOrAdd(InClientSocket);
-	FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(TempBuffer.GetData()), BytesRead);
-	ClientBuffer.Append(Converter.Get(), Converter.Length());
+	TArray<uint8>& ClientBuffer = ReceiveBuffers.FindOrAdd(InClientSocket);
+	ClientBuffer.Append(TempBuffer.GetData(), BytesRead);
 
-	// Process complete lines (delimited by \n)
-	int32 NewlineIndex = INDEX_NONE;
-	while (ClientBuffer.FindChar(TEXT('\n'), NewlineIndex))
+	// Process complete requests: MessagePack frames or newline-delimited JSON lines
+	int32 Consumed = 0;
+	bool bKeepClient = true;
+	while (Consumed < ClientBuffer.Num())
 	{
-		FString Line = ClientBuffer.Left(NewlineIndex);
-		ClientBuffer.RemoveAt(0, NewlineIndex + 1);
+		const uint8* Pending = ClientBuffer.GetData() + Consumed;
+		const int32 NumPending = ClientBuffer.Num() - Consumed;
+
+		if (Pending[0] == MsgPackFrameMarker)
+		{
+			if (NumPending < MsgPackFrameHeaderSize)
+			{
+				break;
+			}
+
+			const uint32 PayloadSize = (static_cast<uint32>(Pending[1]) << 24) | (static_cast<uint32>(Pending[2]) << 16)
+				| (static_cast<uint32>(Pending[3]) << 8) | static_cast<uint32>(Pending[4]);
+			if (PayloadSize > MaxMsgPackFrameSize)
+			{
+				// The stream can't be resynchronized past a bogus length, so drop the client
+				UE_LOG(LogUDBTcpServer, Warning, TEXT("MessagePack frame of %u bytes exceeds limit, disconnecting client"), PayloadSize);
+				SendResult(InClientSocket, FUDBCommandHandler::Error(TEXT("PARSE_ERROR"), TEXT("MessagePack frame too large")), 0.0, EUDBWireEncoding::MsgPack);
+				bKeepClient = false;
+				Consumed = ClientBuffer.Num();
+				break;
+			}
+			if (static_cast<uint32>(NumPending - MsgPackFrameHeaderSize) < PayloadSize)
+			{
+				break;
+			}
+
+			TSharedPtr<FJsonObject> RequestJson;
+			FString DecodeError;
+			const bool bDecoded = FUDBMsgPackReader::ReadObject(
+				Pending + MsgPackFrameHeaderSize, static_cast<int32>(PayloadSize), RequestJson, DecodeError);
+			Consumed += MsgPackFrameHeaderSize + static_cast<int32>(PayloadSize);
+
+			if (!bDecoded)
+			{
+				UE_LOG(LogUDBTcpServer, Warning, TEXT("Failed to parse MessagePack request: %s"), *DecodeError);
+				FUDBCommandResult ParseError = FUDBCommandHandler::Error(
+					TEXT("PARSE_ERROR"),
+					FString::Printf(TEXT("Failed to parse MessagePack request: %s"), *DecodeError)
+				);
+				SendResult(InClientSocket, ParseError, 0.0, EUDBWireEncoding::MsgPack);
+				continue;
+			}
+
+			ExecuteRequest(InClientSocket, RequestJson, EUDBWireEncoding::MsgPack);
+			continue;
+		}
+
+		const uint8* Newline = static_cast<const uint8*>(FMemory::Memchr(Pending, '\n', NumPending));
+		if (Newline == nullptr)
+		{
+			break;
+		}
+
+		const int32 LineLength = static_cast<int32>(Newline - Pending);
+		FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Pending), LineLength);
+		FString Line(Converter.Length(), Converter.Get());
+		Consumed += LineLength + 1;
 
 		Line.TrimStartAndEndInline();
 		if (Line.IsEmpty())
@@ -182,117 +239,151 @@ bool FUDBTcpServer::ProcessSingleClient(FSocket* InClientSocket)
 				TEXT("PARSE_ERROR"),
 				TEXT("Failed to parse JSON request")
 			);
-			SendResponse(InClientSocket, FUDBCommandHandler::ResultToJson(ParseError, 0.0));
+			SendResult(InClientSocket, ParseError, 0.0, EUDBWireEncoding::Json);
 			continue;
 		}
 
-		// Extract command
-		FString Command;
-		if (!RequestJson->TryGetStringField(TEXT("command"), Command))
-		{
-			UE_LOG(LogUDBTcpServer, Warning, TEXT("JSON missing 'command' field: %s"), *Line);
-			FUDBCommandResult MissingCmd = FUDBCommandHandler::Error(
-				TEXT("MISSING_COMMAND"),
-				TEXT("JSON request missing 'command' field")
-			);
-			SendResponse(InClientSocket, FUDBCommandHandler::ResultToJson(MissingCmd, 0.0));
-			continue;
-		}
+		ExecuteRequest(InClientSocket, RequestJson, EUDBWireEncoding::Json);
+	}
 
-		// Extract params (optional)
-		const TSharedPtr<FJsonObject>* ParamsPtr = nullptr;
-		TSharedPtr<FJsonObject> Params;
-		if (RequestJson->TryGetObjectField(TEXT("params"), ParamsPtr) && ParamsPtr != nullptr)
+	if (Consumed > 0)
+	{
+		ClientBuffer.RemoveAt(0, Consumed);
+	}
+
+	return bKeepClient;
+}
+
+void FUDBTcpServer::ExecuteRequest(FSocket* InClientSocket, const TSharedPtr<FJsonObject>& RequestJson, EUDBWireEncoding Encoding)
+{
+	// Request arena: handler scratch bump-allocated from the game thread's mem stack
+	// (TMemStackAllocator) is released in one step once the response has been sent
+	FMemMark RequestMark(FMemStack::Get());
+
+	// Extract command
+	FString Command;
+	if (!RequestJson->TryGetStringField(TEXT("command"), Command))
+	{
+		UE_LOG(LogUDBTcpServer, Warning, TEXT("Request missing 'command' field"));
+		FUDBCommandResult MissingCmd = FUDBCommandHandler::Error(
+			TEXT("MISSING_COMMAND"),
+			TEXT("JSON request missing 'command' field")
+		);
+		SendResult(InClientSocket, MissingCmd, 0.0, Encoding);
+		return;
+	}
+
+	// Extract params (optional)
+	const TSharedPtr<FJsonObject>* ParamsPtr = nullptr;
+	TSharedPtr<FJsonObject> Params;
+	if (RequestJson->TryGetObjectField(TEXT("params"), ParamsPtr) && ParamsPtr != nullptr)
+	{
+		Params = *ParamsPtr;
+	}
+
+	// Verbose logging: log incoming command
+	const bool bLogCommands = UUDBSettings::Get()->bLogCommands;
+	if (bLogCommands)
+	{
+		FString ParamsString;
+		if (Params.IsValid())
 		{
-			Params = *ParamsPtr;
+			TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+				TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ParamsString);
+			FJsonSerializer::Serialize(Params.ToSharedRef(), Writer);
 		}
-
-		// Verbose logging: log incoming command
-		const bool bLogCommands = UUDBSettings::Get()->bLogCommands;
-		if (bLogCommands)
+		constexpr int32 MaxParamsLength = 200;
+		if (ParamsString.Len() > MaxParamsLength)
 		{
-			FString ParamsString;
-			if (Params.IsValid())
-			{
-				TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
-					TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ParamsString);
-				FJsonSerializer::Serialize(Params.ToSharedRef(), Writer);
-			}
-			constexpr int32 MaxParamsLength = 200;
-			if (ParamsString.Len() > MaxParamsLength)
-			{
-				ParamsString = ParamsString.Left(MaxParamsLength) + TEXT("...");
-			}
-			UE_LOG(LogUDBTcpServer, Log, TEXT("[UDB] <- %s %s"), *Command, *ParamsString);
+			ParamsString = ParamsString.Left(MaxParamsLength) + TEXT("...");
 		}
+		UE_LOG(LogUDBTcpServer, Log, TEXT("[UDB] <- %s %s%s"), *Command, *ParamsString,
+			Encoding == EUDBWireEncoding::MsgPack ? TEXT(" [msgpack]") : TEXT(""));
+	}
 
-		// Execute command with timing
-		const double StartTime = FPlatformTime::Seconds();
-		FUDBCommandResult Result = CommandHandler.Execute(Command, Params);
-		const double EndTime = FPlatformTime::Seconds();
-		const double TimingMs = (EndTime - StartTime) * 1000.0;
-		const double TimingSeconds = EndTime - StartTime;
+	// Execute command with timing
+	const double StartTime = FPlatformTime::Seconds();
+	FUDBCommandResult Result = CommandHandler.Execute(Command, Params);
+	const double EndTime = FPlatformTime::Seconds();
+	const double TimingMs = (EndTime - StartTime) * 1000.0;
+	const double TimingSeconds = EndTime - StartTime;
 
-		if (TimingSeconds > CommandTimeoutWarningSeconds)
-		{
-			UE_LOG(LogUDBTcpServer, Warning, TEXT("Command '%s' took %.1fs (threshold: %.0fs)"), *Command, TimingSeconds, CommandTimeoutWarningSeconds);
-		}
+	if (TimingSeconds > CommandTimeoutWarningSeconds)
+	{
+		UE_LOG(LogUDBTcpServer, Warning, TEXT("Command '%s' took %.1fs (threshold: %.0fs)"), *Command, TimingSeconds, CommandTimeoutWarningSeconds);
+	}
 
-		// Verbose logging: log command result
-		if (bLogCommands)
+	// Verbose logging: log command result
+	if (bLogCommands)
+	{
+		if (Result.bSuccess)
 		{
-			if (Result.bSuccess)
+			// Try to find a countable array in the result data
+			int32 ResultCount = -1;
+			if (Result.Data.IsValid())
 			{
-				// Try to find a countable array in the result data
-				int32 ResultCount = -1;
-				if (Result.Data.IsValid())
+				for (const auto& Pair : Result.Data->Values)
 				{
-					for (const auto& Pair : Result.Data->Values)
+					if (Pair.Value.IsValid() && Pair.Value->Type == EJson::Array)
 					{
-						if (Pair.Value.IsValid() && Pair.Value->Type == EJson::Array)
-						{
-							ResultCount = Pair.Value->AsArray().Num();
-							break;
-						}
+						ResultCount = Pair.Value->AsArray().Num();
+						break;
 					}
 				}
+			}
 
-				if (ResultCount >= 0)
-				{
-					UE_LOG(LogUDBTcpServer, Log, TEXT("[UDB] -> SUCCESS (%.1fms, %d results)"), TimingMs, ResultCount);
-				}
-				else
-				{
-					UE_LOG(LogUDBTcpServer, Log, TEXT("[UDB] -> SUCCESS (%.1fms)"), TimingMs);
-				}
+			if (ResultCount >= 0)
+			{
+				UE_LOG(LogUDBTcpServer, Log, TEXT("[UDB] -> SUCCESS (%.1fms, %d results)"), TimingMs, ResultCount);
 			}
 			else
 			{
-				UE_LOG(LogUDBTcpServer, Log, TEXT("[UDB] -> ERROR %s (%.1fms)"), *Result.ErrorCode, TimingMs);
+				UE_LOG(LogUDBTcpServer, Log, TEXT("[UDB] -> SUCCESS (%.1fms)"), TimingMs);
 			}
 		}
+		else
+		{
+			UE_LOG(LogUDBTcpServer, Log, TEXT("[UDB] -> ERROR %s (%.1fms)"), *Result.ErrorCode, TimingMs);
+		}
+	}
+
+	SendResult(InClientSocket, Result, TimingMs, Encoding);
+}
 
-		SendResponse(InClientSocket, FUDBCommandHandler::ResultToJson(Result, TimingMs));
+void FUDBTcpServer::SendResult(FSocket* InClientSocket, const FUDBCommandResult& Result, double TimingMs, EUDBWireEncoding Encoding)
+{
+	if (Encoding == EUDBWireEncoding::MsgPack)
+	{
+		// Reserve the frame header, encode, then patch in the payload length
+		MsgPackResponseBuffer.Reset();
+		MsgPackResponseBuffer.AddZeroed(MsgPackFrameHeaderSize);
+		FUDBCommandHandler::ResultToMsgPack(Result, TimingMs, MsgPackResponseBuffer);
+
+		const uint32 PayloadSize = static_cast<uint32>(MsgPackResponseBuffer.Num() - MsgPackFrameHeaderSize);
+		MsgPackResponseBuffer[0] = MsgPackFrameMarker;
+		MsgPackResponseBuffer[1] = static_cast<uint8>(PayloadSize >> 24);
+		MsgPackResponseBuffer[2] = static_cast<uint8>(PayloadSize >> 16);
+		MsgPackResponseBuffer[3] = static_cast<uint8>(PayloadSize >> 8);
+		MsgPackResponseBuffer[4] = static_cast<uint8>(PayloadSize);
+		SendResponse(InClientSocket, MsgPackResponseBuffer.GetData(), MsgPackResponseBuffer.Num());
+		return;
 	}
 
-	return true;
+	ResponseBuffer.Reset();
+	FUDBCommandHandler::ResultToUtf8(Result, TimingMs, ResponseBuffer);
+	ResponseBuffer.Add('\n');
+	SendResponse(InClientSocket, reinterpret_cast<const uint8*>(ResponseBuffer.GetData()), ResponseBuffer.Num());
 }
 
-void FUDBTcpServer::SendResponse(FSocket* InClientSocket, const FString& ResponseString)
+void FUDBTcpServer::SendResponse(FSocket* InClientSocket, const uint8* Data, int32 Num)
 {
 	if (InClientSocket == nullptr)
 	{
 		return;
 	}
 
-	FString ResponseWithNewline = ResponseString + TEXT("\n");
-	FTCHARToUTF8 Utf8Response(*ResponseWithNewline);
-
 	int32 BytesSent = 0;
-	if (!InClientSocket->Send(
-		reinterpret_cast<const uint8*>(Utf8Response.Get()),
-		Utf8Response.Length(),
-		BytesSent))
+	if (!InClientSocket->Send(Data, Num, BytesSent))
 	{
 		UE_LOG(LogUDBTcpServer, Warning, TEXT("Failed to send response"));
 	}
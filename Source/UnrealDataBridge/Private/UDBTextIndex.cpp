@@ -0,0 +1,252 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBTextIndex.h"
+#include "UDBSettings.h"
+#include "Engine/DataTable.h"
+#include "UObject/TextProperty.h"
+#include "Internationalization/Text.h"
+#include "UObject/SoftObjectPath.h"
+#include "GameplayTagContainer.h"
+#include "StructUtils/InstancedStruct.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUDBTextIndex, Log, All);
+
+TMap<const UDataTable*, TUniquePtr<FUDBTextIndex::FTableText>> FUDBTextIndex::Tables;
+
+namespace UDBTextIndexPrivate
+{
+	/** Three folded characters, 21 bits each so any code unit width fits */
+	static uint64 MakeTrigram(const TCHAR* Chars)
+	{
+		auto Fold = [](TCHAR Char) { return uint64(uint32(FChar::ToLower(Char)) & 0x1FFFFF); };
+		return (Fold(Chars[0]) << 42) | (Fold(Chars[1]) << 21) | Fold(Chars[2]);
+	}
+
+	static void AddTrigrams(const FString& Text, TArray<uint64>& OutTrigrams)
+	{
+		const TCHAR* Chars = *Text;
+		for (int32 Index = 0; Index + 3 <= Text.Len(); ++Index)
+		{
+			OutTrigrams.Add(MakeTrigram(Chars + Index));
+		}
+	}
+
+	/**
+	 * Trigrams of every field search_datatable_content looks at: FText (source string when there is
+	 * one), FString and FName, recursing into nested structs other than tags, soft paths and
+	 * instanced structs. Arrays are not searched and so not indexed.
+	 */
+	static void CollectTrigrams(const UStruct* StructType, const void* StructData, TArray<uint64>& OutTrigrams)
+	{
+		for (TFieldIterator<FProperty> It(StructType); It; ++It)
+		{
+			const FProperty* Property = *It;
+			const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(StructData);
+
+			if (const FTextProperty* TextProp = CastField<FTextProperty>(Property))
+			{
+				const FText& TextVal = TextProp->GetPropertyValue(ValuePtr);
+				const FString* SourceString = FTextInspector::GetSourceString(TextVal);
+				AddTrigrams(SourceString != nullptr && !SourceString->IsEmpty() ? *SourceString : TextVal.ToString(), OutTrigrams);
+			}
+			else if (const FStrProperty* StrProp = CastField<FStrProperty>(Property))
+			{
+				AddTrigrams(StrProp->GetPropertyValue(ValuePtr), OutTrigrams);
+			}
+			else if (const FNameProperty* NameProp = CastField<FNameProperty>(Property))
+			{
+				AddTrigrams(NameProp->GetPropertyValue(ValuePtr).ToString(), OutTrigrams);
+			}
+			else if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+			{
+				const UScriptStruct* InnerStruct = StructProp->Struct;
+				if (InnerStruct != FGameplayTag::StaticStruct()
+					&& InnerStruct != TBaseStructure<FSoftObjectPath>::Get()
+					&& InnerStruct != FInstancedStruct::StaticStruct())
+				{
+					CollectTrigrams(InnerStruct, ValuePtr, OutTrigrams);
+				}
+			}
+		}
+	}
+
+	/** Distinct trigrams of one row */
+	static void CollectRowTrigrams(const UScriptStruct* RowStruct, const void* RowData, TArray<uint64>& OutTrigrams)
+	{
+		OutTrigrams.Reset();
+		CollectTrigrams(RowStruct, RowData, OutTrigrams);
+		OutTrigrams.Sort();
+		OutTrigrams.SetNum(Algo::Unique(OutTrigrams), EAllowShrinking::No);
+	}
+}
+
+// --- FTableText ---
+
+void FUDBTextIndex::FTableText::Build(const UDataTable* InTable)
+{
+	Stamp(InTable);
+	Postings.Reset();
+	NumPatched = 0;
+
+	Slots.Build(InTable, [this](FName, int32 Position, const uint8* RowData)
+	{
+		AddRow(Position, RowData, true);
+	});
+}
+
+void FUDBTextIndex::FTableText::AddRow(int32 Position, const void* RowData, bool bAppend)
+{
+	TArray<uint64> Trigrams;
+	UDBTextIndexPrivate::CollectRowTrigrams(RowStruct, RowData, Trigrams);
+
+	for (const uint64 Trigram : Trigrams)
+	{
+		TArray<int32>& Posting = Postings.FindOrAdd(Trigram);
+		if (bAppend)
+		{
+			Posting.Add(Position);
+			continue;
+		}
+
+		const int32 Slot = Algo::LowerBound(Posting, Position);
+		if (Slot == Posting.Num() || Posting[Slot] != Position)
+		{
+			Posting.Insert(Position, Slot);
+		}
+	}
+}
+
+// --- FUDBTextIndex ---
+
+bool FUDBTextIndex::IsEnabled(const UDataTable* Table)
+{
+	const int32 Threshold = UUDBSettings::Get()->SearchIndexMinRows;
+	return Threshold > 0 && Table != nullptr && Table->GetRowStruct() != nullptr && Table->GetRowMap().Num() >= Threshold;
+}
+
+bool FUDBTextIndex::FindCandidates(const UDataTable* Table, const FString& SearchText, TArray<FName>& OutRows)
+{
+	if (SearchText.Len() < MinSearchLength)
+	{
+		return false;
+	}
+
+	const FTableText* Text = Refresh(Table);
+	if (Text == nullptr)
+	{
+		return false;
+	}
+
+	// Intersect from the shortest posting list; a trigram nobody has means no candidates
+	TArray<const TArray<int32>*> Lists;
+	for (int32 Index = 0; Index + 3 <= SearchText.Len(); ++Index)
+	{
+		const TArray<int32>* Posting = Text->Postings.Find(UDBTextIndexPrivate::MakeTrigram(*SearchText + Index));
+		if (Posting == nullptr)
+		{
+			OutRows.Reset();
+			return true;
+		}
+		Lists.AddUnique(Posting);
+	}
+	Lists.Sort([](const TArray<int32>& A, const TArray<int32>& B) { return A.Num() < B.Num(); });
+
+	TArray<int32> Positions = *Lists[0];
+	for (int32 ListIndex = 1; ListIndex < Lists.Num() && Positions.Num() > 0; ++ListIndex)
+	{
+		const TArray<int32>& Other = *Lists[ListIndex];
+		int32 Kept = 0;
+		int32 OtherPos = 0;
+		for (const int32 Position : Positions)
+		{
+			while (OtherPos < Other.Num() && Other[OtherPos] < Position)
+			{
+				++OtherPos;
+			}
+			if (OtherPos == Other.Num())
+			{
+				break;
+			}
+			if (Other[OtherPos] == Position)
+			{
+				Positions[Kept++] = Position;
+			}
+		}
+		Positions.SetNum(Kept, EAllowShrinking::No);
+	}
+
+	OutRows.Reset(Positions.Num());
+	for (const int32 Position : Positions)
+	{
+		if (!Text->Slots.RowNames[Position].IsNone())
+		{
+			OutRows.Add(Text->Slots.RowNames[Position]);
+		}
+	}
+	return true;
+}
+
+bool FUDBTextIndex::Contains(const UDataTable* Table)
+{
+	return FUDBTableCacheEntry::Find(Tables, Table) != nullptr;
+}
+
+void FUDBTextIndex::ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows)
+{
+	FTableText* Text = FUDBTableCacheEntry::Find(Tables, Table);
+	if (Text == nullptr || !Text->CanPatch(Table, StartGeneration))
+	{
+		return;
+	}
+
+	// A freed position keeps its trigrams until the next build; verification skips it
+	for (const FName& RowName : RemovedRows)
+	{
+		Text->Slots.Remove(RowName);
+	}
+	for (const FName& RowName : ChangedRows)
+	{
+		const int32 Position = Text->Slots.Place(Table, RowName, [](int32) {});
+		if (Position == INDEX_NONE)
+		{
+			continue;
+		}
+
+		// New rows may land in a freed slot mid-table, so their positions are inserted in order
+		Text->AddRow(Position, Table->FindRowUnchecked(RowName), false);
+		++Text->NumPatched;
+	}
+	Text->Stamp(Table);
+}
+
+void FUDBTextIndex::Reset()
+{
+	if (Tables.Num() > 0)
+	{
+		UE_LOG(LogUDBTextIndex, Log, TEXT("Dropped text indexes of %d tables"), Tables.Num());
+	}
+	Tables.Empty();
+}
+
+FUDBTextIndex::FTableText* FUDBTextIndex::Refresh(const UDataTable* Table)
+{
+	if (!IsEnabled(Table))
+	{
+		Tables.Remove(Table);
+		return nullptr;
+	}
+
+	// Rebuild when stale, or when patched rows' leftover trigrams start to cost more than a build
+	FTableText& Text = FUDBTableCacheEntry::FindOrAdd(Tables, Table);
+	if (!Text.IsCurrent(Table) || Text.NumPatched > Text.Slots.RowPositions.Num() / 4)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Text.Build(Table);
+		UE_LOG(LogUDBTextIndex, Verbose, TEXT("Indexed text of %s: %d rows, %d trigrams in %.2f ms"),
+			*Table->GetName(), Text.Slots.RowPositions.Num(), Text.Postings.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+	return &Text;
+}
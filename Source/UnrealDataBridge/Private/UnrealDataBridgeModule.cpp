@@ -2,15 +2,62 @@
 #include "UnrealDataBridgeModule.h"
 #include "UDBSettings.h"
 #include "UDBTcpServer.h"
+#include "UDBSchemaCache.h"
+#include "UDBRowCache.h"
+#include "UDBTableVersions.h"
+#include "UDBTableIndexes.h"
+#include "UDBColumnStore.h"
+#include "UDBTextIndex.h"
+#include "UDBTagIndex.h"
+#include "UDBCompositeLayout.h"
+#include "UDBRowNameIndex.h"
+#include "UDBQueryCursors.h"
+#include "UDBSerializer.h"
+#include "Kismet2/StructureEditorUtils.h"
 
 #define LOCTEXT_NAMESPACE "FUnrealDataBridgeModule"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUnrealDataBridge, Log, All);
 
+/** Drops the module's reflection caches once a user-defined struct's fields were edited */
+class FUDBStructChangeListener : public FStructureEditorUtils::FStructEditorManager::ListenerType
+{
+public:
+	explicit FUDBStructChangeListener(FUnrealDataBridgeModule& InModule)
+		: Module(InModule)
+	{
+	}
+
+	virtual void PreChange(const UUserDefinedStruct* Changed, FStructureEditorUtils::EStructureEditorChangeInfo ChangedType) override
+	{
+	}
+
+	virtual void PostChange(const UUserDefinedStruct* Changed, FStructureEditorUtils::EStructureEditorChangeInfo ChangedType) override
+	{
+		UE_LOG(LogUnrealDataBridge, Verbose, TEXT("%s changed; dropping reflection caches"), Changed != nullptr ? *Changed->GetName() : TEXT("Struct"));
+		Module.InvalidateReflectionCaches();
+	}
+
+private:
+	FUnrealDataBridgeModule& Module;
+};
+
 void FUnrealDataBridgeModule::StartupModule()
 {
 	UE_LOG(LogUnrealDataBridge, Log, TEXT("UnrealDataBridge module starting up"));
 
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FUnrealDataBridgeModule::HandleReloadComplete);
+	ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddRaw(this, &FUnrealDataBridgeModule::HandleObjectsReinstanced);
+	ObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddStatic(&FUDBTableVersions::HandleObjectTransacted);
+	StructChangeListener = MakeUnique<FUDBStructChangeListener>(*this);
+
+	// Caches patched in place by the plugin's own row writes
+	FUDBTableIndexes::AddRowChangeListener({ &FUDBColumnStore::Contains, &FUDBColumnStore::ApplyRowChanges });
+	FUDBTableIndexes::AddRowChangeListener({ &FUDBTextIndex::Contains, &FUDBTextIndex::ApplyRowChanges });
+	FUDBTableIndexes::AddRowChangeListener({ &FUDBTagIndex::Contains, &FUDBTagIndex::ApplyRowChanges });
+	FUDBTableIndexes::AddRowChangeListener({ &FUDBCompositeLayout::Contains, &FUDBCompositeLayout::ApplyRowChanges });
+	FUDBTableIndexes::AddRowChangeListener({ &FUDBRowNameIndex::Contains, &FUDBRowNameIndex::ApplyRowChanges });
+
 	const UUDBSettings* Settings = UUDBSettings::Get();
 	if (!Settings->bAutoStart)
 	{
@@ -34,6 +81,21 @@ void FUnrealDataBridgeModule::ShutdownModule()
 {
 	UE_LOG(LogUnrealDataBridge, Log, TEXT("UnrealDataBridge module shutting down"));
 
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+	FCoreUObjectDelegates::OnObjectTransacted.Remove(ObjectTransactedHandle);
+	StructChangeListener.Reset();
+	FUDBTableIndexes::RemoveRowChangeListeners();
+	FUDBRowCache::Reset();
+	FUDBTableVersions::Reset();
+	FUDBTableIndexes::Reset();
+	FUDBColumnStore::Reset();
+	FUDBTextIndex::Reset();
+	FUDBTagIndex::Reset();
+	FUDBCompositeLayout::Reset();
+	FUDBRowNameIndex::Reset();
+	FUDBQueryCursors::Reset();
+
 	if (TcpServer.IsValid())
 	{
 		TcpServer->Stop();
@@ -41,6 +103,40 @@ void FUnrealDataBridgeModule::ShutdownModule()
 	}
 }
 
+void FUnrealDataBridgeModule::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+	InvalidateReflectionCaches();
+}
+
+void FUnrealDataBridgeModule::HandleObjectsReinstanced(const TMap<UObject*, UObject*>& OldToNewInstanceMap)
+{
+	for (const TPair<UObject*, UObject*>& Pair : OldToNewInstanceMap)
+	{
+		if (Cast<UStruct>(Pair.Key) != nullptr)
+		{
+			InvalidateReflectionCaches();
+			return;
+		}
+	}
+}
+
+void FUnrealDataBridgeModule::InvalidateReflectionCaches()
+{
+	FUDBSchemaCache::Reset();
+	FUDBRowCache::Reset();
+	FUDBTableVersions::Reset();
+	FUDBTableIndexes::Reset();
+	FUDBColumnStore::Reset();
+	FUDBTextIndex::Reset();
+	FUDBTagIndex::Reset();
+	FUDBCompositeLayout::Reset();
+	FUDBRowNameIndex::Reset();
+	FUDBQueryCursors::Reset();
+	FUDBSerializer::ClearSubtypeCache();
+	FUDBSerializer::ClearStructDefaults();
+	FUDBSerializer::ClearNumericStructLayouts();
+}
+
 #undef LOCTEXT_NAMESPACE
 
 IMPLEMENT_MODULE(FUnrealDataBridgeModule, UnrealDataBridge)
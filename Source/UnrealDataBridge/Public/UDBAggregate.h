@@ -0,0 +1,105 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "UDBRowFilter.h"
+
+class UStruct;
+
+/**
+ * Aggregates over DataTable rows, compiled against the row struct and computed directly on row memory.
+ *
+ * Metrics:
+ *   count                   rows (per group)
+ *   count(Path)             values of Path (array paths count elements)
+ *   sum/avg/min/max(Path)   numbers and bools (true = 1)
+ *   distinct(Path)          number of distinct values (strings case-insensitive, tag containers per tag)
+ *   histogram(Path[, N])    numbers: N equal-width buckets (default 10); anything else: count per value
+ *
+ * Optional group-by paths (single-valued) split the rows; groups are reported in order of first appearance.
+ */
+class UNREALDATABRIDGE_API FUDBAggregate
+{
+public:
+	/** Compile metric specs and group-by paths. Returns null and sets OutError on invalid input. */
+	static TSharedPtr<const FUDBAggregate> Compile(const UStruct* StructType, const TArray<FString>& MetricSpecs, const TArray<FString>& GroupByPaths, FString& OutError);
+
+	/**
+	 * Reduce rows into {"aggregates": {...}} or, with group-by, {"groups": [{"group": {...}, ...}], "group_count"}.
+	 * With NumChunks > 1 the rows are split into contiguous chunks reduced in parallel and merged in order.
+	 */
+	TSharedPtr<FJsonObject> Run(TConstArrayView<const void*> Rows, int32 NumChunks) const;
+
+	/**
+	 * The column each metric reads when the whole aggregate can run on column copies (FUDBColumnStore):
+	 * no group-by and only count, sum/avg/min/max and numeric histograms of single-valued fields.
+	 * Entries are null for metrics that need no column. Returns false otherwise.
+	 */
+	bool GetColumnAccessors(TArray<const FUDBRowFilter::FAccessor*>& OutAccessors) const;
+
+	/** Same result as Run, reduced over one column per metric (as from GetColumnAccessors) for the rows whose Mask is 1 */
+	TSharedPtr<FJsonObject> RunOnColumns(TConstArrayView<TConstArrayView<double>> MetricColumns, TConstArrayView<uint8> Mask) const;
+
+private:
+	enum class EMetric : uint8
+	{
+		Count,
+		CountValues,
+		Sum,
+		Avg,
+		Min,
+		Max,
+		Distinct,
+		Histogram,
+	};
+
+	struct FMetric
+	{
+		EMetric Type = EMetric::Count;
+		FString Name;
+		FUDBRowFilter::FAccessor Accessor;
+		int32 NumBuckets = 10;
+
+		/** Numeric histograms bucket values; every other histogram counts values */
+		bool IsNumericHistogram() const;
+	};
+
+	/** Running state of one metric in one group */
+	struct FMetricState
+	{
+		int64 Count = 0;
+		double Sum = 0.0;
+		double Min = TNumericLimits<double>::Max();
+		double Max = TNumericLimits<double>::Lowest();
+		TSet<FString> Distinct;
+		TArray<double> Values;
+		TArray<TPair<FString, int64>> Categories;
+		TMap<FString, int32> CategoryIndices;
+
+		void AddCategory(const FString& Category, int64 Amount);
+	};
+
+	struct FGroupState
+	{
+		TArray<FString> KeyParts;
+		int64 RowCount = 0;
+		TArray<FMetricState> Metrics;
+	};
+
+	/** One chunk's groups, in order of first appearance */
+	struct FPartial
+	{
+		TArray<FGroupState> Groups;
+		TMap<FString, int32> GroupIndices;
+	};
+
+	void Accumulate(const void* RowData, FPartial& Partial) const;
+	void AccumulateMetric(const FMetric& Metric, const void* RowData, FMetricState& State) const;
+	void Merge(FPartial&& Source, FPartial& Target) const;
+	TSharedPtr<FJsonObject> MakeGroupJson(const FGroupState& Group) const;
+
+	TArray<FMetric> Metrics;
+	TArray<FUDBRowFilter::FAccessor> GroupBy;
+};
@@ -0,0 +1,97 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UDBRowFilter.h"
+#include "UDBRoaringBitmap.h"
+#include "UDBTableCache.h"
+
+class UDataTable;
+class UScriptStruct;
+struct FUDBIndexLookup;
+
+/**
+ * Bitmap indexes (create_index type "bitmap") on low-cardinality enum, bool, gameplay tag and tag
+ * container fields: one compressed bitmap of row positions per distinct value (per tag for
+ * containers). All bitmap indexes of a table share one row numbering, so a `where` expression whose
+ * conditions are all bitmap-indexed is answered by AND/OR/NOT over 64-row words without touching a
+ * row; otherwise the indexed top-level conditions are intersected into a candidate set.
+ *
+ * Kept current the same way as FUDBTableIndexes: patched by FScopedRowChanges for the plugin's own
+ * writes, rebuilt on next use after any other change. Game thread only; reached through
+ * FUDBTableIndexes.
+ */
+class UNREALDATABRIDGE_API FUDBBitmapIndexes
+{
+public:
+	/** More distinct values than this and a hash index is the better fit */
+	static constexpr int32 MaxDistinctValues = 1024;
+
+	/** Build (or rebuild) a bitmap index on Field. Returns false and sets OutError for unsupported fields. */
+	static bool CreateIndex(const UDataTable* Table, const FString& Field, int32& OutNumRows, int32& OutNumKeys, FString& OutError);
+
+	static bool DropIndex(const UDataTable* Table, const FString& Field);
+
+	/** Bitmap-indexed fields of a table */
+	static TArray<FString> GetIndexes(const UDataTable* Table);
+
+	/**
+	 * Rows selected by the bitmap-indexed parts of a filter, in table order: the exact matches when every
+	 * condition is indexed, else the intersection of the indexed top-level conditions. False if none is.
+	 */
+	static bool FindCandidates(const UDataTable* Table, const FUDBRowFilter& Filter, FUDBIndexLookup& OutLookup);
+
+	static bool Contains(const UDataTable* Table);
+	static void ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows);
+	static void Reset();
+
+private:
+	/** One distinct value and the rows that have it */
+	struct FValue
+	{
+		double Number = 0.0;
+		FString String;
+		FUDBRoaringBitmap Rows;
+	};
+
+	struct FIndex
+	{
+		FString Field;
+		FUDBRowFilter::FAccessor Accessor;
+		TArray<FValue> Values;
+		TMap<FString, int32> ValueIndices;
+
+		void Insert(uint32 Position, const void* RowData);
+		void Remove(uint32 Position);
+
+		/** Rows satisfying one condition on this field into Words; false if the operator is not served */
+		bool Evaluate(const FUDBRowFilter::FNode& Condition, TArrayView<uint64> Words) const;
+	};
+
+	struct FTableBitmaps : FUDBTableCacheEntry
+	{
+		/** Row numbering shared by every index */
+		FUDBRowSlots Slots;
+		FUDBRoaringBitmap LiveRows;
+
+		TArray<TUniquePtr<FIndex>> Indexes;
+
+		FIndex* FindIndex(const FString& Field) const;
+		void Rebuild(const UDataTable* InTable);
+		void RemoveRow(FName RowName);
+
+		/** Clear a position no row holds any more */
+		void FreePosition(uint32 Position);
+	};
+
+	static bool ResolveField(const UScriptStruct* RowStruct, const FString& Field, FUDBRowFilter::FAccessor& OutAccessor, FString& OutError);
+
+	/** Bring a table's bitmaps up to date; false if none are left */
+	static bool Refresh(const UDataTable* Table, FTableBitmaps& Bitmaps);
+
+	/** Evaluate a subtree into Words; false if any condition in it is not indexed */
+	static bool EvaluateNode(const FTableBitmaps& Bitmaps, const TArray<FUDBRowFilter::FNode>& Nodes, int32 NodeIndex, TArray<uint64>& Words, TSet<FString>& OutFields);
+
+	static TMap<const UDataTable*, TUniquePtr<FTableBitmaps>> Tables;
+};
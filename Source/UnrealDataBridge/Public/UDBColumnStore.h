@@ -0,0 +1,88 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UDBRowFilter.h"
+#include "UDBTableCache.h"
+
+class UDataTable;
+class UScriptStruct;
+
+/**
+ * Column-wise copies of the number, enum and bool fields of large DataTables (ColumnStoreMinRows),
+ * so `where` filters and aggregates on them run as tight loops over contiguous arrays instead of
+ * row-map iteration and per-row field reads. Each single-valued field path becomes a column of
+ * doubles on first use; rows are kept in table order.
+ *
+ * Like FUDBTableIndexes, a table's columns remember the generation they reflect: the plugin's own
+ * row updates patch them in place through FUDBTableIndexes::FScopedRowChanges, anything else
+ * (editor edits, added or removed rows, undo/redo) rebuilds them on next use. Game thread only.
+ */
+class UNREALDATABRIDGE_API FUDBColumnStore
+{
+public:
+	/** Rows of a table in table order and which of them passed a filter (1) or not (0) */
+	struct FScan
+	{
+		TConstArrayView<FName> RowNames;
+		TConstArrayView<const uint8*> RowDatas;
+		TArray<uint8> Mask;
+	};
+
+	/** Whether the table is large enough to be mirrored */
+	static bool IsEnabled(const UDataTable* Table);
+
+	/** Whether a path can be a column: single-valued number, enum or bool */
+	static bool IsColumnar(const FUDBRowFilter::FAccessor& Accessor);
+
+	/**
+	 * Evaluate Filter (null: every row) on columns. Returns false when the table is not mirrored or
+	 * any condition needs row data (strings, tags, array paths, contains/matches).
+	 * The views stay valid until the table changes or the store is reset.
+	 */
+	static bool Scan(const UDataTable* Table, const FUDBRowFilter* Filter, FScan& OutScan);
+
+	/** Values of a columnar path, in the row order of Scan; empty if the table is not mirrored */
+	static TConstArrayView<double> GetColumn(const UDataTable* Table, const FUDBRowFilter::FAccessor& Accessor);
+
+	/** Whether the table currently has columns (used to decide if a write must be tracked) */
+	static bool Contains(const UDataTable* Table);
+
+	/** Patch columns after a plugin write, or leave them for a rebuild if that is not possible */
+	static void ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows);
+
+	/** Drop every column */
+	static void Reset();
+
+private:
+	struct FColumn
+	{
+		FUDBRowFilter::FAccessor Accessor;
+		TArray<double> Values;
+
+		void Fill(TConstArrayView<const uint8*> RowDatas);
+	};
+
+	struct FTableColumns : FUDBTableCacheEntry
+	{
+		TArray<FName> RowNames;
+		TArray<const uint8*> RowDatas;
+		TMap<FName, int32> RowIndices;
+
+		/** Keyed by field path; built on first use */
+		TMap<FString, TUniquePtr<FColumn>> Columns;
+
+		FColumn& FindOrAddColumn(const FUDBRowFilter::FAccessor& Accessor);
+	};
+
+	/** Mirror of a table, rebuilt if stale; null if the table is below the threshold */
+	static FTableColumns* Refresh(const UDataTable* Table);
+
+	/** Mask of the rows satisfying one expression node */
+	static void EvaluateNode(FTableColumns& Columns, const TArray<FUDBRowFilter::FNode>& Nodes, int32 NodeIndex, TArray<uint8>& OutMask);
+
+	static bool CanEvaluate(const FUDBRowFilter::FNode& Node);
+
+	static TMap<const UDataTable*, TUniquePtr<FTableColumns>> Tables;
+};
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "UDBJsonWriter.h"
 
 /** Error codes matching the PRD specification */
 namespace UDBErrorCodes
@@ -21,6 +22,7 @@ namespace UDBErrorCodes
 	static const FString CompositeWriteBlocked = TEXT("COMPOSITE_WRITE_BLOCKED");
 	static const FString BatchLimitExceeded = TEXT("BATCH_LIMIT_EXCEEDED");
 	static const FString BatchRecursionBlocked = TEXT("BATCH_RECURSION_BLOCKED");
+	static const FString CursorExpired = TEXT("CURSOR_EXPIRED");
 }
 
 /** Result of a command execution */
@@ -32,6 +34,9 @@ struct UNREALDATABRIDGE_API FUDBCommandResult
 	FString ErrorMessage;
 	TSharedPtr<FJsonObject> ErrorDetails;
 	TArray<FString> Warnings;
+
+	/** Objects in Data that already have a serialized form (e.g. cached schemas); spliced verbatim on send */
+	FUDBJsonFragmentMap PreserializedObjects;
 };
 
 /** Handles routing and execution of TCP commands */
@@ -44,9 +49,21 @@ public:
 	/** Serialize a result to the response envelope JSON string */
 	static FString ResultToJson(const FUDBCommandResult& Result, double TimingMs);
 
+	/** Serialize a result to the response envelope as UTF-8, splicing pre-serialized objects */
+	static void ResultToUtf8(const FUDBCommandResult& Result, double TimingMs, FUDBJsonBytes& OutBuffer);
+
+	/** Serialize a result to the response envelope as MessagePack (same shape as the JSON envelope) */
+	static void ResultToMsgPack(const FUDBCommandResult& Result, double TimingMs, TArray<uint8>& OutBuffer);
+
 	/** Helper to build a success result */
 	static FUDBCommandResult Success(TSharedPtr<FJsonObject> Data);
 
+	/** Helper to build the short result for a conditional read whose content is unchanged: {"not_modified": true, "etag": ...} */
+	static FUDBCommandResult NotModified(const FString& ETag);
+
+	/** True when the request's optional "if_none_match" param equals ETag */
+	static bool MatchesIfNoneMatch(const TSharedPtr<FJsonObject>& Params, const FString& ETag);
+
 	/** Helper to build an error result */
 	static FUDBCommandResult Error(const FString& Code, const FString& Message, TSharedPtr<FJsonObject> Details = nullptr);
 
@@ -0,0 +1,80 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UDBTableCache.h"
+
+class UDataTable;
+class UCompositeDataTable;
+
+/**
+ * Cached row ownership of UCompositeDataTables. A composite's parents are flattened once, nested
+ * composites expanded in place, into its source tables in override order, and every row maps to the
+ * sources that hold it; the last one supplies the composite's row and is where writes go. Resolving a
+ * row then costs one map probe instead of reading ParentTables through reflection and probing each
+ * parent recursively.
+ *
+ * A layout records the generation of every table reached while flattening and is rebuilt on next use
+ * when a source changed or a composite's parent list did. Rows the plugin adds to or removes from a
+ * source (FUDBTableIndexes::FScopedRowChanges) are patched in place. Game thread only.
+ */
+class UNREALDATABRIDGE_API FUDBCompositeLayout
+{
+public:
+	struct FLayout
+	{
+		/** Direct parents, as listed on the composite */
+		TArray<UDataTable*> Parents;
+
+		/** Non-composite tables reachable from the composite, lowest priority first */
+		TArray<UDataTable*> Sources;
+
+		/** Rows in composite order (first appearance across Sources) */
+		TArray<FName> RowNames;
+
+		/** Row -> ascending indices into Sources of the tables holding it; the last one owns the row */
+		TMap<FName, TArray<int32, TInlineAllocator<2>>> Chains;
+	};
+
+	/** Up-to-date layout of a composite, built if missing or stale */
+	static const FLayout* Get(const UCompositeDataTable* Composite);
+
+	/** The source table a composite takes RowName from, or null if no source has it */
+	static UDataTable* FindSourceTable(const UCompositeDataTable* Composite, FName RowName);
+
+	/** ParentTables of a composite, read through reflection (the property is protected) */
+	static TArray<UDataTable*> ReadParentTables(const UCompositeDataTable* Composite);
+
+	/** Whether a cached layout draws rows from the table (used to decide if a write must be tracked) */
+	static bool Contains(const UDataTable* Table);
+
+	/** Add written rows to and drop removed rows from layouts sourcing the table, or leave them for a rebuild */
+	static void ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows);
+
+	/** Drop every layout */
+	static void Reset();
+
+private:
+	/** One table the layout was built from */
+	struct FStamp : FUDBTableCacheEntry
+	{
+		/** Composites only: parents when flattened. A composite's generation also moves when a parent's rows change. */
+		bool bComposite = false;
+		TArray<UDataTable*> Parents;
+	};
+
+	struct FEntry
+	{
+		FLayout Layout;
+		TArray<FStamp> Stamps;
+
+		void Build(const UCompositeDataTable* Composite);
+		void Flatten(const UCompositeDataTable* Composite, TArray<const UCompositeDataTable*>& Visiting);
+
+		/** Whether every table is alive and unchanged; composites whose parents are unchanged are re-stamped */
+		bool IsCurrent();
+	};
+
+	static TMap<const UCompositeDataTable*, TUniquePtr<FEntry>> Composites;
+};
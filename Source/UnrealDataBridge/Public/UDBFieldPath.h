@@ -0,0 +1,106 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FProperty;
+class UStruct;
+
+/** One segment of a dotted field path: a property name, optionally marked "[*]" to address every element */
+struct FUDBFieldPathSegment
+{
+	FString Name;
+	bool bAllElements = false;
+};
+
+/** A parsed field path such as "Stats.Damage" or "Abilities[*].Cooldown" */
+struct UNREALDATABRIDGE_API FUDBFieldPath
+{
+	TArray<FUDBFieldPathSegment> Segments;
+
+	/** Parse a dotted path. Returns false and sets OutError on malformed input. */
+	static bool Parse(const FString& PathString, FUDBFieldPath& OutPath, FString& OutError);
+
+	FString ToString() const;
+};
+
+/**
+ * Tree of requested field paths used to project serialized structs.
+ * A node without children selects the whole value; a node with children selects only those
+ * sub-fields, applied per element for arrays and sets and per value for maps.
+ * An empty root means "no projection" (serialize everything).
+ */
+struct UNREALDATABRIDGE_API FUDBFieldProjection
+{
+	TMap<FString, TSharedPtr<FUDBFieldProjection>> Children;
+
+	/** The path named this node with "[*]", so its field must be an array or set */
+	bool bAllElements = false;
+
+	bool IsEmpty() const
+	{
+		return Children.Num() == 0;
+	}
+
+	/** Child node for a property name, or nullptr if the property is not selected */
+	const FUDBFieldProjection* Find(const FString& Name) const
+	{
+		const TSharedPtr<FUDBFieldProjection>* Child = Children.Find(Name);
+		return Child != nullptr ? Child->Get() : nullptr;
+	}
+
+	/** Select a path. A shorter path that selects a whole value wins over longer paths beneath it. */
+	void AddPath(const FUDBFieldPath& Path);
+
+	/** Order-independent, case-insensitive hash of the selected paths (0 for an empty projection) */
+	uint64 GetHash() const;
+
+	/** Report every "[*]" that names a field of StructType (or of its nested structs) that is not an array or set */
+	void Validate(const UStruct* StructType, TArray<FString>& OutErrors) const;
+
+	/** Build a projection from path strings; malformed paths are skipped and reported in OutErrors */
+	static FUDBFieldProjection FromStrings(const TArray<FString>& PathStrings, TArray<FString>& OutErrors);
+};
+
+/**
+ * A field projection resolved against a concrete struct: the selected properties in declaration order,
+ * each with its narrowed sub-projection. Compile once per request and reuse it for every row, so the
+ * per-row cost is a walk over the selected properties with no name lookups.
+ */
+struct UNREALDATABRIDGE_API FUDBCompiledProjection
+{
+	struct FField
+	{
+		const FProperty* Property = nullptr;
+
+		/** Cached property name, used as the JSON key */
+		FString Name;
+
+		/** Sub-projection compiled against the value's struct (or its element struct); null when the
+		 *  whole value is selected or when the struct is only known per row */
+		TSharedPtr<const FUDBCompiledProjection> Child;
+
+		/** Uncompiled sub-projection; null when the whole value is selected.
+		 *  Used for FInstancedStruct payloads, whose struct differs per row. */
+		TSharedPtr<const FUDBFieldProjection> Source;
+	};
+
+	const UStruct* Struct = nullptr;
+	TArray<FField> Fields;
+
+	/**
+	 * Compile a projection against a struct. Unknown names, and "[*]" on a field that is not an
+	 * array or set, are dropped.
+	 * With bMatchRootNamesAtAnyDepth, single-segment paths also select same-named fields in nested
+	 * structs (search_datatable_content's "fields" semantics).
+	 */
+	static TSharedRef<const FUDBCompiledProjection> Compile(
+		const UStruct* StructType,
+		const FUDBFieldProjection& Projection,
+		bool bMatchRootNamesAtAnyDepth = false);
+
+	/** The struct a sub-projection applies to for a property (unwrapping arrays, sets and map values),
+	 *  or nullptr if the value has no projectable sub-fields */
+	static const UStruct* GetProjectableStruct(const FProperty* Property);
+};
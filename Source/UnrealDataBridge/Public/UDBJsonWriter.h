@@ -0,0 +1,91 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/** Immutable UTF-8 JSON text, shared between caches and in-flight responses */
+using FUDBJsonBytes = TArray<ANSICHAR>;
+
+/**
+ * One pre-serialized JSON value: a byte range of shared UTF-8 storage. Either a whole
+ * buffer (cached schemas) or one row inside a chunk buffer that many rows share.
+ */
+struct FUDBJsonFragment
+{
+	TSharedPtr<const FUDBJsonBytes> Storage;
+	int32 Offset = 0;
+	int32 Num = 0;
+
+	FUDBJsonFragment() = default;
+
+	/** The whole of InStorage */
+	FUDBJsonFragment(TSharedPtr<const FUDBJsonBytes> InStorage)
+		: Storage(MoveTemp(InStorage))
+		, Num(Storage.IsValid() ? Storage->Num() : 0)
+	{
+	}
+
+	FUDBJsonFragment(TSharedPtr<const FUDBJsonBytes> InStorage, int32 InOffset, int32 InNum)
+		: Storage(MoveTemp(InStorage))
+		, Offset(InOffset)
+		, Num(InNum)
+	{
+	}
+
+	bool IsValid() const { return Storage.IsValid(); }
+	const ANSICHAR* GetData() const { return Storage->GetData() + Offset; }
+};
+
+/** Pre-serialized JSON for objects inside a response DOM, keyed by object identity */
+using FUDBJsonFragmentMap = TMap<const FJsonObject*, FUDBJsonFragment>;
+
+/**
+ * Condensed JSON writer that appends UTF-8 directly to a byte buffer.
+ * Unlike TJsonWriter it never round-trips through a TCHAR string, and it can splice
+ * pre-serialized fragments in place of DOM objects (see FUDBJsonFragmentMap).
+ */
+class UNREALDATABRIDGE_API FUDBJsonWriter
+{
+public:
+	explicit FUDBJsonWriter(FUDBJsonBytes& InBuffer, const FUDBJsonFragmentMap* InFragments = nullptr);
+
+	void WriteObjectStart();
+	void WriteObjectEnd();
+	void WriteArrayStart();
+	void WriteArrayEnd();
+
+	/** Write an object key; the next write is its value */
+	void WriteIdentifier(const FString& Identifier);
+
+	void WriteString(const FString& Value);
+	void WriteNumber(double Value);
+
+	/** Write a number already formatted as JSON number text */
+	void WriteNumberText(const FString& Text);
+	void WriteBool(bool bValue);
+	void WriteNull();
+
+	/** Append an already-encoded JSON value verbatim */
+	void WriteRawValue(const ANSICHAR* Data, int32 Num);
+
+	/** Serialize a DOM value, splicing fragments where available */
+	void WriteValue(const TSharedPtr<FJsonValue>& Value);
+
+	/** Serialize a DOM object, splicing fragments where available */
+	void WriteObject(const TSharedPtr<FJsonObject>& Object);
+
+	/** Serialize a DOM object into a fresh UTF-8 buffer */
+	static FUDBJsonBytes ToBytes(const TSharedPtr<FJsonObject>& Object);
+
+private:
+	void WriteSeparator();
+	void WriteQuotedString(const FString& Value);
+
+	FUDBJsonBytes& Buffer;
+	const FUDBJsonFragmentMap* Fragments;
+
+	/** Buffer size when this writer started; bytes before it belong to earlier, independent values */
+	int32 StartNum;
+};
@@ -0,0 +1,88 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * MessagePack writer with the same call surface as FUDBJsonWriter, so envelope code can
+ * be shared between encodings. DOM values get exact-size headers; streamed containers
+ * (WriteObjectStart/WriteArrayStart) reserve a 32-bit count that is patched on End.
+ * Non-integral numbers are written as raw IEEE float64, integral ones as the smallest int.
+ */
+class UNREALDATABRIDGE_API FUDBMsgPackWriter
+{
+public:
+	explicit FUDBMsgPackWriter(TArray<uint8>& InBuffer);
+
+	void WriteObjectStart();
+	void WriteObjectEnd();
+	void WriteArrayStart();
+	void WriteArrayEnd();
+
+	/** Write a map key; the next write is its value */
+	void WriteIdentifier(const FString& Identifier);
+
+	void WriteString(const FString& Value);
+	void WriteNumber(double Value);
+	void WriteBool(bool bValue);
+	void WriteNull();
+
+	/** Serialize a DOM value */
+	void WriteValue(const TSharedPtr<FJsonValue>& Value);
+
+	/** Serialize a DOM object */
+	void WriteObject(const TSharedPtr<FJsonObject>& Object);
+
+	/** Serialize a DOM object into a fresh buffer */
+	static TArray<uint8> ToBytes(const TSharedPtr<FJsonObject>& Object);
+
+private:
+	struct FOpenContainer
+	{
+		int32 HeaderOffset;
+		uint32 Count;
+		bool bIsMap;
+	};
+
+	/** Count a value against the innermost streamed array (map entries are counted by key) */
+	void NoteValue();
+	void EndContainer(bool bIsMap);
+
+	void EncodeString(const FString& Value);
+	void EncodeNumber(double Value);
+	void EncodeInteger(int64 Value);
+	void EncodeValue(const TSharedPtr<FJsonValue>& Value);
+	void EncodeObject(const TSharedPtr<FJsonObject>& Object);
+	void EncodeContainerHeader(uint32 Count, bool bIsMap);
+	void AppendBigEndian(uint64 Value, int32 NumBytes);
+
+	TArray<uint8>& Buffer;
+	TArray<FOpenContainer, TInlineAllocator<8>> OpenContainers;
+};
+
+/** Decodes MessagePack into the FJsonValue DOM used by command handlers */
+class UNREALDATABRIDGE_API FUDBMsgPackReader
+{
+public:
+	/** Parse a map payload into an object. Returns false with OutError on malformed or unsupported input. */
+	static bool ReadObject(const uint8* Data, int32 Num, TSharedPtr<FJsonObject>& OutObject, FString& OutError);
+
+private:
+	FUDBMsgPackReader(const uint8* InData, int32 InNum);
+
+	TSharedPtr<FJsonValue> ReadValue(int32 Depth);
+	TSharedPtr<FJsonValue> ReadArray(uint32 Count, int32 Depth);
+	TSharedPtr<FJsonValue> ReadMap(uint32 Count, int32 Depth);
+	bool ReadString(uint32 Length, FString& OutString);
+	bool ReadBigEndian(int32 NumBytes, uint64& OutValue);
+	TSharedPtr<FJsonValue> Fail(const FString& Message);
+
+	static constexpr int32 MaxDepth = 64;
+
+	const uint8* Data;
+	int32 Num;
+	int32 Offset = 0;
+	FString Error;
+};
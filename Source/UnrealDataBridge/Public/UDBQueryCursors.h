@@ -0,0 +1,74 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UDataTable;
+
+/**
+ * Server-side snapshots behind query_datatable cursors. A snapshot is the filtered, ordered row
+ * name list of one query together with the table generation it was taken at; a cursor names a
+ * snapshot, that generation and a position in the list. Later pages are slices of the list, so
+ * they neither re-filter nor skip or repeat rows when the table changes between pages; such a
+ * change is reported instead. Only the most recently used snapshots are kept. Game thread only.
+ */
+class UNREALDATABRIDGE_API FUDBQueryCursors
+{
+public:
+	/** Snapshots kept before the least recently used one is dropped */
+	static constexpr int32 MaxSnapshots = 16;
+
+	enum class EReadResult : uint8
+	{
+		Ok,
+		/** Not a cursor, or one issued for another table */
+		Invalid,
+		/** The snapshot was dropped; the query has to start over */
+		Expired,
+	};
+
+	struct FPage
+	{
+		/** Names of the page's rows; rows deleted since the snapshot are still listed */
+		TArray<FName> RowNames;
+		int32 Position = 0;
+		int32 TotalCount = 0;
+		uint64 SnapshotGeneration = 0;
+
+		/** Cursor of the following page, empty on the last one */
+		FString NextCursor;
+
+		/** The table changed after the snapshot was taken */
+		bool bConsistencyBreak = false;
+	};
+
+	/**
+	 * Keep OrderedRows as a snapshot of Table and return the cursor of Position, or an empty
+	 * string (keeping nothing) when Position is already past the end.
+	 */
+	static FString Save(const UDataTable* Table, TArray<FName>&& OrderedRows, int32 Position);
+
+	/** Up to Limit rows from the position a cursor points at */
+	static EReadResult ReadPage(const UDataTable* Table, const FString& Cursor, int32 Limit, FPage& OutPage);
+
+	/** Drop every snapshot */
+	static void Reset();
+
+private:
+	struct FSnapshot
+	{
+		uint64 Id = 0;
+		TWeakObjectPtr<const UDataTable> Table;
+		uint64 Generation = 0;
+		TArray<FName> RowNames;
+		uint64 LastUsed = 0;
+	};
+
+	static FString MakeCursor(const FSnapshot& Snapshot, int32 Position);
+
+	static TArray<FSnapshot> Snapshots;
+	static uint64 LastSnapshotId;
+	static uint64 UseCounter;
+};
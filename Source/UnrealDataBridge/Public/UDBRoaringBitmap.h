@@ -0,0 +1,56 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A compressed set of uint32 in the style of Roaring bitmaps: values are split by their high 16 bits
+ * into containers, each a sorted uint16 array while sparse (up to 4096 values, 8 KB at most) and a
+ * 65536-bit bitmap once denser. Set operations are done on dense word arrays (OrInto) by the caller,
+ * so combining predicates stays a word-parallel loop.
+ */
+class UNREALDATABRIDGE_API FUDBRoaringBitmap
+{
+public:
+	void Add(uint32 Value);
+	void Remove(uint32 Value);
+	bool Contains(uint32 Value) const;
+
+	/** Number of values */
+	int64 Num() const;
+	bool IsEmpty() const { return Containers.Num() == 0; }
+	void Reset() { Containers.Reset(); }
+
+	/** Set bit Value of Words (64 values per word) for every value; values past the end are ignored */
+	void OrInto(TArrayView<uint64> Words) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/** Containers switch to a bitmap above this many values and back to an array at or below it */
+	static constexpr int32 MaxArrayValues = 4096;
+	static constexpr int32 WordsPerContainer = 65536 / 64;
+
+	struct FContainer
+	{
+		uint16 Key = 0;
+		int32 Cardinality = 0;
+
+		/** Array container: sorted low bits */
+		TArray<uint16> Values;
+
+		/** Bitmap container: WordsPerContainer words, or empty while an array */
+		TArray<uint64> Words;
+
+		bool IsBitmap() const { return Words.Num() > 0; }
+		void ToBitmap();
+		void ToArray();
+	};
+
+	/** Position of the container for Key, or where it would be inserted */
+	int32 LowerBound(uint16 Key) const;
+
+	/** Containers ordered by key */
+	TArray<FContainer> Containers;
+};
@@ -0,0 +1,93 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "UDBJsonWriter.h"
+#include "UDBTableCache.h"
+
+class UDataTable;
+struct FUDBFieldProjection;
+struct FUDBSerializeOptions;
+
+/** A serialized DataTable row: the DOM handed to responses and its UTF-8 form for splicing */
+struct UNREALDATABRIDGE_API FUDBCachedRow
+{
+	/** Shared row DOM; the same object is handed to every caller */
+	TSharedPtr<const FJsonObject> Json;
+
+	/** Json serialized once, spliced verbatim into responses */
+	FUDBJsonFragment Utf8;
+};
+
+/**
+ * Bounded LRU of serialized DataTable rows keyed by (table, row, variant), where the variant is
+ * the field projection plus serialize options. Entries remember their table's generation
+ * (FUDBTableVersions), so any change to the table retires all of its rows at once; stale
+ * entries are dropped lazily on lookup or evicted. Sized by UUDBSettings::RowCacheSizeMB, which
+ * each entry is charged for its bytes plus an estimate of its DOM.
+ * Game thread only.
+ */
+class UNREALDATABRIDGE_API FUDBRowCache
+{
+public:
+	/** False when the settings budget is 0 */
+	static bool IsEnabled();
+
+	/** Key for one serialized form of a row (projection + options) */
+	static uint64 MakeVariantKey(const FUDBFieldProjection& Projection, const FUDBSerializeOptions& Options);
+
+	/** Look up a row, marking it most recently used */
+	static bool Find(const UDataTable* Table, FName RowName, uint64 VariantKey, FUDBCachedRow& OutRow);
+
+	/** Cache a serialized row. The bytes are copied so the entry does not pin a larger shared buffer. */
+	static void Add(const UDataTable* Table, FName RowName, uint64 VariantKey, const TSharedPtr<const FJsonObject>& Json, const FUDBJsonFragment& Utf8);
+
+	/** Drop every cached row */
+	static void Reset();
+
+	/** Number of cached rows (including stale ones not yet dropped) */
+	static int32 Num();
+
+	/** Memory charged to cached rows: their serialized bytes plus estimated DOM size */
+	static int64 GetCachedBytes();
+
+private:
+	struct FKey
+	{
+		const UDataTable* Table;
+		FName RowName;
+		uint64 VariantKey;
+
+		bool operator==(const FKey& Other) const
+		{
+			return Table == Other.Table && RowName == Other.RowName && VariantKey == Other.VariantKey;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombineFast(HashCombineFast(::GetTypeHash(Key.Table), ::GetTypeHash(Key.RowName)), ::GetTypeHash(Key.VariantKey));
+		}
+	};
+
+	struct FEntry : FUDBTableCacheEntry
+	{
+		FUDBCachedRow Row;
+
+		/** What the entry counts against the budget */
+		int64 ChargedBytes = 0;
+	};
+
+	/** Approximate heap size of a row's DOM and its serialized copy */
+	static int64 EstimateEntryBytes(const FJsonObject& Json, const FUDBJsonFragment& Utf8);
+
+	static void RemoveEntry(const FKey& Key);
+	static void EvictLeastRecent();
+
+	/** Upper bound on entry count regardless of byte budget */
+	static constexpr int32 MaxEntries = 100000;
+
+	static TLruCache<FKey, FEntry> Entries;
+	static int64 CachedBytes;
+};
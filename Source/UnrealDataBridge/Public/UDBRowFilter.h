@@ -0,0 +1,147 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Templates/Function.h"
+
+class FProperty;
+class FArrayProperty;
+class UStruct;
+
+/**
+ * A `where` expression compiled against a struct's reflection and evaluated directly on row memory.
+ *
+ * Grammar (keywords are case-insensitive; `&&`, `||`, `!` work as well):
+ *   expr       := or
+ *   or         := and ("or" and)*
+ *   and        := unary ("and" unary)*
+ *   unary      := "not" unary | "(" expr ")" | condition
+ *   condition  := path [op literal | "in" "(" literal ("," literal)* ")"]
+ *   op         := == | != | < | <= | > | >= | contains | matches
+ *   literal    := number | "string" | 'string' | true | false | bare word
+ *
+ * A path is a dotted field path ("Stats.Damage"); paths through arrays ("Abilities.Cooldown",
+ * "Abilities[*].Cooldown") and array leaves ("Curve > 5") hold if any element does. A bare path
+ * tests a bool. Literals are resolved once at compile time: enum names to values, tags to FGameplayTag.
+ *
+ *   numbers, enums     == != < <= > >= in
+ *   bool               == != (or bare)
+ *   FString/FName/FText == != < <= > >= in, contains (substring), matches (wildcard); case-insensitive
+ *   FGameplayTag       == != in, matches (tag or any child of it)
+ *   tag container      contains (exact tag), matches (tag or any child of it)
+ *   array leaf         contains (any element equals)
+ */
+class UNREALDATABRIDGE_API FUDBRowFilter
+{
+public:
+	/** Compile an expression. Returns null and sets OutError on syntax errors, unknown fields or mistyped literals. */
+	static TSharedPtr<const FUDBRowFilter> Compile(const UStruct* StructType, const FString& Expression, FString& OutError);
+
+	/** Evaluate against one instance of the struct the filter was compiled for. Thread-safe. */
+	bool Matches(const void* StructData) const;
+
+	/** The struct this filter was compiled against */
+	const UStruct* GetStruct() const { return Struct; }
+
+	enum class EOp : uint8
+	{
+		Truthy,
+		Equal,
+		NotEqual,
+		Less,
+		LessEqual,
+		Greater,
+		GreaterEqual,
+		In,
+		Contains,
+		Matches,
+	};
+
+	enum class ELeafKind : uint8
+	{
+		Numeric,
+		Enum,
+		Bool,
+		String,
+		Name,
+		Text,
+		Tag,
+		TagContainer,
+	};
+
+	/** A resolved field path: properties to step through, and whether each step fans out over array elements */
+	struct FAccessor
+	{
+		struct FStep
+		{
+			const FProperty* Property = nullptr;
+			const FArrayProperty* Array = nullptr;
+		};
+
+		TArray<FStep> Steps;
+		const FProperty* Leaf = nullptr;
+		ELeafKind Kind = ELeafKind::Numeric;
+		FString Path;
+
+		/** True when any step fans out over an array (the path has several values per row) */
+		bool HasArrays() const;
+
+		/** Leaf value address for a path without arrays */
+		const void* GetLeafData(const void* StructData) const;
+
+		/** Numeric, enum (underlying value) or bool (0/1) leaf as a double */
+		double ReadNumber(const void* LeafData) const;
+
+		/** Leaf as display text: strings as-is, enums by name, bools as true/false, numbers as their shortest round-trip text */
+		FString ReadString(const void* LeafData) const;
+
+		/** Call Visitor with every leaf value of the path, one per element for paths through arrays */
+		void ForEachLeaf(const void* StructData, TFunctionRef<void(const void*)> Visitor) const;
+
+	private:
+		void VisitLeaves(int32 StepIndex, const void* Container, TFunctionRef<void(const void*)> Visitor) const;
+	};
+
+	/** Resolve a field path against a struct with the same rules as expression paths */
+	static bool ResolveAccessor(const UStruct* StructType, const FString& Path, FAccessor& OutAccessor, FString& OutError);
+
+	/** A literal converted to the leaf's type */
+	struct FLiteral
+	{
+		double Number = 0.0;
+		bool bBool = false;
+		FString String;
+		FName Name;
+		FGameplayTag Tag;
+	};
+
+	/** One expression node. And/Or/Not refer to children by index into Nodes. */
+	struct FNode
+	{
+		enum class EKind : uint8 { And, Or, Not, Condition };
+
+		EKind Kind = EKind::Condition;
+		int32 Left = INDEX_NONE;
+		int32 Right = INDEX_NONE;
+
+		// Condition
+		FAccessor Accessor;
+		EOp Op = EOp::Truthy;
+		TArray<FLiteral> Literals;
+	};
+
+	/** Expression tree; the root is the last node */
+	const TArray<FNode>& GetNodes() const { return Nodes; }
+
+private:
+	friend class FUDBRowFilterParser;
+
+	bool EvaluateNode(int32 NodeIndex, const void* StructData) const;
+	static bool EvaluateCondition(const FNode& Node, int32 StepIndex, const void* Container);
+	static bool EvaluateLeaf(const FNode& Node, const void* LeafData);
+
+	const UStruct* Struct = nullptr;
+	TArray<FNode> Nodes;
+};
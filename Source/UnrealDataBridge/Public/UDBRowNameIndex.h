@@ -0,0 +1,97 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UDBTableCache.h"
+
+class UDataTable;
+
+/**
+ * Cached row names of a DataTable for row_name_pattern reads: names in table order, their
+ * case-folded strings, and those strings sorted, so the rows sharing a literal prefix form one
+ * contiguous range (the sorted array doubles as a prefix trie). A pattern's matches are kept until
+ * the next pattern, so paging through them slices an array instead of rematching every row.
+ *
+ * Only tables of at least RowNameIndexMinRows rows are indexed, and only the most recently used
+ * MaxTables of them are kept. Rows the plugin adds or removes drop a table's entry; updates leave
+ * it alone. Any other change rebuilds it on next use. Game thread only.
+ */
+class UNREALDATABRIDGE_API FUDBRowNameIndex
+{
+public:
+	/** Indexed tables kept before the least recently used one is dropped */
+	static constexpr int32 MaxTables = 8;
+
+	/** A wildcard pattern ('*' any run, '?' one character, case-insensitive), folded once */
+	class UNREALDATABRIDGE_API FPattern
+	{
+	public:
+		explicit FPattern(const FString& Pattern);
+
+		/** Empty or only '*': every name matches */
+		bool MatchesAll() const { return bMatchesAll; }
+
+		bool Matches(FName Name) const;
+
+		/** Match an already folded string */
+		bool MatchesFolded(const TCHAR* Text, int32 Len) const;
+
+		/** The literal characters before the first wildcard, folded */
+		FStringView GetPrefix() const { return FStringView(*Folded, PrefixLen); }
+
+		/** The pattern is its prefix followed by a single trailing '*' */
+		bool IsPrefixOnly() const { return bPrefixOnly; }
+
+	private:
+		FString Folded;
+		int32 PrefixLen = 0;
+		bool bMatchesAll = false;
+		bool bPrefixOnly = false;
+	};
+
+	/** Whether the table is large enough to be indexed */
+	static bool IsEnabled(const UDataTable* Table);
+
+	/**
+	 * Rows Offset..Offset+Limit (in table order) of those whose name matches Pattern, appended to
+	 * OutPage. Returns the total number of matching rows.
+	 */
+	static int32 SelectPage(const UDataTable* Table, const FString& Pattern, int32 Offset, int32 Limit, TArray<FName>& OutPage);
+
+	/** Whether the table currently has an entry (used to decide if a write must be tracked) */
+	static bool Contains(const UDataTable* Table);
+
+	/** Keep the entry when only existing rows changed, drop it when rows came or went */
+	static void ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows);
+
+	/** Drop every entry */
+	static void Reset();
+
+private:
+	struct FTableNames : FUDBTableCacheEntry
+	{
+		/** Row names and their folded strings, in table order */
+		TArray<FName> RowNames;
+		TArray<FString> Folded;
+
+		/** Positions ordered by folded string */
+		TArray<int32> Sorted;
+
+		/** Ascending positions matching the last pattern asked for */
+		FString LastPattern;
+		TArray<int32> LastMatches;
+		bool bHasLastMatches = false;
+
+		uint64 LastUsed = 0;
+
+		void Build(const UDataTable* InTable);
+		void Match(const FPattern& Pattern, TArray<int32>& OutPositions) const;
+	};
+
+	/** Up-to-date entry of a table */
+	static FTableNames& Refresh(const UDataTable* Table);
+
+	static TMap<const UDataTable*, TUniquePtr<FTableNames>> Tables;
+	static uint64 UseCounter;
+};
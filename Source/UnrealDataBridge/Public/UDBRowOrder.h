@@ -0,0 +1,49 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UDBRowFilter.h"
+
+class UStruct;
+
+/**
+ * A multi-key sort order ("Price desc", "Name") compiled against a struct's reflection.
+ * Keys are single-valued field paths: numbers, enums (by value) and bools compare numerically,
+ * strings, names, text and tags case-insensitively. Ties keep the input order.
+ */
+class UNREALDATABRIDGE_API FUDBRowOrder
+{
+public:
+	/** Compile "Field", "Field asc" or "Field desc" keys. Returns null and sets OutError on invalid keys. */
+	static TSharedPtr<const FUDBRowOrder> Compile(const UStruct* StructType, const TArray<FString>& KeySpecs, FString& OutError);
+
+	/**
+	 * Indices into Rows of the rows at sorted positions [Offset, Offset + Count). Sort keys are
+	 * extracted once per row; when Offset + Count is smaller than the row count, a bounded heap
+	 * selects them without sorting the rest.
+	 */
+	void Select(TConstArrayView<const void*> Rows, int32 Offset, int32 Count, TArray<int32>& OutIndices) const;
+
+private:
+	struct FKey
+	{
+		FUDBRowFilter::FAccessor Accessor;
+		bool bDescending = false;
+	};
+
+	/** One row's value for one key; which member is used depends on the key's kind */
+	struct FValue
+	{
+		double Number = 0.0;
+		const FString* String = nullptr;
+		FName Name;
+	};
+
+	FValue ExtractValue(const FKey& Key, const void* RowData) const;
+
+	/** <0, 0, >0 as A sorts before, with, or after B on one key (ignoring direction) */
+	static int32 CompareValues(const FKey& Key, const FValue& A, const FValue& B);
+
+	TArray<FKey> Keys;
+};
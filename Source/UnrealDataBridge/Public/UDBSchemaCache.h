@@ -0,0 +1,46 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "UDBJsonWriter.h"
+
+/** A memoized struct schema: the DOM, its pre-serialized UTF-8 form, and a content hash */
+struct UNREALDATABRIDGE_API FUDBCachedSchema
+{
+	/** Shared schema DOM. Treat as immutable: the same object is handed to every caller. */
+	TSharedPtr<FJsonObject> Schema;
+
+	/** Schema serialized once, spliced verbatim into responses */
+	TSharedPtr<const FUDBJsonBytes> Utf8;
+
+	/** Hex CityHash64 of Utf8; changes whenever the schema changes */
+	FString Hash;
+};
+
+/**
+ * Server-side cache of FUDBSerializer::GetStructSchema results keyed by struct and options.
+ * Cleared by the module on hot reload, struct reinstancing and user-defined struct edits.
+ */
+class UNREALDATABRIDGE_API FUDBSchemaCache
+{
+public:
+	/** Get (building on first use) the schema for a struct */
+	static FUDBCachedSchema Get(const UStruct* StructType, bool bIncludeInherited = true);
+
+	/** Drop every cached schema */
+	static void Reset();
+
+	/** Number of cached schemas */
+	static int32 Num();
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<const UStruct> Struct;
+		FUDBCachedSchema Cached;
+	};
+
+	static TMap<TPair<const UStruct*, bool>, FEntry> Entries;
+};
@@ -3,6 +3,37 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "UDBJsonWriter.h"
+#include "UDBFieldPath.h"
+
+class FStructOnScope;
+
+/** Per-request serialization options, shared read-only by every row */
+struct FUDBSerializeOptions
+{
+	/** Default-initialized instance of the struct being serialized (see FUDBSerializer::GetStructDefaults).
+	 *  When set, properties Identical to their default are omitted; nested structs are compared field by field. */
+	const void* DefaultData = nullptr;
+
+	/** Maximum decimal places for float/double values (INDEX_NONE = full precision) */
+	int32 FloatPrecision = INDEX_NONE;
+
+	/** True when nothing differs from plain full serialization */
+	bool IsDefault() const { return DefaultData == nullptr && FloatPrecision == INDEX_NONE; }
+
+	/** Copy for serializing a nested value: precision carries over, the default instance does not */
+	FUDBSerializeOptions ForNestedValue() const
+	{
+		FUDBSerializeOptions Nested = *this;
+		Nested.DefaultData = nullptr;
+		return Nested;
+	}
+
+	/** Read the shared read-command options ("omit_defaults", "float_precision") from request params. Game thread only. */
+	static FUDBSerializeOptions FromParams(const TSharedPtr<FJsonObject>& Params, const UStruct* StructType);
+
+	static constexpr int32 MaxFloatPrecision = 15;
+};
 
 class UNREALDATABRIDGE_API FUDBSerializer
 {
@@ -14,8 +45,56 @@ public:
 	 *  When FieldFilter is empty, delegates to the full-serialization overload. */
 	static TSharedPtr<FJsonObject> StructToJson(const UStruct* StructType, const void* StructData, const TSet<FString>& FieldFilter);
 
-	/** Serialize a single FProperty value to a JSON value */
-	static TSharedPtr<FJsonValue> PropertyToJson(const FProperty* Property, const void* ValuePtr);
+	/** Serialize a UStruct instance to a JSON object, including only the projected field paths
+	 *  (e.g. "Stats.Damage", "Abilities[*].Cooldown"). An empty projection serializes everything. */
+	static TSharedPtr<FJsonObject> StructToJson(const UStruct* StructType, const void* StructData, const FUDBFieldProjection& Projection);
+
+	/** Serialize a UStruct instance with a projection already compiled against StructType.
+	 *  Prefer this when serializing many rows: the projection is resolved once, not per row. */
+	static TSharedPtr<FJsonObject> StructToJson(const UStruct* StructType, const void* StructData, const FUDBCompiledProjection& Projection);
+
+	/** Serialize a UStruct instance with an optional compiled projection (null = every field) and options */
+	static TSharedPtr<FJsonObject> StructToJson(
+		const UStruct* StructType,
+		const void* StructData,
+		const FUDBCompiledProjection* Projection,
+		const FUDBSerializeOptions& Options);
+
+	/** Serialize many instances of the same struct, e.g. a page of DataTable rows.
+	 *  Rows are split into NumChunks contiguous chunks serialized in parallel (1 runs inline);
+	 *  output order always matches input. When OutUtf8 is set, each row is also encoded to
+	 *  UTF-8 on its worker so responses can splice the bytes (see FUDBJsonFragmentMap); a chunk's
+	 *  rows share one linear buffer, so a page costs one allocation per chunk, not one per row.
+	 *  Struct data must not be mutated while this runs. */
+	static void StructsToJson(
+		const UStruct* StructType,
+		TConstArrayView<const void*> StructDatas,
+		const FUDBFieldProjection& Projection,
+		const FUDBSerializeOptions& Options,
+		int32 NumChunks,
+		TArray<TSharedPtr<FJsonObject>>& OutJson,
+		TArray<FUDBJsonFragment>* OutUtf8 = nullptr);
+
+	/** Serialize many instances column-wise. Returns one entry per selected top-level field, in
+	 *  declaration order: either an array of values in row order, or, for enums, names, gameplay tags
+	 *  and repetitive strings, a dictionary-encoded {"dict": [...distinct], "codes": [...indices]}.
+	 *  Columns are built in parallel when NumChunks > 1. */
+	static TSharedPtr<FJsonObject> StructsToColumns(
+		const UStruct* StructType,
+		TConstArrayView<const void*> StructDatas,
+		const FUDBFieldProjection& Projection,
+		const FUDBSerializeOptions& Options,
+		int32 NumChunks);
+
+	/** Serialize a single FProperty value to a JSON value.
+	 *  Arrays of plain numbers and all-numeric structs (FVector, FRotator, FLinearColor, ...) take a
+	 *  typed fast path instead of per-element property dispatch. Options.DefaultData is not used here. */
+	static TSharedPtr<FJsonValue> PropertyToJson(const FProperty* Property, const void* ValuePtr, const FUDBSerializeOptions& Options = FUDBSerializeOptions());
+
+	/** JSON number for a float, holding the shortest decimal that reads back as Value so 0.1f is
+	 *  sent as 0.1 rather than 0.10000000149011612. The digits are formatted once: FUDBJsonWriter
+	 *  copies them, and AsNumber() reads them as the nearest double. */
+	static TSharedRef<FJsonValue> FloatToJsonValue(float Value);
 
 	/** Deserialize JSON into a UStruct instance. Returns true on success. */
 	static bool JsonToStruct(const TSharedPtr<FJsonObject>& JsonObject, const UStruct* StructType, void* StructData, TArray<FString>& OutWarnings);
@@ -23,16 +102,41 @@ public:
 	/** Deserialize a JSON value into a single FProperty. Returns true on success. */
 	static bool JsonToProperty(const TSharedPtr<FJsonValue>& JsonValue, const FProperty* Property, void* ValuePtr, TArray<FString>& OutWarnings);
 
+	/** Whether JsonToStruct may run on worker threads for StructType: false when a field at any depth
+	 *  is a hard object reference (deserializing loads the object) or an FInstancedStruct. */
+	static bool CanDeserializeConcurrently(const UStruct* StructType);
+
 	/** Get schema for a UStruct (field names, types, enum values, nested schemas) */
 	static TSharedPtr<FJsonObject> GetStructSchema(const UStruct* StructType, bool bIncludeInherited = true);
 
 	/** Discover TInstancedStruct subtypes for a base struct */
 	static TArray<UScriptStruct*> FindInstancedStructSubtypes(const UScriptStruct* BaseStruct);
 
+	/** Forget discovered TInstancedStruct subtypes (new struct types may have been loaded) */
+	static void ClearSubtypeCache();
+
+	/** Default-initialized instance of a struct (the CDO for classes), cached per struct. Game thread only. */
+	static const void* GetStructDefaults(const UStruct* StructType);
+
+	/** Drop cached default instances (struct layouts may have changed) */
+	static void ClearStructDefaults();
+
+	/** Drop cached all-numeric struct layouts used by the PropertyToJson fast path */
+	static void ClearNumericStructLayouts();
+
 private:
+	/** Serialize a property value, narrowed to the sub-fields selected by a projection node */
+	static TSharedPtr<FJsonValue> ProjectedPropertyToJson(const FProperty* Property, const void* ValuePtr, const FUDBCompiledProjection::FField& Field, const FUDBSerializeOptions& Options);
+
+	/** Build one StructsToColumns column */
+	static TSharedPtr<FJsonValue> BuildColumn(TConstArrayView<const void*> StructDatas, const FUDBCompiledProjection::FField& Field, const FUDBSerializeOptions& Options);
+
 	/** Build schema for a single property */
 	static TSharedPtr<FJsonObject> GetPropertySchema(const FProperty* Property);
 
 	/** Cache for TInstancedStruct subtype discovery */
 	static TMap<const UScriptStruct*, TArray<UScriptStruct*>> SubtypeCache;
+
+	/** Cache for GetStructDefaults */
+	static TMap<const UStruct*, TSharedPtr<FStructOnScope>> DefaultsCache;
 };
@@ -23,6 +23,26 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Debugging")
 	bool bLogCommands = false;
 
+	/** Row count at which query_datatable / resolve_tags serialize rows, and aggregate_datatable reduces them, across worker threads. 0 disables. */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (ClampMin = "0"))
+	int32 ParallelSerializeMinRows = 512;
+
+	/** Memory budget for serialized rows kept between reads (get_datatable_row, query_datatable, resolve_tags). 0 disables. */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (ClampMin = "0"))
+	int32 RowCacheSizeMB = 32;
+
+	/** Row count from which DataTables keep a column-wise copy of their number, enum and bool fields for `where` and aggregate scans. 0 disables. */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (ClampMin = "0"))
+	int32 ColumnStoreMinRows = 10000;
+
+	/** Row count from which search_datatable_content looks up a trigram index of text fields instead of scanning every row. 0 disables. */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (ClampMin = "0"))
+	int32 SearchIndexMinRows = 2000;
+
+	/** Row count from which query_datatable keeps a table's row names sorted to match and page row_name_pattern without rematching every row. 0 disables. */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (ClampMin = "0"))
+	int32 RowNameIndexMinRows = 5000;
+
 	/** Map tag prefix to .ini file for auto-detection in register_gameplay_tag */
 	UPROPERTY(Config, EditAnywhere, Category = "GameplayTags")
 	TMap<FString, FString> TagPrefixToIniFile;
@@ -0,0 +1,100 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UDataTable;
+class UScriptStruct;
+
+/**
+ * What every per-table cache (column store, table/bitmap/text/tag indexes, row names, composite
+ * layouts, serialized rows) records about the table an entry was built from.
+ *
+ * Caches key their entries by raw table pointer, but a table created after another was garbage
+ * collected can get its address, so an entry belongs to a table only while its weak pointer still
+ * resolves to it. An entry whose generation (FUDBTableVersions) or row struct is behind the table's
+ * is rebuilt as a whole on next use. A write tracked by FUDBTableIndexes::FScopedRowChanges is
+ * patched into an entry only if the entry was current right before the write; one that was already
+ * stale is left for that rebuild. Game thread only.
+ */
+struct UNREALDATABRIDGE_API FUDBTableCacheEntry
+{
+	TWeakObjectPtr<const UDataTable> Table;
+	const UScriptStruct* RowStruct = nullptr;
+	uint64 Generation = 0;
+
+	/** The entry was made for InTable, not for a collected table at the same address */
+	bool IsFor(const UDataTable* InTable) const { return Table.Get() == InTable; }
+
+	/** The entry reflects InTable's current rows and row struct */
+	bool IsCurrent(const UDataTable* InTable) const;
+
+	/** The entry was current when a write starting at StartGeneration began, so the write can be patched in */
+	bool CanPatch(const UDataTable* InTable, uint64 StartGeneration) const;
+
+	/** Record that the entry now reflects InTable as it is */
+	void Stamp(const UDataTable* InTable);
+
+	/** Have the entry rebuilt on next use */
+	void Invalidate() { Generation = 0; }
+
+	/** InTable's entry, or null if there is none; one left by a collected table is dropped */
+	template <typename EntryType>
+	static EntryType* Find(TMap<const UDataTable*, TUniquePtr<EntryType>>& Entries, const UDataTable* InTable)
+	{
+		TUniquePtr<EntryType>* Entry = Entries.Find(InTable);
+		if (Entry == nullptr)
+		{
+			return nullptr;
+		}
+		if (!(*Entry)->IsFor(InTable))
+		{
+			Entries.Remove(InTable);
+			return nullptr;
+		}
+		return Entry->Get();
+	}
+
+	/** InTable's entry, replaced by an empty (stale) one if missing or left by a collected table */
+	template <typename EntryType>
+	static EntryType& FindOrAdd(TMap<const UDataTable*, TUniquePtr<EntryType>>& Entries, const UDataTable* InTable)
+	{
+		TUniquePtr<EntryType>& Entry = Entries.FindOrAdd(InTable);
+		if (!Entry.IsValid() || !Entry->IsFor(InTable))
+		{
+			Entry = MakeUnique<EntryType>();
+			Entry->Table = InTable;
+		}
+		return *Entry;
+	}
+};
+
+/**
+ * Row numbering for caches that address rows by position: a row's position is its row-map slot,
+ * so ascending positions are table order, including rows added into slots that removed rows freed.
+ * NAME_None marks free slots.
+ */
+struct UNREALDATABRIDGE_API FUDBRowSlots
+{
+	TArray<FName> RowNames;
+	TMap<FName, int32> RowPositions;
+
+	/** Row-map slot of a row, or INDEX_NONE if the table has no such row */
+	static int32 FindSlot(const UDataTable* Table, FName RowName);
+
+	/** Number every row of Table, calling Visitor(RowName, Position, RowData) in table order */
+	void Build(const UDataTable* Table, TFunctionRef<void(FName, int32, const uint8*)> Visitor);
+
+	/**
+	 * Give an added or changed row of Table the position of its slot and return it, or free the
+	 * row's position and return INDEX_NONE if the table no longer has it. OnFreed runs for every
+	 * position that stops holding a row: the row's old one when it moved, and the one another row
+	 * held. A row updated in place keeps its position without OnFreed.
+	 */
+	int32 Place(const UDataTable* Table, FName RowName, TFunctionRef<void(int32 Position)> OnFreed);
+
+	/** Free a row's position and return it, or INDEX_NONE if the row had none */
+	int32 Remove(FName RowName);
+};
@@ -0,0 +1,187 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UDBRowFilter.h"
+#include "UDBTableCache.h"
+
+class UDataTable;
+class UScriptStruct;
+
+/**
+ * Hash indexes answer == and in; sorted indexes also answer < <= > >= on numbers, enums and bools;
+ * bitmap indexes (FUDBBitmapIndexes) serve enum, bool and tag fields and whole and/or/not expressions
+ */
+enum class EUDBIndexType : uint8
+{
+	Hash,
+	Sorted,
+	Bitmap,
+};
+
+/** Candidate rows an index produced for a where filter */
+struct FUDBIndexLookup
+{
+	/** Rows that may match, in table order. Always a superset of the matches; the filter still runs on each. */
+	TArray<FName> Rows;
+
+	/** The indexed field (comma-separated for bitmap lookups) and index kind that served the lookup */
+	FString Field;
+	EUDBIndexType Type = EUDBIndexType::Hash;
+};
+
+/**
+ * Opt-in secondary indexes on DataTable fields (create_index), used by query_datatable to answer
+ * `where` conditions without a full scan. An index is keyed by a field path without arrays; string
+ * keys are case-folded to match the filter's case-insensitive comparisons.
+ *
+ * Indexes remember the table generation (FUDBTableVersions) they reflect. The plugin's own row writes
+ * update them in place through FScopedRowChanges; any other change (editor edits, reimport, undo/redo)
+ * leaves them stale and they are rebuilt on next use. Game thread only.
+ *
+ * Bitmap indexes live in FUDBBitmapIndexes; this class forwards to it so callers see one set of indexes.
+ */
+class UNREALDATABRIDGE_API FUDBTableIndexes
+{
+public:
+	struct FBuildStats
+	{
+		int32 NumRows = 0;
+		int32 NumKeys = 0;
+		double BuildMs = 0.0;
+	};
+
+	/** Build (or rebuild) an index on Field. Returns false and sets OutError if the field cannot be indexed. */
+	static bool CreateIndex(const UDataTable* Table, const FString& Field, EUDBIndexType Type, FBuildStats& OutStats, FString& OutError);
+
+	/** Remove an index. Returns false if there was none on Field. */
+	static bool DropIndex(const UDataTable* Table, const FString& Field);
+
+	/** Indexed fields of a table and their kinds */
+	static TArray<TPair<FString, EUDBIndexType>> GetIndexes(const UDataTable* Table);
+
+	/**
+	 * Find candidate rows for a filter from the most selective index that can serve one of its
+	 * top-level (and-ed) conditions, or from the table's bitmap indexes when they narrow it further.
+	 * Returns false when no index applies.
+	 */
+	static bool FindCandidates(const UDataTable* Table, const FUDBRowFilter& Filter, FUDBIndexLookup& OutLookup);
+
+	/** Drop every index */
+	static void Reset();
+
+	static const TCHAR* LexToString(EUDBIndexType Type);
+	static bool LexFromString(const FString& String, EUDBIndexType& OutType);
+
+	/**
+	 * A per-table cache kept in step with the plugin's own writes by FScopedRowChanges. Contains
+	 * tells whether the cache holds anything for a table; ApplyRowChanges patches it with the rows a
+	 * write touched, given the table generation the write started from.
+	 */
+	struct FRowChangeListener
+	{
+		bool (*Contains)(const UDataTable* Table) = nullptr;
+		void (*ApplyRowChanges)(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows) = nullptr;
+	};
+
+	/** Subscribe a cache to plugin writes */
+	static void AddRowChangeListener(const FRowChangeListener& Listener);
+
+	/** Unsubscribe every cache */
+	static void RemoveRowChangeListeners();
+
+	/**
+	 * Records the rows a write touches and applies them to the table's indexes and every subscribed
+	 * cache (AddRowChangeListener) when it goes out of scope, after the write has been broadcast.
+	 * Declare it before modifying the table: caches that were already stale at that point are left
+	 * for a rebuild rather than patched.
+	 */
+	class UNREALDATABRIDGE_API FScopedRowChanges
+	{
+	public:
+		explicit FScopedRowChanges(const UDataTable* InTable);
+		~FScopedRowChanges();
+
+		/** A row was added or its contents changed */
+		void RowChanged(FName RowName);
+
+		/** A row was removed */
+		void RowRemoved(FName RowName);
+
+		/** The change is too broad to apply row by row (e.g. the table was emptied); rebuild instead */
+		void Invalidate() { bInvalidated = true; }
+
+	private:
+		const UDataTable* Table;
+		uint64 StartGeneration;
+		TArray<FName> ChangedRows;
+		TArray<FName> RemovedRows;
+		bool bInvalidated = false;
+	};
+
+private:
+	struct FKey
+	{
+		double Number = 0.0;
+		FString String;
+
+		bool operator==(const FKey& Other) const { return Number == Other.Number && String == Other.String; }
+		bool operator<(const FKey& Other) const { return Number < Other.Number || (Number == Other.Number && String < Other.String); }
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombineFast(::GetTypeHash(Key.Number), ::GetTypeHash(Key.String));
+		}
+	};
+
+	struct FIndex : FUDBTableCacheEntry
+	{
+		FString Field;
+		EUDBIndexType Type = EUDBIndexType::Hash;
+		FUDBRowFilter::FAccessor Accessor;
+
+		/**
+		 * Key and row-map slot of every row. Slots ascend in table order, including rows added into
+		 * the slot a removed row freed, so they put candidates back in the order a scan sees.
+		 */
+		struct FRowEntry
+		{
+			FKey Key;
+			int32 Slot = INDEX_NONE;
+		};
+		TMap<FName, FRowEntry> Rows;
+
+		/** Hash index */
+		TMap<FKey, TArray<FName>> Buckets;
+
+		/** Sorted index: (key, row) ordered by key */
+		TArray<TPair<FKey, FName>> Sorted;
+
+		FKey MakeKey(const void* RowData) const;
+		FKey MakeKey(const FUDBRowFilter::FLiteral& Literal) const;
+		void Build(const UDataTable* Table);
+		void Insert(FName RowName, int32 Slot, const void* RowData);
+		void Remove(FName RowName);
+		int32 NumKeys() const;
+
+		/** Rows whose key satisfies one condition, or false if this index cannot answer it */
+		bool Lookup(const FUDBRowFilter::FNode& Condition, TArray<FName>& OutRows) const;
+	};
+
+	/** Only the owning table is tracked here; each index keeps its own generation */
+	struct FTableIndexes : FUDBTableCacheEntry
+	{
+		TArray<TSharedPtr<FIndex>> Indexes;
+	};
+
+	/** Remove hash and sorted indexes on Field */
+	static bool RemoveIndexes(const UDataTable* Table, const FString& Field);
+
+	/** Bring an index up to date with its table; false if its field no longer resolves */
+	static bool Refresh(const UDataTable* Table, FIndex& Index);
+	static void ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows);
+
+	static TMap<const UDataTable*, TUniquePtr<FTableIndexes>> Tables;
+	static TArray<FRowChangeListener> RowChangeListeners;
+};
@@ -0,0 +1,55 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UDataTable;
+class FTransactionObjectEvent;
+
+/**
+ * Per-table change generations. A table's generation advances whenever it changes: OnDataTableChanged
+ * (bound on first use), undo/redo, and the plugin's own writes (FUDBEditorUtils::NotifyAssetModified).
+ * Generations come from one process-wide counter, so a value is never reused for other content.
+ * Game thread only.
+ */
+class UNREALDATABRIDGE_API FUDBTableVersions
+{
+public:
+	/** Current generation of a table, starting to track it if needed */
+	static uint64 GetGeneration(const UDataTable* Table);
+
+	/** Advance a tracked table's generation */
+	static void MarkChanged(const UDataTable* Table);
+
+	/**
+	 * ETag for a read whose result depends only on the table's content and the request params
+	 * (every param except "if_none_match"). Stable until the table changes; unique to this editor session.
+	 */
+	static FString MakeReadETag(const UDataTable* Table, const TSharedPtr<FJsonObject>& Params);
+
+	/** ETag for serialized content (e.g. one row): a hash of the bytes */
+	static FString MakeContentETag(const ANSICHAR* Data, int32 Num);
+
+	/** Advance DataTables restored by undo/redo (bound to FCoreUObjectDelegates::OnObjectTransacted) */
+	static void HandleObjectTransacted(UObject* Object, const FTransactionObjectEvent& Event);
+
+	/** Stop tracking every table. Tables tracked again later get fresh generations. */
+	static void Reset();
+
+private:
+	struct FTableState
+	{
+		TWeakObjectPtr<const UDataTable> Table;
+		uint64 Generation = 0;
+		FDelegateHandle ChangedHandle;
+	};
+
+	static FTableState& GetState(const UDataTable* Table);
+	static void HandleDataTableChanged(const UDataTable* Table);
+
+	static TMap<const UDataTable*, FTableState> States;
+	static uint64 LastGeneration;
+};
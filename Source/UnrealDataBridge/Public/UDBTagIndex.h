@@ -0,0 +1,87 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UDBTableCache.h"
+
+class UDataTable;
+class UScriptStruct;
+class FStructProperty;
+
+/**
+ * Reverse index from FGameplayTag to rows for the tag and tag container fields resolve_tags is
+ * asked about, built per (table, field) on first use. Lookups hash tags (FName compares) instead of
+ * converting every row's tags to strings; hierarchical lookups expand the requested tag through the
+ * gameplay tag tree and probe each descendant.
+ *
+ * Kept current like FUDBTableIndexes: patched by FUDBTableIndexes::FScopedRowChanges for the
+ * plugin's own writes, rebuilt on next use after any other change. Game thread only.
+ */
+class UNREALDATABRIDGE_API FUDBTagIndex
+{
+public:
+	struct FRowMatch
+	{
+		FName RowName;
+
+		/** The row's own tags that matched, in request order */
+		TArray<FGameplayTag> Tags;
+	};
+
+	/**
+	 * Rows whose Field holds one of Tags (or, when bHierarchical, a child of one), in table order.
+	 * OutResolved receives the requested tags that matched at least one row. Returns false if Field is
+	 * not a top-level FGameplayTag or FGameplayTagContainer of the row struct.
+	 */
+	static bool FindRows(const UDataTable* Table, FName Field, TConstArrayView<FGameplayTag> Tags, bool bHierarchical,
+		TArray<FRowMatch>& OutMatches, TSet<FGameplayTag>& OutResolved);
+
+	/** Whether the table currently has tag indexes (used to decide if a write must be tracked) */
+	static bool Contains(const UDataTable* Table);
+
+	static void ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows);
+
+	/** Drop every index */
+	static void Reset();
+
+private:
+	struct FFieldIndex
+	{
+		const FStructProperty* Property = nullptr;
+		bool bContainer = false;
+
+		/** Tag -> ascending row positions */
+		TMap<FGameplayTag, TArray<int32>> Postings;
+
+		/** Tags of each row position, to unlink a row when it changes */
+		TArray<TArray<FGameplayTag>> RowTags;
+
+		void Insert(int32 Position, const uint8* RowData);
+		void Remove(int32 Position);
+	};
+
+	struct FTableTags : FUDBTableCacheEntry
+	{
+		/** Row numbering shared by every field */
+		FUDBRowSlots Slots;
+
+		TMap<FName, TUniquePtr<FFieldIndex>> Fields;
+
+		void Rebuild(const UDataTable* InTable);
+		void BuildField(const UDataTable* InTable, FFieldIndex& Field);
+		void RemoveRow(FName RowName);
+
+		/** Unlink a position no row holds any more from every field */
+		void FreePosition(int32 Position);
+	};
+
+	/** The tag property named Field, or null if there is none */
+	static const FStructProperty* FindTagProperty(const UScriptStruct* RowStruct, FName Field, bool& bOutContainer);
+
+	/** Up-to-date index of a table's Field, built if missing; null if Field is not a tag field */
+	static FFieldIndex* Refresh(const UDataTable* Table, FName Field, FTableTags*& OutTableTags);
+
+	static TMap<const UDataTable*, TUniquePtr<FTableTags>> Tables;
+};
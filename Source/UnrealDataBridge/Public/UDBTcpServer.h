@@ -9,6 +9,15 @@
 class FSocket;
 class FTcpListener;
 
+/** How a request arrived, and therefore how its response is encoded */
+enum class EUDBWireEncoding : uint8
+{
+	/** Newline-delimited JSON text */
+	Json,
+	/** Length-prefixed MessagePack frame (see FUDBTcpServer::MsgPackFrameMarker) */
+	MsgPack,
+};
+
 class UNREALDATABRIDGE_API FUDBTcpServer
 {
 public:
@@ -26,8 +35,14 @@ private:
 	/** Process data for a single client socket. Returns false if client should be removed. */
 	bool ProcessSingleClient(FSocket* InClientSocket);
 
-	/** Send a JSON response string followed by newline delimiter to a specific client */
-	void SendResponse(FSocket* InClientSocket, const FString& ResponseString);
+	/** Run a decoded request ({command, params}) and send its result in the request's encoding */
+	void ExecuteRequest(FSocket* InClientSocket, const TSharedPtr<FJsonObject>& RequestJson, EUDBWireEncoding Encoding);
+
+	/** Serialize a command result and send it to a specific client: newline-terminated JSON or a MessagePack frame */
+	void SendResult(FSocket* InClientSocket, const FUDBCommandResult& Result, double TimingMs, EUDBWireEncoding Encoding);
+
+	/** Send already-encoded response bytes to a specific client */
+	void SendResponse(FSocket* InClientSocket, const uint8* Data, int32 Num);
 
 	/** Close and destroy a client socket */
 	void DestroyClientSocket(FSocket* InClientSocket);
@@ -35,10 +50,22 @@ private:
 	static constexpr double CommandTimeoutWarningSeconds = 30.0;
 	static constexpr int32 ReceiveBufferSize = 65536;
 
+	/**
+	 * First byte of a MessagePack frame: 0x01, then a big-endian uint32 payload length, then the payload.
+	 * JSON requests never start with a control character, so both encodings share one connection.
+	 */
+	static constexpr uint8 MsgPackFrameMarker = 0x01;
+	static constexpr int32 MsgPackFrameHeaderSize = 5;
+	static constexpr uint32 MaxMsgPackFrameSize = 256 * 1024 * 1024;
+
 	TUniquePtr<FTcpListener> Listener;
 	TArray<FSocket*> ClientSockets;
-	TMap<FSocket*, FString> ReceiveBuffers;
+	TMap<FSocket*, TArray<uint8>> ReceiveBuffers;
 	FThreadSafeBool bRunning = false;
 	FTSTicker::FDelegateHandle TickDelegateHandle;
 	FUDBCommandHandler CommandHandler;
+
+	/** Reused across responses so large payloads don't reallocate every command */
+	FUDBJsonBytes ResponseBuffer;
+	TArray<uint8> MsgPackResponseBuffer;
 };
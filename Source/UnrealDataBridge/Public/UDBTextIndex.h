@@ -0,0 +1,69 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UDBTableCache.h"
+
+class UDataTable;
+class UScriptStruct;
+
+/**
+ * Trigram inverted index over the FString, FName and FText fields of large DataTables
+ * (SearchIndexMinRows), so search_datatable_content only verifies rows that contain every
+ * three-character sequence of the search text instead of scanning the whole table. Text is
+ * case-folded, trigrams never span two fields, and each posting list holds row positions in
+ * ascending (table) order. Built on the first search of a table.
+ *
+ * Postings over-approximate: a row updated through FUDBTableIndexes::FScopedRowChanges gains the
+ * trigrams of its new text but keeps stale ones until the next rebuild, and removed rows are
+ * skipped, so callers must check each candidate. Anything the plugin did not write (editor edits,
+ * reimport, undo/redo) rebuilds the index on next use. Game thread only.
+ */
+class UNREALDATABRIDGE_API FUDBTextIndex
+{
+public:
+	/** Search texts shorter than this have no trigram to look up */
+	static constexpr int32 MinSearchLength = 3;
+
+	/** Whether the table is large enough to be indexed */
+	static bool IsEnabled(const UDataTable* Table);
+
+	/**
+	 * Rows that may contain SearchText (case-insensitive) in a searchable field, in table order.
+	 * Returns false when the table is not indexed or SearchText is too short; scan instead.
+	 */
+	static bool FindCandidates(const UDataTable* Table, const FString& SearchText, TArray<FName>& OutRows);
+
+	/** Whether the table currently has an index (used to decide if a write must be tracked) */
+	static bool Contains(const UDataTable* Table);
+
+	/** Add the new text of written rows and forget removed ones, or leave the index for a rebuild */
+	static void ApplyRowChanges(const UDataTable* Table, uint64 StartGeneration, TConstArrayView<FName> ChangedRows, TConstArrayView<FName> RemovedRows);
+
+	/** Drop every index */
+	static void Reset();
+
+private:
+	struct FTableText : FUDBTableCacheEntry
+	{
+		/** Positions that postings refer to */
+		FUDBRowSlots Slots;
+
+		/** Folded trigram -> ascending row positions */
+		TMap<uint64, TArray<int32>> Postings;
+
+		/** Rows patched since the build; their stale trigrams only cost extra verification */
+		int32 NumPatched = 0;
+
+		void Build(const UDataTable* InTable);
+
+		/** Add a row's trigrams at Position; bAppend when positions arrive in ascending order */
+		void AddRow(int32 Position, const void* RowData, bool bAppend);
+	};
+
+	/** Up-to-date index of a table; null if the table is below the threshold */
+	static FTableText* Refresh(const UDataTable* Table);
+
+	static TMap<const UDataTable*, TUniquePtr<FTableText>> Tables;
+};
@@ -2,8 +2,10 @@
 #pragma once
 
 #include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
 
 class FUDBTcpServer;
+class FUDBStructChangeListener;
 
 class FUnrealDataBridgeModule : public IModuleInterface
 {
@@ -12,5 +14,18 @@ public:
 	virtual void ShutdownModule() override;
 
 private:
+	/** Drop caches derived from struct reflection after hot reload / reinstancing */
+	void HandleReloadComplete(EReloadCompleteReason Reason);
+	void HandleObjectsReinstanced(const TMap<UObject*, UObject*>& OldToNewInstanceMap);
+	void InvalidateReflectionCaches();
+
+	friend class FUDBStructChangeListener;
+
 	TUniquePtr<FUDBTcpServer> TcpServer;
+
+	/** User-defined structs are recompiled in place, without reinstancing */
+	TUniquePtr<FUDBStructChangeListener> StructChangeListener;
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle ObjectsReinstancedHandle;
+	FDelegateHandle ObjectTransactedHandle;
 };
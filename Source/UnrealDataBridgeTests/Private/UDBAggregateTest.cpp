@@ -0,0 +1,173 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBAggregate.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBAggregateTest,
+	"UDB.Commands.Aggregate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBAggregateTest::RunTest(const FString& Parameters)
+{
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_AggregateTest"), 100);
+	FUDBCommandHandler Handler;
+
+	auto Aggregate = [&](std::initializer_list<const TCHAR*> Metrics, std::initializer_list<const TCHAR*> GroupBy, const TCHAR* Where)
+	{
+		TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("table_path"), Table->GetPathName());
+
+		TArray<TSharedPtr<FJsonValue>> MetricsArray;
+		for (const TCHAR* Metric : Metrics)
+		{
+			MetricsArray.Add(MakeShared<FJsonValueString>(Metric));
+		}
+		Params->SetArrayField(TEXT("metrics"), MetricsArray);
+
+		TArray<TSharedPtr<FJsonValue>> GroupByArray;
+		for (const TCHAR* Path : GroupBy)
+		{
+			GroupByArray.Add(MakeShared<FJsonValueString>(Path));
+		}
+		Params->SetArrayField(TEXT("group_by"), GroupByArray);
+
+		if (Where != nullptr)
+		{
+			Params->SetStringField(TEXT("where"), Where);
+		}
+		return Handler.Execute(TEXT("aggregate_datatable"), Params);
+	};
+
+	// --- Test 1: whole-table metrics ---
+	{
+		FUDBCommandResult Result = Aggregate({ TEXT("count"), TEXT("avg(Level)"), TEXT("sum(bIsBoss)"), TEXT("distinct(Stats.Cooldown)"), TEXT("count(Abilities.Damage)") }, {}, nullptr);
+		TestTrue(TEXT("aggregate_datatable should succeed"), Result.bSuccess);
+
+		const TSharedPtr<FJsonObject> Aggregates = Result.Data->GetObjectField(TEXT("aggregates"));
+		TestEqual(TEXT("count"), Aggregates->GetNumberField(TEXT("count")), 100.0);
+		TestEqual(TEXT("avg(Level)"), Aggregates->GetNumberField(TEXT("avg(Level)")), 49.5);
+		TestEqual(TEXT("Bools sum as 0/1"), Aggregates->GetNumberField(TEXT("sum(bIsBoss)")), 10.0);
+		TestEqual(TEXT("distinct(Stats.Cooldown)"), Aggregates->GetNumberField(TEXT("distinct(Stats.Cooldown)")), 5.0);
+		TestEqual(TEXT("Array paths count elements"), Aggregates->GetNumberField(TEXT("count(Abilities.Damage)")), 99.0);
+	}
+
+	// --- Test 2: group_by with where ---
+	{
+		FUDBCommandResult Result = Aggregate({ TEXT("count"), TEXT("max(Level)") }, { TEXT("Rarity") }, TEXT("Level < 40"));
+		TestTrue(TEXT("Grouped aggregate should succeed"), Result.bSuccess);
+		TestEqual(TEXT("row_count counts filtered rows"), static_cast<int32>(Result.Data->GetNumberField(TEXT("row_count"))), 40);
+
+		const TArray<TSharedPtr<FJsonValue>>& Groups = Result.Data->GetArrayField(TEXT("groups"));
+		if (TestEqual(TEXT("One group per rarity"), Groups.Num(), 4))
+		{
+			const TSharedPtr<FJsonObject> First = Groups[0]->AsObject();
+			TestEqual(TEXT("Groups in order of first appearance"), First->GetObjectField(TEXT("group"))->GetStringField(TEXT("Rarity")), FString(TEXT("Common")));
+			TestEqual(TEXT("Common rows below level 40"), First->GetNumberField(TEXT("count")), 10.0);
+			TestEqual(TEXT("Highest Common level below 40"), First->GetNumberField(TEXT("max(Level)")), 36.0);
+		}
+
+		FUDBCommandResult Empty = Aggregate({ TEXT("avg(Level)") }, {}, TEXT("Level > 1000"));
+		TestTrue(TEXT("avg over no rows is null"), Empty.Data->GetObjectField(TEXT("aggregates"))->HasTypedField<EJson::Null>(TEXT("avg(Level)")));
+	}
+
+	// --- Test 3: histograms ---
+	{
+		FUDBCommandResult Result = Aggregate({ TEXT("histogram(Level, 4)"), TEXT("histogram(Rarity)") }, {}, nullptr);
+		TestTrue(TEXT("Histogram aggregate should succeed"), Result.bSuccess);
+
+		const TSharedPtr<FJsonObject> Aggregates = Result.Data->GetObjectField(TEXT("aggregates"));
+		const TSharedPtr<FJsonObject> Numeric = Aggregates->GetObjectField(TEXT("histogram(Level)"));
+		TestEqual(TEXT("Histogram min"), Numeric->GetNumberField(TEXT("min")), 0.0);
+		TestEqual(TEXT("Histogram max"), Numeric->GetNumberField(TEXT("max")), 99.0);
+		const TArray<TSharedPtr<FJsonValue>>& Counts = Numeric->GetArrayField(TEXT("counts"));
+		if (TestEqual(TEXT("Four buckets"), Counts.Num(), 4))
+		{
+			for (const TSharedPtr<FJsonValue>& Count : Counts)
+			{
+				TestEqual(TEXT("Levels spread evenly"), Count->AsNumber(), 25.0);
+			}
+		}
+
+		const TSharedPtr<FJsonObject> Categorical = Aggregates->GetObjectField(TEXT("histogram(Rarity)"));
+		TestEqual(TEXT("Count per enum value"), Categorical->GetNumberField(TEXT("Legendary")), 25.0);
+	}
+
+	// --- Test 4: invalid metrics and group-by paths ---
+	{
+		TestFalse(TEXT("avg needs a number"), Aggregate({ TEXT("avg(DisplayName)") }, {}, nullptr).bSuccess);
+		TestFalse(TEXT("Unknown metric"), Aggregate({ TEXT("median(Level)") }, {}, nullptr).bSuccess);
+		TestFalse(TEXT("Unknown field"), Aggregate({ TEXT("sum(Levle)") }, {}, nullptr).bSuccess);
+		TestFalse(TEXT("Array paths cannot be grouped by"), Aggregate({ TEXT("count") }, { TEXT("Abilities.Damage") }, nullptr).bSuccess);
+	}
+
+	// --- Test 5: numeric group and distinct keys keep every digit ---
+	{
+		UDataTable* Close = UDBTest::CreateTestTable(TEXT("DT_AggregateKeyTest"), 4);
+		const float Weights[] = { 0.1234567f, 0.1234568f, 0.1234567f, 2.5f };
+		int32 RowIndex = 0;
+		for (const TPair<FName, uint8*>& RowPair : Close->GetRowMap())
+		{
+			reinterpret_cast<FUDBTestRow*>(RowPair.Value)->Weight = Weights[RowIndex++];
+		}
+		Close->HandleDataTableChanged();
+
+		FString Error;
+		TSharedPtr<const FUDBAggregate> Compiled = FUDBAggregate::Compile(FUDBTestRow::StaticStruct(), { TEXT("count") }, { TEXT("Weight") }, Error);
+		TArray<const void*> Rows;
+		for (const TPair<FName, uint8*>& RowPair : Close->GetRowMap())
+		{
+			Rows.Add(RowPair.Value);
+		}
+		if (TestTrue(TEXT("Key aggregate should compile"), Compiled.IsValid()))
+		{
+			const TSharedPtr<FJsonObject> Grouped = Compiled->Run(Rows, 1);
+			const TArray<TSharedPtr<FJsonValue>>& Groups = Grouped->GetArrayField(TEXT("groups"));
+			if (TestEqual(TEXT("Weights a ten-millionth apart are separate groups"), Groups.Num(), 3))
+			{
+				TestEqual(TEXT("First key reported exactly"), Groups[0]->AsObject()->GetObjectField(TEXT("group"))->GetNumberField(TEXT("Weight")), 0.1234567);
+				TestEqual(TEXT("Second key reported exactly"), Groups[1]->AsObject()->GetObjectField(TEXT("group"))->GetNumberField(TEXT("Weight")), 0.1234568);
+				TestEqual(TEXT("Repeated weight grouped"), Groups[0]->AsObject()->GetNumberField(TEXT("count")), 2.0);
+			}
+
+			TSharedPtr<const FUDBAggregate> Distinct = FUDBAggregate::Compile(FUDBTestRow::StaticStruct(), { TEXT("distinct(Weight)") }, {}, Error);
+			TestEqual(TEXT("Distinct counts close weights apart"),
+				Distinct->Run(Rows, 1)->GetObjectField(TEXT("aggregates"))->GetNumberField(TEXT("distinct(Weight)")), 3.0);
+		}
+	}
+
+	// --- Test 6: parallel chunks reduce to the same result as one pass ---
+	{
+		UDataTable* Large = UDBTest::CreateTestTable(TEXT("DT_AggregateParallelTest"), 1000);
+		TArray<const void*> Rows;
+		for (const TPair<FName, uint8*>& RowPair : Large->GetRowMap())
+		{
+			Rows.Add(RowPair.Value);
+		}
+
+		FString Error;
+		TSharedPtr<const FUDBAggregate> Compiled = FUDBAggregate::Compile(FUDBTestRow::StaticStruct(),
+			{ TEXT("count"), TEXT("sum(Level)"), TEXT("distinct(Stats.Damage)"), TEXT("histogram(Stats.Damage, 5)") }, { TEXT("Rarity"), TEXT("bIsBoss") }, Error);
+		if (!TestTrue(TEXT("Aggregate should compile"), Compiled.IsValid()))
+		{
+			return true;
+		}
+
+		auto ToString = [](const TSharedPtr<FJsonObject>& Json)
+		{
+			FString Out;
+			FJsonSerializer::Serialize(Json.ToSharedRef(), TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Out));
+			return Out;
+		};
+		TestEqual(TEXT("Parallel and serial results match"), ToString(Compiled->Run(Rows, 7)), ToString(Compiled->Run(Rows, 1)));
+	}
+
+	return true;
+}
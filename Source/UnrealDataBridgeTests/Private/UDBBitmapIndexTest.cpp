@@ -0,0 +1,151 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBTableIndexes.h"
+#include "UDBRoaringBitmap.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBBitmapIndexTest,
+	"UDB.Commands.BitmapIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBBitmapIndexTest::RunTest(const FString& Parameters)
+{
+	// --- Test 1: roaring containers switch between arrays and bitmaps ---
+	{
+		FUDBRoaringBitmap Bitmap;
+		for (uint32 Value = 0; Value < 5000; ++Value)
+		{
+			Bitmap.Add(Value * 2);
+		}
+		Bitmap.Add(70000);
+		Bitmap.Add(70000);
+		TestEqual(TEXT("Duplicates are ignored"), Bitmap.Num(), int64(5001));
+		TestTrue(TEXT("Dense container holds its values"), Bitmap.Contains(9998) && !Bitmap.Contains(9999));
+		TestTrue(TEXT("Second container"), Bitmap.Contains(70000) && !Bitmap.Contains(70001));
+
+		for (uint32 Value = 0; Value < 1000; ++Value)
+		{
+			Bitmap.Remove(Value * 2);
+		}
+		TestEqual(TEXT("Back to an array container"), Bitmap.Num(), int64(4001));
+		TestTrue(TEXT("Removed values are gone"), !Bitmap.Contains(0) && Bitmap.Contains(2000));
+
+		TArray<uint64> Words;
+		Words.SetNumZeroed(FMath::DivideAndRoundUp(70001, 64));
+		Bitmap.OrInto(Words);
+		TestEqual(TEXT("Word for values 2048..2111"), Words[32], 0x5555555555555555ull);
+		TestEqual(TEXT("Bit 70000"), Words[70000 / 64], uint64(1) << (70000 % 64));
+
+		Bitmap.Remove(70000);
+		Bitmap.Reset();
+		TestTrue(TEXT("Reset empties the set"), Bitmap.IsEmpty());
+	}
+
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_BitmapIndexTest"), 200);
+	FUDBCommandHandler Handler;
+
+	FString IndexType;
+	FString IndexField;
+
+	// Each query records the index that served it in IndexType / IndexField
+	auto Query = [&](const FString& Where)
+	{
+		return UDBTest::QueryIndexed(*this, Handler, Table, Where, IndexType, IndexField);
+	};
+
+	const TCHAR* Expressions[] = {
+		TEXT("Rarity in (Epic, Legendary) and not bIsBoss"),
+		TEXT("Rarity == Common or bIsBoss"),
+		TEXT("Rarity >= Rare and Rarity != Legendary"),
+		TEXT("not (bIsBoss or Rarity < Epic)"),
+		TEXT("not Tags"),
+		TEXT("Tags or bIsBoss == false"),
+	};
+	TArray<int32> Scanned;
+	for (const TCHAR* Where : Expressions)
+	{
+		Scanned.Add(UDBTest::GetTotalCount(Query(Where)));
+	}
+	TestEqual(TEXT("Scan count"), Scanned[0], 90);
+
+	// --- Test 2: bitmap-indexed expressions are answered exactly ---
+	{
+		FUDBCommandResult Created = UDBTest::CreateIndex(Handler, Table, TEXT("Rarity"), TEXT("bitmap"));
+		TestTrue(TEXT("Bitmap index on an enum"), Created.bSuccess);
+		TestEqual(TEXT("One bitmap per rarity"), static_cast<int32>(Created.Data->GetNumberField(TEXT("key_count"))), 4);
+		TestTrue(TEXT("Bitmap index on a bool"), UDBTest::CreateIndex(Handler, Table, TEXT("bIsBoss"), TEXT("bitmap")).bSuccess);
+		TestTrue(TEXT("Bitmap index on a tag container"), UDBTest::CreateIndex(Handler, Table, TEXT("Tags"), TEXT("bitmap")).bSuccess);
+
+		for (int32 ExpressionIndex = 0; ExpressionIndex < Scanned.Num(); ++ExpressionIndex)
+		{
+			TestEqual(FString::Printf(TEXT("'%s' equals the scan"), Expressions[ExpressionIndex]),
+				UDBTest::GetTotalCount(Query(Expressions[ExpressionIndex])), Scanned[ExpressionIndex]);
+			TestEqual(TEXT("Served by bitmaps"), IndexType, FString(TEXT("bitmap")));
+		}
+		Query(Expressions[0]);
+		TestEqual(TEXT("Fields combined"), IndexField, FString(TEXT("bIsBoss, Rarity")));
+
+		// A non-indexed conjunct: bitmaps narrow the candidates, the filter does the rest
+		const int32 Mixed = UDBTest::GetTotalCount(Query(TEXT("Rarity == Epic and Level < 50")));
+		TestEqual(TEXT("Mixed expression"), Mixed, 24);
+		TestTrue(TEXT("Indexed conjunct used"), IndexType == TEXT("bitmap") && IndexField == TEXT("Rarity"));
+	}
+
+	// --- Test 3: plugin writes patch the bitmaps ---
+	{
+		TSharedPtr<FJsonObject> RowData = MakeShared<FJsonObject>();
+		RowData->SetStringField(TEXT("Rarity"), TEXT("Legendary"));
+		RowData->SetBoolField(TEXT("bIsBoss"), false);
+
+		TSharedPtr<FJsonObject> Update = UDBTest::MakeQueryParams(Table);
+		Update->SetStringField(TEXT("row_name"), TEXT("Row_10"));
+		Update->SetObjectField(TEXT("row_data"), RowData);
+		TestTrue(TEXT("Update should succeed"), Handler.Execute(TEXT("update_datatable_row"), Update).bSuccess);
+		TestEqual(TEXT("Updated row joins"), UDBTest::GetTotalCount(Query(Expressions[0])), 91);
+
+		TSharedPtr<FJsonObject> Delete = UDBTest::MakeQueryParams(Table);
+		Delete->SetStringField(TEXT("row_name"), TEXT("Row_3"));
+		TestTrue(TEXT("Delete should succeed"), Handler.Execute(TEXT("delete_datatable_row"), Delete).bSuccess);
+		TestEqual(TEXT("Deleted row leaves"), UDBTest::GetTotalCount(Query(Expressions[0])), 90);
+		TestEqual(TEXT("Not excludes deleted rows"), UDBTest::GetTotalCount(Query(TEXT("not bIsBoss"))), 180);
+
+		TSharedPtr<FJsonObject> Add = UDBTest::MakeQueryParams(Table);
+		Add->SetStringField(TEXT("row_name"), TEXT("Row_New"));
+		Add->SetObjectField(TEXT("row_data"), RowData);
+		TestTrue(TEXT("Add should succeed"), Handler.Execute(TEXT("add_datatable_row"), Add).bSuccess);
+
+		// Row_New lands in the slot Row_3 freed; the bitmap rows must come back where a scan has them
+		const TArray<FString> Indexed = UDBTest::GetRowNames(Query(Expressions[0]));
+		TestEqual(TEXT("Added row joins"), Indexed.Num(), 91);
+		TestTrue(TEXT("Still served by bitmaps"), IndexType == TEXT("bitmap") && IndexField == TEXT("bIsBoss, Rarity"));
+		const TArray<FString> ScannedRows = UDBTest::GetRowNames(Query(FString(Expressions[0]) + TEXT(" or Level > 1000")));
+		TestTrue(TEXT("The or on Level scanned"), IndexType.IsEmpty());
+		TestTrue(TEXT("Bitmap rows are in scan order"), Indexed == ScannedRows);
+	}
+
+	// --- Test 4: editor edits rebuild, unsupported fields are refused ---
+	{
+		Table->FindRow<FUDBTestRow>(TEXT("Row_2"), TEXT("BitmapIndexTest"))->bIsBoss = true;
+		Table->HandleDataTableChanged(TEXT("Row_2"));
+		TestEqual(TEXT("Editor edit is picked up"), UDBTest::GetTotalCount(Query(Expressions[0])), 90);
+
+		TestFalse(TEXT("Numbers need a hash or sorted index"), UDBTest::CreateIndex(Handler, Table, TEXT("Level"), TEXT("bitmap")).bSuccess);
+		TestFalse(TEXT("Strings need a hash index"), UDBTest::CreateIndex(Handler, Table, TEXT("DisplayName"), TEXT("bitmap")).bSuccess);
+
+		TestTrue(TEXT("A hash index replaces the bitmap"), UDBTest::CreateIndex(Handler, Table, TEXT("Rarity"), TEXT("hash")).bSuccess);
+		TArray<TPair<FString, EUDBIndexType>> Indexes = FUDBTableIndexes::GetIndexes(Table);
+		TestEqual(TEXT("One index per field"), Indexes.FilterByPredicate([](const TPair<FString, EUDBIndexType>& Pair)
+		{
+			return Pair.Key == TEXT("Rarity");
+		}).Num(), 1);
+	}
+
+	FUDBTableIndexes::Reset();
+	return true;
+}
@@ -0,0 +1,242 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBColumnStore.h"
+#include "UDBAggregate.h"
+#include "UDBRowFilter.h"
+#include "UDBSettings.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+
+namespace UDBColumnStoreTest
+{
+	/** Row-wise reference: one byte per row in table order */
+	static TArray<uint8> MatchRows(const UDataTable* Table, const FUDBRowFilter& Filter)
+	{
+		TArray<uint8> Mask;
+		for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+		{
+			Mask.Add(Filter.Matches(Row.Value) ? 1 : 0);
+		}
+		return Mask;
+	}
+
+	/** Overrides ColumnStoreMinRows for the lifetime of a test */
+	struct FScopedMinRows
+	{
+		explicit FScopedMinRows(int32 MinRows)
+			: Previous(UUDBSettings::Get()->ColumnStoreMinRows)
+		{
+			GetMutableDefault<UUDBSettings>()->ColumnStoreMinRows = MinRows;
+		}
+		~FScopedMinRows()
+		{
+			GetMutableDefault<UUDBSettings>()->ColumnStoreMinRows = Previous;
+			FUDBColumnStore::Reset();
+		}
+		int32 Previous;
+	};
+}
+
+// ============================================================================
+// Test: column-wise filters and aggregates agree with the row-wise path
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBColumnStoreTest,
+	"UDB.Commands.ColumnStore",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBColumnStoreTest::RunTest(const FString& Parameters)
+{
+	using namespace UDBColumnStoreTest;
+	FScopedMinRows MinRows(100);
+
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_ColumnStoreTest"), 400);
+	const UScriptStruct* RowStruct = Table->GetRowStruct();
+	FUDBCommandHandler Handler;
+
+	auto CountMatches = [&](const TCHAR* Where) -> int32
+	{
+		FString Error;
+		TSharedPtr<const FUDBRowFilter> Filter = FUDBRowFilter::Compile(RowStruct, Where, Error);
+		FUDBColumnStore::FScan Scan;
+		if (!Filter.IsValid() || !FUDBColumnStore::Scan(Table, Filter.Get(), Scan))
+		{
+			AddError(FString::Printf(TEXT("'%s' should run on columns"), Where));
+			return -1;
+		}
+		TestTrue(FString::Printf(TEXT("'%s' columns match rows"), Where), Scan.Mask == MatchRows(Table, *Filter));
+
+		int32 Count = 0;
+		for (uint8 Selected : Scan.Mask)
+		{
+			Count += Selected;
+		}
+		return Count;
+	};
+
+	// --- Test 1: column masks equal row-wise evaluation ---
+	{
+		TestEqual(TEXT("Level and Rarity"), CountMatches(TEXT("Level >= 50 and Rarity in (Epic, Legendary)")), 104);
+		CountMatches(TEXT("not bIsBoss or Stats.Cooldown == 3"));
+		CountMatches(TEXT("bIsBoss == false and Weight < 3.5"));
+		CountMatches(TEXT("Level != 10 and (Stats.Damage <= 12 or Stats.Damage > 55)"));
+
+		FString Error;
+		FUDBColumnStore::FScan Scan;
+		TSharedPtr<const FUDBRowFilter> Strings = FUDBRowFilter::Compile(RowStruct, TEXT("DisplayName contains \"1\""), Error);
+		TestFalse(TEXT("String conditions need rows"), FUDBColumnStore::Scan(Table, Strings.Get(), Scan));
+		TSharedPtr<const FUDBRowFilter> Arrays = FUDBRowFilter::Compile(RowStruct, TEXT("Level > 5 and Abilities.Damage > 0"), Error);
+		TestFalse(TEXT("Array paths need rows"), FUDBColumnStore::Scan(Table, Arrays.Get(), Scan));
+	}
+
+	// --- Test 2: aggregate_datatable runs column-wise with the same result ---
+	{
+		auto RunAggregate = [&]()
+		{
+			TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+			Params->SetStringField(TEXT("table_path"), Table->GetPathName());
+			Params->SetStringField(TEXT("where"), TEXT("bIsBoss"));
+			TArray<TSharedPtr<FJsonValue>> Metrics;
+			for (const TCHAR* Metric : { TEXT("count"), TEXT("sum(Level)"), TEXT("avg(Stats.Damage)"), TEXT("min(Level)"), TEXT("max(Stats.Cooldown)") })
+			{
+				Metrics.Add(MakeShared<FJsonValueString>(Metric));
+			}
+			Params->SetArrayField(TEXT("metrics"), Metrics);
+			return Handler.Execute(TEXT("aggregate_datatable"), Params);
+		};
+
+		FUDBCommandResult Columnar = RunAggregate();
+		TestTrue(TEXT("Aggregate should succeed"), Columnar.bSuccess);
+		TestTrue(TEXT("Aggregate ran on columns"), Columnar.Data->HasField(TEXT("columnar")));
+		const TSharedPtr<FJsonObject> Expected = Columnar.Data->GetObjectField(TEXT("aggregates"));
+		TestEqual(TEXT("Boss levels sum"), Expected->GetNumberField(TEXT("sum(Level)")), 1800.0);
+
+		GetMutableDefault<UUDBSettings>()->ColumnStoreMinRows = 0;
+		FUDBCommandResult RowWise = RunAggregate();
+		GetMutableDefault<UUDBSettings>()->ColumnStoreMinRows = 100;
+		TestFalse(TEXT("Disabled store falls back to rows"), RowWise.Data->HasField(TEXT("columnar")));
+
+		const TSharedPtr<FJsonObject> Actual = RowWise.Data->GetObjectField(TEXT("aggregates"));
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Expected->Values)
+		{
+			TestEqual(FString::Printf(TEXT("%s matches the row-wise path"), *Pair.Key), Actual->GetNumberField(Pair.Key), Pair.Value->AsNumber());
+		}
+	}
+
+	// --- Test 3: columns follow plugin writes and editor edits ---
+	{
+		TSharedPtr<FJsonObject> RowData = MakeShared<FJsonObject>();
+		RowData->SetNumberField(TEXT("Level"), 1000);
+		TSharedPtr<FJsonObject> Update = MakeShared<FJsonObject>();
+		Update->SetStringField(TEXT("table_path"), Table->GetPathName());
+		Update->SetStringField(TEXT("row_name"), TEXT("Row_5"));
+		Update->SetObjectField(TEXT("row_data"), RowData);
+		TestTrue(TEXT("Update should succeed"), Handler.Execute(TEXT("update_datatable_row"), Update).bSuccess);
+		TestEqual(TEXT("Updated row is patched in"), CountMatches(TEXT("Level >= 1000")), 1);
+
+		Table->FindRow<FUDBTestRow>(TEXT("Row_6"), TEXT("ColumnStoreTest"))->Level = 1001;
+		Table->HandleDataTableChanged(TEXT("Row_6"));
+		TestEqual(TEXT("Editor edit is picked up"), CountMatches(TEXT("Level >= 1000")), 2);
+
+		TSharedPtr<FJsonObject> Delete = MakeShared<FJsonObject>();
+		Delete->SetStringField(TEXT("table_path"), Table->GetPathName());
+		Delete->SetStringField(TEXT("row_name"), TEXT("Row_5"));
+		TestTrue(TEXT("Delete should succeed"), Handler.Execute(TEXT("delete_datatable_row"), Delete).bSuccess);
+		TestEqual(TEXT("Deleted row is gone"), CountMatches(TEXT("Level >= 1000")), 1);
+	}
+
+	return true;
+}
+
+// ============================================================================
+// Benchmark: row-wise vs column-wise filter + aggregate on 100k rows
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBColumnStoreBenchmark,
+	"UDB.Perf.ColumnStore",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FUDBColumnStoreBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace UDBColumnStoreTest;
+	FScopedMinRows MinRows(1);
+
+	const int32 NumRows = 100000;
+	const int32 Iterations = 5;
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_ColumnStoreBenchmark"), NumRows);
+	const UScriptStruct* RowStruct = Table->GetRowStruct();
+
+	auto BestOf = [Iterations](TFunctionRef<void()> Body)
+	{
+		double BestMs = TNumericLimits<double>::Max();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const double Start = FPlatformTime::Seconds();
+			Body();
+			BestMs = FMath::Min(BestMs, (FPlatformTime::Seconds() - Start) * 1000.0);
+		}
+		return BestMs;
+	};
+
+	const double BuildStart = FPlatformTime::Seconds();
+	FUDBColumnStore::FScan Warmup;
+	FUDBColumnStore::Scan(Table, nullptr, Warmup);
+	AddInfo(FString::Printf(TEXT("%d rows mirrored in %.2f ms"), NumRows, (FPlatformTime::Seconds() - BuildStart) * 1000.0));
+
+	for (const TCHAR* Where : { TEXT("Level >= 50"), TEXT("Level >= 50 and Rarity in (Epic, Legendary) and not bIsBoss") })
+	{
+		FString Error;
+		TSharedPtr<const FUDBRowFilter> Filter = FUDBRowFilter::Compile(RowStruct, Where, Error);
+		TSharedPtr<const FUDBAggregate> Aggregate = FUDBAggregate::Compile(RowStruct, { TEXT("count"), TEXT("avg(Stats.Damage)"), TEXT("max(Weight)") }, {}, Error);
+		if (!TestTrue(TEXT("Filter and aggregate should compile"), Filter.IsValid() && Aggregate.IsValid()))
+		{
+			return true;
+		}
+
+		TSharedPtr<FJsonObject> RowResult;
+		const double RowMs = BestOf([&]()
+		{
+			TArray<const void*> Rows;
+			for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+			{
+				if (Filter->Matches(Row.Value))
+				{
+					Rows.Add(Row.Value);
+				}
+			}
+			RowResult = Aggregate->Run(Rows, 1);
+		});
+
+		TSharedPtr<FJsonObject> ColumnResult;
+		const double ColumnMs = BestOf([&]()
+		{
+			FUDBColumnStore::FScan Scan;
+			FUDBColumnStore::Scan(Table, Filter.Get(), Scan);
+			TArray<const FUDBRowFilter::FAccessor*> Accessors;
+			Aggregate->GetColumnAccessors(Accessors);
+			TArray<TConstArrayView<double>> Columns;
+			for (const FUDBRowFilter::FAccessor* Accessor : Accessors)
+			{
+				Columns.Add(Accessor != nullptr ? FUDBColumnStore::GetColumn(Table, *Accessor) : TConstArrayView<double>());
+			}
+			ColumnResult = Aggregate->RunOnColumns(Columns, Scan.Mask);
+		});
+
+		AddInfo(FString::Printf(TEXT("'%s': rows %.2f ms, columns %.2f ms (%.1fx)"),
+			Where, RowMs, ColumnMs, ColumnMs > 0.0 ? RowMs / ColumnMs : 0.0));
+
+		const TSharedPtr<FJsonObject> Expected = RowResult->GetObjectField(TEXT("aggregates"));
+		const TSharedPtr<FJsonObject> Actual = ColumnResult->GetObjectField(TEXT("aggregates"));
+		TestEqual(TEXT("Same count"), Actual->GetNumberField(TEXT("count")), Expected->GetNumberField(TEXT("count")));
+		TestEqual(TEXT("Same max"), Actual->GetNumberField(TEXT("max(Weight)")), Expected->GetNumberField(TEXT("max(Weight)")));
+		TestTrue(TEXT("Same average"), FMath::IsNearlyEqual(Actual->GetNumberField(TEXT("avg(Stats.Damage)")), Expected->GetNumberField(TEXT("avg(Stats.Damage)")), 1e-9));
+	}
+
+	return true;
+}
@@ -0,0 +1,77 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBColumnarQueryTest,
+	"UDB.Commands.ColumnarQuery",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBColumnarQueryTest::RunTest(const FString& Parameters)
+{
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_ColumnarQueryTest"), 40);
+	FUDBCommandHandler Handler;
+
+	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetStringField(TEXT("table_path"), Table->GetPathName());
+	Params->SetNumberField(TEXT("limit"), 40);
+	Params->SetStringField(TEXT("format"), TEXT("columnar"));
+
+	FUDBCommandResult Result = Handler.Execute(TEXT("query_datatable"), Params);
+	TestTrue(TEXT("Columnar query should succeed"), Result.bSuccess);
+	if (!Result.bSuccess || !Result.Data.IsValid())
+	{
+		return true;
+	}
+
+	TestFalse(TEXT("Columnar result should not contain rows"), Result.Data->HasField(TEXT("rows")));
+	TestEqual(TEXT("row_names should hold the page"), Result.Data->GetArrayField(TEXT("row_names")).Num(), 40);
+
+	const TSharedPtr<FJsonObject> Columns = Result.Data->GetObjectField(TEXT("columns"));
+
+	// --- Numeric columns are plain arrays in row order ---
+	const TArray<TSharedPtr<FJsonValue>>* Levels = nullptr;
+	TestTrue(TEXT("Level should be a plain array"), Columns->TryGetArrayField(TEXT("Level"), Levels));
+	if (Levels != nullptr && Levels->Num() == 40)
+	{
+		TestEqual(TEXT("Row_7 level"), static_cast<int32>((*Levels)[7]->AsNumber()), 7);
+	}
+
+	// --- Enum columns are dictionary-encoded ---
+	const TSharedPtr<FJsonObject>* Rarity = nullptr;
+	TestTrue(TEXT("Rarity should be dictionary-encoded"), Columns->TryGetObjectField(TEXT("Rarity"), Rarity));
+	if (Rarity != nullptr)
+	{
+		const TArray<TSharedPtr<FJsonValue>>& Dict = (*Rarity)->GetArrayField(TEXT("dict"));
+		const TArray<TSharedPtr<FJsonValue>>& Codes = (*Rarity)->GetArrayField(TEXT("codes"));
+		TestEqual(TEXT("Four distinct rarities"), Dict.Num(), 4);
+		TestEqual(TEXT("One code per row"), Codes.Num(), 40);
+		if (Codes.Num() == 40 && Dict.Num() == 4)
+		{
+			TestEqual(TEXT("Row_5 rarity decodes"), Dict[static_cast<int32>(Codes[5]->AsNumber())]->AsString(), FString(TEXT("Rare")));
+		}
+	}
+
+	// --- Unique strings stay plain ---
+	const TArray<TSharedPtr<FJsonValue>>* Names = nullptr;
+	TestTrue(TEXT("Unique DisplayName values should not be dictionary-encoded"), Columns->TryGetArrayField(TEXT("DisplayName"), Names));
+
+	// --- Projection selects columns ---
+	Params->SetArrayField(TEXT("fields"), { MakeShared<FJsonValueString>(TEXT("Stats.Damage")) });
+	FUDBCommandResult Projected = Handler.Execute(TEXT("query_datatable"), Params);
+	TestEqual(TEXT("Projected result should have one column"),
+		Projected.Data->GetObjectField(TEXT("columns"))->Values.Num(), 1);
+
+	// --- Unknown format is rejected ---
+	Params->SetStringField(TEXT("format"), TEXT("csv"));
+	FUDBCommandResult BadFormat = Handler.Execute(TEXT("query_datatable"), Params);
+	TestFalse(TEXT("Unknown format should fail"), BadFormat.bSuccess);
+	TestEqual(TEXT("Unknown format error code"), BadFormat.ErrorCode, UDBErrorCodes::InvalidValue);
+
+	return true;
+}
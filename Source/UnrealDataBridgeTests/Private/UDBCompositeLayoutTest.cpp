@@ -0,0 +1,126 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBCompositeLayout.h"
+#include "UDBTestRow.h"
+#include "Engine/CompositeDataTable.h"
+#include "UObject/Package.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBCompositeLayoutTest,
+	"UDB.Commands.CompositeLayout",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+namespace
+{
+	UCompositeDataTable* CreateTestComposite(const FString& TableName, const TArray<UDataTable*>& Parents)
+	{
+		UPackage* TestPackage = CreatePackage(*FString::Printf(TEXT("/Temp/UDBTest_%s"), *TableName));
+		UCompositeDataTable* Composite = NewObject<UCompositeDataTable>(TestPackage, FName(*TableName), RF_Public | RF_Standalone | RF_Transactional);
+		Composite->RowStruct = FUDBTestRow::StaticStruct();
+		Composite->AppendParentTables(Parents);
+		return Composite;
+	}
+}
+
+bool FUDBCompositeLayoutTest::RunTest(const FString& Parameters)
+{
+	// Outer = [Inner = [Base, Patch], Extra]: Patch overrides Row_0..4, Extra overrides Row_0..1 again
+	UDataTable* Base = UDBTest::CreateTestTable(TEXT("DT_CompositeBase"), 20);
+	UDataTable* Patch = UDBTest::CreateTestTable(TEXT("DT_CompositePatch"), 5);
+	UDataTable* Extra = UDBTest::CreateTestTable(TEXT("DT_CompositeExtra"), 2);
+	UCompositeDataTable* Inner = CreateTestComposite(TEXT("DT_CompositeInner"), { Base, Patch });
+	UCompositeDataTable* Outer = CreateTestComposite(TEXT("DT_CompositeOuter"), { Inner, Extra });
+
+	FUDBCommandHandler Handler;
+
+	auto GetLayout = [&](UDataTable* Table)
+	{
+		TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("table_path"), Table->GetPathName());
+		return Handler.Execute(TEXT("get_composite_layout"), Params);
+	};
+
+	// Source index of each reported row
+	auto GetSources = [](const FUDBCommandResult& Result)
+	{
+		TMap<FString, int32> Sources;
+		for (const TSharedPtr<FJsonValue>& Row : Result.Data->GetArrayField(TEXT("rows")))
+		{
+			Sources.Add(Row->AsObject()->GetStringField(TEXT("row_name")), static_cast<int32>(Row->AsObject()->GetNumberField(TEXT("source"))));
+		}
+		return Sources;
+	};
+
+	// --- Test 1: nested composites flatten into override order ---
+	{
+		FUDBCommandResult Result = GetLayout(Outer);
+		TestTrue(TEXT("get_composite_layout should succeed"), Result.bSuccess);
+		TestEqual(TEXT("Three sources"), Result.Data->GetArrayField(TEXT("sources")).Num(), 3);
+		TestEqual(TEXT("Row count"), static_cast<int32>(Result.Data->GetNumberField(TEXT("row_count"))), 20);
+		TestEqual(TEXT("Overridden rows"), static_cast<int32>(Result.Data->GetNumberField(TEXT("overridden_count"))), 5);
+
+		const TSharedPtr<FJsonObject> Row0 = Result.Data->GetArrayField(TEXT("rows"))[0]->AsObject();
+		TestEqual(TEXT("Row_0 is held by every source"), Row0->GetArrayField(TEXT("chain")).Num(), 3);
+
+		TMap<FString, int32> Sources = GetSources(Result);
+		TestEqual(TEXT("Extra owns Row_1"), Sources.FindRef(TEXT("Row_1")), 2);
+		TestEqual(TEXT("Patch owns Row_3"), Sources.FindRef(TEXT("Row_3")), 1);
+		TestEqual(TEXT("Base owns Row_10"), Sources.FindRef(TEXT("Row_10")), 0);
+		TestTrue(TEXT("Writes resolve through the layout"), FUDBCompositeLayout::FindSourceTable(Outer, TEXT("Row_3")) == Patch);
+
+		TestFalse(TEXT("A plain table has no layout"), GetLayout(Base).bSuccess);
+	}
+
+	// --- Test 2: filters ---
+	{
+		TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("table_path"), Outer->GetPathName());
+		Params->SetBoolField(TEXT("overridden_only"), true);
+		TestEqual(TEXT("Only overridden rows"), Handler.Execute(TEXT("get_composite_layout"), Params).Data->GetArrayField(TEXT("rows")).Num(), 5);
+
+		TArray<TSharedPtr<FJsonValue>> RowNames;
+		RowNames.Add(MakeShared<FJsonValueString>(TEXT("Row_12")));
+		RowNames.Add(MakeShared<FJsonValueString>(TEXT("Row_Missing")));
+		Params->SetBoolField(TEXT("overridden_only"), false);
+		Params->SetArrayField(TEXT("row_names"), RowNames);
+		FUDBCommandResult Result = Handler.Execute(TEXT("get_composite_layout"), Params);
+		TestEqual(TEXT("Requested row only"), Result.Data->GetArrayField(TEXT("rows")).Num(), 1);
+		TestEqual(TEXT("Unknown row reported"), Result.Data->GetArrayField(TEXT("missing_rows")).Num(), 1);
+	}
+
+	// --- Test 3: rows added and removed through MCP patch the layout ---
+	{
+		TSharedPtr<FJsonObject> Add = MakeShared<FJsonObject>();
+		Add->SetStringField(TEXT("table_path"), Patch->GetPathName());
+		Add->SetStringField(TEXT("row_name"), TEXT("Row_New"));
+		Add->SetObjectField(TEXT("row_data"), MakeShared<FJsonObject>());
+		TestTrue(TEXT("Add should succeed"), Handler.Execute(TEXT("add_datatable_row"), Add).bSuccess);
+
+		TSharedPtr<FJsonObject> Delete = MakeShared<FJsonObject>();
+		Delete->SetStringField(TEXT("table_path"), Outer->GetPathName());
+		Delete->SetStringField(TEXT("row_name"), TEXT("Row_3"));
+		TestTrue(TEXT("Delete through the composite should succeed"), Handler.Execute(TEXT("delete_datatable_row"), Delete).bSuccess);
+		TestNull(TEXT("Deleted from the owning source"), Patch->FindRowUnchecked(TEXT("Row_3")));
+
+		FUDBCommandResult Result = GetLayout(Outer);
+		TMap<FString, int32> Sources = GetSources(Result);
+		TestTrue(TEXT("Added row is mapped"), Sources.Contains(TEXT("Row_New")) && Sources[TEXT("Row_New")] == 1);
+		TestTrue(TEXT("Base supplies Row_3 again"), Sources.Contains(TEXT("Row_3")) && Sources[TEXT("Row_3")] == 0);
+		TestEqual(TEXT("Row count"), static_cast<int32>(Result.Data->GetNumberField(TEXT("row_count"))), 21);
+	}
+
+	// --- Test 4: editor edits of a source rebuild the layout ---
+	{
+		Extra->RemoveRow(TEXT("Row_1"));
+		Extra->HandleDataTableChanged();
+		TestTrue(TEXT("Patch owns Row_1 again"), FUDBCompositeLayout::FindSourceTable(Outer, TEXT("Row_1")) == Patch);
+	}
+
+	FUDBCompositeLayout::Reset();
+	return true;
+}
@@ -0,0 +1,78 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBETagTest,
+	"UDB.Commands.ETag",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBETagTest::RunTest(const FString& Parameters)
+{
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_ETagTest"), 10);
+	FUDBCommandHandler Handler;
+
+	auto IsNotModified = [](const FUDBCommandResult& Result)
+	{
+		bool bNotModified = false;
+		return Result.bSuccess && Result.Data->TryGetBoolField(TEXT("not_modified"), bNotModified) && bNotModified;
+	};
+
+	auto ChangeRow = [&](const TCHAR* RowName, int32 Level)
+	{
+		Table->FindRow<FUDBTestRow>(RowName, TEXT("ETagTest"))->Level = Level;
+		Table->HandleDataTableChanged(RowName);
+	};
+
+	TSharedPtr<FJsonObject> RowParams = MakeShared<FJsonObject>();
+	RowParams->SetStringField(TEXT("table_path"), Table->GetPathName());
+	RowParams->SetStringField(TEXT("row_name"), TEXT("Row_2"));
+
+	TSharedPtr<FJsonObject> QueryParams = MakeShared<FJsonObject>();
+	QueryParams->SetStringField(TEXT("table_path"), Table->GetPathName());
+	QueryParams->SetNumberField(TEXT("limit"), 5);
+
+	// --- Test 1: get_datatable_row revalidates against its content hash ---
+	{
+		const FString ETag = Handler.Execute(TEXT("get_datatable_row"), RowParams).Data->GetStringField(TEXT("etag"));
+		TestFalse(TEXT("Row read should carry an etag"), ETag.IsEmpty());
+
+		RowParams->SetStringField(TEXT("if_none_match"), ETag);
+		FUDBCommandResult Conditional = Handler.Execute(TEXT("get_datatable_row"), RowParams);
+		TestTrue(TEXT("Matching etag should return not_modified"), IsNotModified(Conditional));
+		TestFalse(TEXT("not_modified should not carry the row"), Conditional.Data->HasField(TEXT("row_data")));
+
+		ChangeRow(TEXT("Row_7"), 70);
+		TestTrue(TEXT("Editing another row should keep this row's etag"),
+			IsNotModified(Handler.Execute(TEXT("get_datatable_row"), RowParams)));
+
+		ChangeRow(TEXT("Row_2"), 20);
+		FUDBCommandResult Changed = Handler.Execute(TEXT("get_datatable_row"), RowParams);
+		TestFalse(TEXT("Editing the row should invalidate its etag"), IsNotModified(Changed));
+		TestNotEqual(TEXT("Changed row should get a new etag"), Changed.Data->GetStringField(TEXT("etag")), ETag);
+	}
+
+	// --- Test 2: query_datatable revalidates against the table generation ---
+	{
+		const FString ETag = Handler.Execute(TEXT("query_datatable"), QueryParams).Data->GetStringField(TEXT("etag"));
+		TestFalse(TEXT("Query should carry an etag"), ETag.IsEmpty());
+
+		QueryParams->SetStringField(TEXT("if_none_match"), ETag);
+		TestTrue(TEXT("Unchanged table should return not_modified"), IsNotModified(Handler.Execute(TEXT("query_datatable"), QueryParams)));
+
+		QueryParams->SetNumberField(TEXT("offset"), 5);
+		TestFalse(TEXT("Different params should not match"), IsNotModified(Handler.Execute(TEXT("query_datatable"), QueryParams)));
+		QueryParams->RemoveField(TEXT("offset"));
+
+		ChangeRow(TEXT("Row_9"), 90);
+		TestFalse(TEXT("Any change to the table should invalidate the query etag"),
+			IsNotModified(Handler.Execute(TEXT("query_datatable"), QueryParams)));
+	}
+
+	return true;
+}
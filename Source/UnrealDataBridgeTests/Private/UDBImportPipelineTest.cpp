@@ -0,0 +1,125 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBSerializer.h"
+#include "UDBSettings.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBImportPipelineTest,
+	"UDB.Commands.ImportPipeline",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBImportPipelineTest::RunTest(const FString& Parameters)
+{
+	// Enough rows to be split into parallel chunks
+	const int32 NumRows = FMath::Max(UUDBSettings::Get()->ParallelSerializeMinRows, 1) * 4;
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_ImportPipelineTest"), 0);
+	FUDBCommandHandler Handler;
+
+	auto MakeRow = [](const FString& RowName, TSharedPtr<FJsonObject> RowData)
+	{
+		TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+		Entry->SetStringField(TEXT("row_name"), RowName);
+		Entry->SetObjectField(TEXT("row_data"), RowData);
+		return MakeShared<FJsonValueObject>(Entry);
+	};
+
+	auto Import = [&](const TArray<TSharedPtr<FJsonValue>>& Rows, const TCHAR* Mode, bool bDryRun = false)
+	{
+		TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("table_path"), Table->GetPathName());
+		Params->SetArrayField(TEXT("rows"), Rows);
+		Params->SetStringField(TEXT("mode"), Mode);
+		Params->SetBoolField(TEXT("dry_run"), bDryRun);
+		return Handler.Execute(TEXT("import_datatable_json"), Params);
+	};
+
+	auto GetRow = [&](const TCHAR* RowName)
+	{
+		return Table->FindRow<FUDBTestRow>(RowName, TEXT("ImportPipelineTest"), false);
+	};
+
+	TestTrue(TEXT("Test rows deserialize concurrently"), FUDBSerializer::CanDeserializeConcurrently(FUDBTestRow::StaticStruct()));
+
+	// --- Test 1: a large create import lands every row and reports its stages ---
+	{
+		TArray<TSharedPtr<FJsonValue>> Rows;
+		for (int32 Index = 0; Index < NumRows; ++Index)
+		{
+			TSharedPtr<FJsonObject> RowData = MakeShared<FJsonObject>();
+			RowData->SetStringField(TEXT("DisplayName"), FString::Printf(TEXT("Imported %d"), Index));
+			RowData->SetNumberField(TEXT("Level"), Index % 100);
+			RowData->SetStringField(TEXT("Rarity"), Index % 2 == 0 ? TEXT("Epic") : TEXT("Common"));
+			Rows.Add(MakeRow(FString::Printf(TEXT("Row_%d"), Index), RowData));
+		}
+		Rows.Add(MakeShared<FJsonValueString>(TEXT("not a row")));
+
+		const double StartTime = FPlatformTime::Seconds();
+		FUDBCommandResult Result = Import(Rows, TEXT("create"));
+		AddInfo(FString::Printf(TEXT("Imported %d rows in %.2f ms"), NumRows, (FPlatformTime::Seconds() - StartTime) * 1000.0));
+
+		TestTrue(TEXT("Import should succeed"), Result.bSuccess);
+		TestEqual(TEXT("Every row created"), static_cast<int32>(Result.Data->GetNumberField(TEXT("created"))), NumRows);
+		TestEqual(TEXT("Table size"), Table->GetRowMap().Num(), NumRows);
+		TestEqual(TEXT("Bad entry reported"), Result.Data->GetArrayField(TEXT("errors")).Num(), 1);
+		TestTrue(TEXT("Stage timings"), Result.Data->GetObjectField(TEXT("stage_ms"))->HasField(TEXT("deserialize")));
+		TestTrue(TEXT("Chunk count"), Result.Data->GetNumberField(TEXT("deserialize_chunks")) >= 1);
+
+		const FUDBTestRow* Last = GetRow(*FString::Printf(TEXT("Row_%d"), NumRows - 1));
+		TestTrue(TEXT("Last row values"), Last != nullptr && Last->DisplayName == FString::Printf(TEXT("Imported %d"), NumRows - 1) && Last->Level == (NumRows - 1) % 100);
+		TestTrue(TEXT("Enum value"), GetRow(TEXT("Row_2")) != nullptr && GetRow(TEXT("Row_2"))->Rarity == EUDBTestRarity::Epic);
+	}
+
+	// --- Test 2: upserts merge into existing rows, repeated names apply in order ---
+	{
+		TSharedPtr<FJsonObject> LevelOnly = MakeShared<FJsonObject>();
+		LevelOnly->SetNumberField(TEXT("Level"), 500);
+		TSharedPtr<FJsonObject> BossOnly = MakeShared<FJsonObject>();
+		BossOnly->SetBoolField(TEXT("bIsBoss"), true);
+		TSharedPtr<FJsonObject> NewRow = MakeShared<FJsonObject>();
+		NewRow->SetNumberField(TEXT("Level"), 7);
+
+		TArray<TSharedPtr<FJsonValue>> Rows;
+		Rows.Add(MakeRow(TEXT("Row_1"), LevelOnly));
+		Rows.Add(MakeRow(TEXT("Row_New"), NewRow));
+		Rows.Add(MakeRow(TEXT("Row_1"), BossOnly));
+
+		FUDBCommandResult DryRun = Import(Rows, TEXT("upsert"), true);
+		TestEqual(TEXT("Dry run counts both Row_1 entries"), static_cast<int32>(DryRun.Data->GetNumberField(TEXT("updated"))), 2);
+		TestNull(TEXT("Dry run writes nothing"), GetRow(TEXT("Row_New")));
+
+		FUDBCommandResult Result = Import(Rows, TEXT("upsert"));
+		TestEqual(TEXT("Updated"), static_cast<int32>(Result.Data->GetNumberField(TEXT("updated"))), 2);
+		TestEqual(TEXT("Created"), static_cast<int32>(Result.Data->GetNumberField(TEXT("created"))), 1);
+
+		const FUDBTestRow* Row1 = GetRow(TEXT("Row_1"));
+		TestTrue(TEXT("Both entries applied"), Row1 != nullptr && Row1->Level == 500 && Row1->bIsBoss);
+		TestTrue(TEXT("Untouched fields kept"), Row1 != nullptr && Row1->DisplayName == TEXT("Imported 1"));
+		TestTrue(TEXT("New row"), GetRow(TEXT("Row_New")) != nullptr && GetRow(TEXT("Row_New"))->Level == 7);
+	}
+
+	// --- Test 3: create skips existing rows, replace starts over ---
+	{
+		TSharedPtr<FJsonObject> RowData = MakeShared<FJsonObject>();
+		RowData->SetNumberField(TEXT("Level"), 1);
+		TArray<TSharedPtr<FJsonValue>> Rows;
+		Rows.Add(MakeRow(TEXT("Row_0"), RowData));
+		Rows.Add(MakeRow(TEXT("Row_Extra"), RowData));
+
+		FUDBCommandResult Created = Import(Rows, TEXT("create"));
+		TestEqual(TEXT("Existing row skipped"), static_cast<int32>(Created.Data->GetNumberField(TEXT("skipped"))), 1);
+		TestEqual(TEXT("Existing row untouched"), GetRow(TEXT("Row_0"))->Level, 0);
+
+		FUDBCommandResult Replaced = Import(Rows, TEXT("replace"));
+		TestEqual(TEXT("Replace creates"), static_cast<int32>(Replaced.Data->GetNumberField(TEXT("created"))), 2);
+		TestEqual(TEXT("Only imported rows remain"), Table->GetRowMap().Num(), 2);
+		TestEqual(TEXT("Replaced row reset"), GetRow(TEXT("Row_0"))->DisplayName, FString());
+	}
+
+	return true;
+}
@@ -0,0 +1,110 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBMsgPack.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBMsgPackTest,
+	"UDB.Commands.MsgPack",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBMsgPackTest::RunTest(const FString& Parameters)
+{
+	// --- Test 1: DOM round-trip covers every size class and keeps doubles bit-exact ---
+	{
+		TSharedPtr<FJsonObject> Source = MakeShared<FJsonObject>();
+		Source->SetStringField(TEXT("short"), TEXT("Sword"));
+		Source->SetStringField(TEXT("long"), FString::ChrN(300, TEXT('x')));
+		Source->SetStringField(TEXT("unicode"), TEXT("Schwert \u00e9\u4e2d"));
+		Source->SetNumberField(TEXT("small"), 7);
+		Source->SetNumberField(TEXT("negative"), -40000);
+		Source->SetNumberField(TEXT("big"), 5000000000.0);
+		Source->SetNumberField(TEXT("fraction"), 0.1);
+		Source->SetBoolField(TEXT("flag"), true);
+		Source->SetField(TEXT("nothing"), MakeShared<FJsonValueNull>());
+
+		TArray<TSharedPtr<FJsonValue>> Many;
+		for (int32 Index = 0; Index < 20; ++Index)
+		{
+			Many.Add(MakeShared<FJsonValueNumber>(Index * 1.5));
+		}
+		Source->SetArrayField(TEXT("many"), Many);
+
+		const TArray<uint8> Bytes = FUDBMsgPackWriter::ToBytes(Source);
+
+		TSharedPtr<FJsonObject> Decoded;
+		FString Error;
+		TestTrue(TEXT("Encoded DOM should decode"), FUDBMsgPackReader::ReadObject(Bytes.GetData(), Bytes.Num(), Decoded, Error));
+
+		if (Decoded.IsValid())
+		{
+			TestEqual(TEXT("Short string"), Decoded->GetStringField(TEXT("short")), FString(TEXT("Sword")));
+			TestEqual(TEXT("str16 string length"), Decoded->GetStringField(TEXT("long")).Len(), 300);
+			TestEqual(TEXT("UTF-8 string"), Decoded->GetStringField(TEXT("unicode")), FString(TEXT("Schwert \u00e9\u4e2d")));
+			TestEqual(TEXT("fixint"), Decoded->GetNumberField(TEXT("small")), 7.0);
+			TestEqual(TEXT("int32"), Decoded->GetNumberField(TEXT("negative")), -40000.0);
+			TestEqual(TEXT("uint64"), Decoded->GetNumberField(TEXT("big")), 5000000000.0);
+			TestTrue(TEXT("float64 is bit-exact"), Decoded->GetNumberField(TEXT("fraction")) == 0.1);
+			TestTrue(TEXT("bool"), Decoded->GetBoolField(TEXT("flag")));
+			TestTrue(TEXT("nil"), Decoded->HasTypedField<EJson::Null>(TEXT("nothing")));
+			TestEqual(TEXT("array16 length"), Decoded->GetArrayField(TEXT("many")).Num(), 20);
+		}
+	}
+
+	// --- Test 2: Streamed envelope decodes to the same shape as the JSON envelope ---
+	{
+		TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+		Data->SetStringField(TEXT("message"), TEXT("pong"));
+		FUDBCommandResult Result = FUDBCommandHandler::Success(Data);
+		Result.Warnings.Add(TEXT("first"));
+		Result.Warnings.Add(TEXT("second"));
+
+		TArray<uint8> Bytes;
+		FUDBCommandHandler::ResultToMsgPack(Result, 1.25, Bytes);
+
+		TSharedPtr<FJsonObject> Decoded;
+		FString Error;
+		TestTrue(TEXT("Envelope should decode"), FUDBMsgPackReader::ReadObject(Bytes.GetData(), Bytes.Num(), Decoded, Error));
+
+		TSharedPtr<FJsonObject> FromJson;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FUDBCommandHandler::ResultToJson(Result, 1.25));
+		FJsonSerializer::Deserialize(Reader, FromJson);
+
+		if (Decoded.IsValid() && FromJson.IsValid())
+		{
+			TestEqual(TEXT("Same top-level keys"), Decoded->Values.Num(), FromJson->Values.Num());
+			TestTrue(TEXT("success"), Decoded->GetBoolField(TEXT("success")));
+			TestEqual(TEXT("warnings count patched"), Decoded->GetArrayField(TEXT("warnings")).Num(), 2);
+			TestEqual(TEXT("timing_ms"), Decoded->GetNumberField(TEXT("timing_ms")), 1.25);
+			TestEqual(TEXT("data.message"),
+				Decoded->GetObjectField(TEXT("data"))->GetStringField(TEXT("message")), FString(TEXT("pong")));
+		}
+	}
+
+	// --- Test 3: Malformed input is rejected, not crashed on ---
+	{
+		TSharedPtr<FJsonObject> Decoded;
+		FString Error;
+
+		const uint8 Truncated[] = { 0x81, 0xa3, 'k', 'e' };
+		TestFalse(TEXT("Truncated map should fail"), FUDBMsgPackReader::ReadObject(Truncated, UE_ARRAY_COUNT(Truncated), Decoded, Error));
+
+		const uint8 NotAMap[] = { 0x92, 0x01, 0x02 };
+		TestFalse(TEXT("Non-map root should fail"), FUDBMsgPackReader::ReadObject(NotAMap, UE_ARRAY_COUNT(NotAMap), Decoded, Error));
+
+		const uint8 IntKey[] = { 0x81, 0x01, 0x02 };
+		TestFalse(TEXT("Non-string key should fail"), FUDBMsgPackReader::ReadObject(IntKey, UE_ARRAY_COUNT(IntKey), Decoded, Error));
+
+		const uint8 HugeArray[] = { 0x81, 0xa1, 'a', 0xdd, 0xff, 0xff, 0xff, 0xff };
+		TestFalse(TEXT("Oversized length should fail"), FUDBMsgPackReader::ReadObject(HugeArray, UE_ARRAY_COUNT(HugeArray), Decoded, Error));
+		TestFalse(TEXT("Failure should carry a message"), Error.IsEmpty());
+	}
+
+	return true;
+}
@@ -0,0 +1,122 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBSerializer.h"
+#include "UDBSettings.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+
+// ============================================================================
+// Test: query_datatable above the parallel threshold returns rows in table order
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBParallelQueryTest,
+	"UDB.Commands.ParallelQuery",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBParallelQueryTest::RunTest(const FString& Parameters)
+{
+	const int32 NumRows = FMath::Max(UUDBSettings::Get()->ParallelSerializeMinRows, 1) * 2;
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_ParallelQueryTest"), NumRows);
+
+	FUDBCommandHandler Handler;
+	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetStringField(TEXT("table_path"), Table->GetPathName());
+	Params->SetNumberField(TEXT("limit"), NumRows);
+
+	FUDBCommandResult Result = Handler.Execute(TEXT("query_datatable"), Params);
+	TestTrue(TEXT("query_datatable should succeed"), Result.bSuccess);
+
+	const TArray<TSharedPtr<FJsonValue>>* Rows = nullptr;
+	if (!Result.Data.IsValid() || !Result.Data->TryGetArrayField(TEXT("rows"), Rows) || Rows == nullptr)
+	{
+		AddError(TEXT("Response should contain rows"));
+		return true;
+	}
+
+	TestEqual(TEXT("All rows should be returned"), Rows->Num(), NumRows);
+	for (int32 Index = 0; Index < Rows->Num(); ++Index)
+	{
+		const TSharedPtr<FJsonObject> Entry = (*Rows)[Index]->AsObject();
+		if (Entry->GetStringField(TEXT("row_name")) != FString::Printf(TEXT("Row_%d"), Index))
+		{
+			AddError(FString::Printf(TEXT("Row %d out of order: %s"), Index, *Entry->GetStringField(TEXT("row_name"))));
+			break;
+		}
+	}
+
+	// The parallel stage pre-encodes rows; the spliced response must match a plain DOM encode
+	FUDBJsonBytes Spliced;
+	FUDBCommandHandler::ResultToUtf8(Result, 0.0, Spliced);
+	FUDBCommandResult Plain = Result;
+	Plain.PreserializedObjects.Reset();
+	FUDBJsonBytes Unspliced;
+	FUDBCommandHandler::ResultToUtf8(Plain, 0.0, Unspliced);
+	TestTrue(TEXT("Spliced response should be byte-identical"), Spliced == Unspliced);
+
+	return true;
+}
+
+// ============================================================================
+// Benchmark: StructsToJson scaling across chunk counts
+// Chunk count stands in for core count; run with -corelimit=N to pin the worker pool.
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBParallelSerializeBenchmark,
+	"UDB.Perf.ParallelSerialize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FUDBParallelSerializeBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 NumRows = 20000;
+	const int32 Iterations = 3;
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_ParallelSerializeBenchmark"), NumRows);
+
+	TArray<const void*> RowDatas;
+	for (const TPair<FName, uint8*>& Pair : Table->GetRowMap())
+	{
+		RowDatas.Add(Pair.Value);
+	}
+
+	const FUDBFieldProjection NoProjection;
+	auto Run = [&](int32 NumChunks, TArray<FUDBJsonFragment>& OutUtf8) -> double
+	{
+		double BestMs = TNumericLimits<double>::Max();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			TArray<TSharedPtr<FJsonObject>> Json;
+			const double Start = FPlatformTime::Seconds();
+			FUDBSerializer::StructsToJson(Table->GetRowStruct(), RowDatas, NoProjection, FUDBSerializeOptions(), NumChunks, Json, &OutUtf8);
+			BestMs = FMath::Min(BestMs, (FPlatformTime::Seconds() - Start) * 1000.0);
+		}
+		return BestMs;
+	};
+
+	TArray<FUDBJsonFragment> Baseline;
+	const double SerialMs = Run(1, Baseline);
+	AddInfo(FString::Printf(TEXT("%d rows, 1 chunk: %.2f ms"), NumRows, SerialMs));
+
+	for (const int32 NumChunks : { 4, 8, 16 })
+	{
+		TArray<FUDBJsonFragment> Output;
+		const double ParallelMs = Run(NumChunks, Output);
+		AddInfo(FString::Printf(TEXT("%d rows, %d chunks: %.2f ms (%.2fx)"),
+			NumRows, NumChunks, ParallelMs, ParallelMs > 0.0 ? SerialMs / ParallelMs : 0.0));
+
+		bool bIdentical = Output.Num() == Baseline.Num();
+		for (int32 Index = 0; bIdentical && Index < Output.Num(); ++Index)
+		{
+			bIdentical = Output[Index].Num == Baseline[Index].Num
+				&& FMemory::Memcmp(Output[Index].GetData(), Baseline[Index].GetData(), Output[Index].Num) == 0;
+		}
+		TestTrue(FString::Printf(TEXT("%d-chunk output should match serial output"), NumChunks), bIdentical);
+		TestTrue(TEXT("Rows of one chunk should share a buffer"), Output.Num() < 2 || Output[0].Storage == Output[1].Storage);
+	}
+
+	return true;
+}
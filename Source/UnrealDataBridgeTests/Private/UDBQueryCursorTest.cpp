@@ -0,0 +1,119 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBQueryCursors.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBQueryCursorTest,
+	"UDB.Commands.QueryCursor",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBQueryCursorTest::RunTest(const FString& Parameters)
+{
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_QueryCursorTest"), 300);
+	FUDBCommandHandler Handler;
+
+	auto Continue = [&](const FString& Cursor, int32 Limit)
+	{
+		TSharedPtr<FJsonObject> Params = UDBTest::MakeQueryParams(Table, Limit);
+		Params->SetStringField(TEXT("cursor"), Cursor);
+		return Handler.Execute(TEXT("query_datatable"), Params);
+	};
+
+	// --- Test 1: cursor pages of a filtered, ordered query add up to the one-shot result ---
+	{
+		TArray<TSharedPtr<FJsonValue>> OrderBy;
+		OrderBy.Add(MakeShared<FJsonValueString>(TEXT("Level desc")));
+
+		TSharedPtr<FJsonObject> AllParams = UDBTest::MakeQueryParams(Table, 1000);
+		AllParams->SetStringField(TEXT("where"), TEXT("Level >= 50"));
+		AllParams->SetArrayField(TEXT("order_by"), OrderBy);
+		const TArray<FString> Expected = UDBTest::GetRowNames(Handler.Execute(TEXT("query_datatable"), AllParams));
+		TestEqual(TEXT("Half the rows match"), Expected.Num(), 150);
+
+		TSharedPtr<FJsonObject> FirstParams = UDBTest::MakeQueryParams(Table, 40);
+		FirstParams->SetStringField(TEXT("where"), TEXT("Level >= 50"));
+		FirstParams->SetArrayField(TEXT("order_by"), OrderBy);
+		FirstParams->SetBoolField(TEXT("use_cursor"), true);
+		FUDBCommandResult Result = Handler.Execute(TEXT("query_datatable"), FirstParams);
+		TestTrue(TEXT("First page should succeed"), Result.bSuccess);
+
+		TArray<FString> Paged = UDBTest::GetRowNames(Result);
+		int32 Pages = 1;
+		FString Cursor;
+		while (Result.Data->TryGetStringField(TEXT("next_cursor"), Cursor) && Pages < 10)
+		{
+			Result = Continue(Cursor, 40);
+			TestTrue(TEXT("Cursor page should succeed"), Result.bSuccess);
+			TestFalse(TEXT("Unchanged table"), Result.Data->GetBoolField(TEXT("consistency_break")));
+			TestEqual(TEXT("Snapshot total"), static_cast<int32>(Result.Data->GetNumberField(TEXT("total_count"))), 150);
+			Paged.Append(UDBTest::GetRowNames(Result));
+			++Pages;
+		}
+		TestEqual(TEXT("Four pages"), Pages, 4);
+		TestTrue(TEXT("Same rows in the same order"), Paged == Expected);
+	}
+
+	// --- Test 2: pages after a write come from the snapshot and flag the break ---
+	{
+		TSharedPtr<FJsonObject> FirstParams = UDBTest::MakeQueryParams(Table, 50);
+		FirstParams->SetStringField(TEXT("row_name_pattern"), TEXT("Row_1*"));
+		FirstParams->SetBoolField(TEXT("use_cursor"), true);
+		FUDBCommandResult First = Handler.Execute(TEXT("query_datatable"), FirstParams);
+		TestEqual(TEXT("Row_1, Row_10..19, Row_100..199"), static_cast<int32>(First.Data->GetNumberField(TEXT("total_count"))), 111);
+		const FString Cursor = First.Data->GetStringField(TEXT("next_cursor"));
+
+		TSharedPtr<FJsonObject> Add = UDBTest::MakeQueryParams(Table);
+		Add->SetStringField(TEXT("row_name"), TEXT("Row_1New"));
+		Add->SetObjectField(TEXT("row_data"), MakeShared<FJsonObject>());
+		TestTrue(TEXT("Add should succeed"), Handler.Execute(TEXT("add_datatable_row"), Add).bSuccess);
+
+		TSharedPtr<FJsonObject> Delete = UDBTest::MakeQueryParams(Table);
+		Delete->SetStringField(TEXT("row_name"), TEXT("Row_150"));
+		TestTrue(TEXT("Delete should succeed"), Handler.Execute(TEXT("delete_datatable_row"), Delete).bSuccess);
+
+		FUDBCommandResult Second = Continue(Cursor, 50);
+		TestTrue(TEXT("Cursor page should succeed"), Second.bSuccess);
+		TestTrue(TEXT("Break flagged"), Second.Data->GetBoolField(TEXT("consistency_break")));
+		TestEqual(TEXT("Snapshot total"), static_cast<int32>(Second.Data->GetNumberField(TEXT("total_count"))), 111);
+		TestEqual(TEXT("Offset"), static_cast<int32>(Second.Data->GetNumberField(TEXT("offset"))), 50);
+
+		const TArray<FString> RowNames = UDBTest::GetRowNames(Second);
+		TestEqual(TEXT("Deleted row skipped"), RowNames.Num(), 49);
+		TestFalse(TEXT("No Row_150"), RowNames.Contains(TEXT("Row_150")));
+
+		FUDBCommandResult Last = Continue(Second.Data->GetStringField(TEXT("next_cursor")), 50);
+		TestFalse(TEXT("Last page has no next cursor"), Last.Data->HasField(TEXT("next_cursor")));
+		TestFalse(TEXT("Added row is not in the snapshot"), UDBTest::GetRowNames(Last).Contains(TEXT("Row_1New")));
+	}
+
+	// --- Test 3: bad and dropped cursors ---
+	{
+		FUDBCommandResult Garbage = Continue(TEXT("not-a-cursor"), 10);
+		TestFalse(TEXT("Garbage cursor fails"), Garbage.bSuccess);
+		TestEqual(TEXT("Invalid value"), Garbage.ErrorCode, UDBErrorCodes::InvalidValue);
+
+		TSharedPtr<FJsonObject> FirstParams = UDBTest::MakeQueryParams(Table, 10);
+		FirstParams->SetBoolField(TEXT("use_cursor"), true);
+		const FString Cursor = Handler.Execute(TEXT("query_datatable"), FirstParams).Data->GetStringField(TEXT("next_cursor"));
+
+		UDataTable* Other = UDBTest::CreateTestTable(TEXT("DT_QueryCursorOther"), 30);
+		TSharedPtr<FJsonObject> OtherParams = UDBTest::MakeQueryParams(Table, 10);
+		OtherParams->SetStringField(TEXT("table_path"), Other->GetPathName());
+		OtherParams->SetStringField(TEXT("cursor"), Cursor);
+		TestFalse(TEXT("Cursor of another table fails"), Handler.Execute(TEXT("query_datatable"), OtherParams).bSuccess);
+
+		FUDBQueryCursors::Reset();
+		FUDBCommandResult Expired = Continue(Cursor, 10);
+		TestFalse(TEXT("Dropped snapshot fails"), Expired.bSuccess);
+		TestEqual(TEXT("Cursor expired"), Expired.ErrorCode, UDBErrorCodes::CursorExpired);
+	}
+
+	FUDBQueryCursors::Reset();
+	return true;
+}
@@ -0,0 +1,105 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBRowCache.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBRowCacheTest,
+	"UDB.Commands.RowCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBRowCacheTest::RunTest(const FString& Parameters)
+{
+	if (!FUDBRowCache::IsEnabled())
+	{
+		AddInfo(TEXT("Row cache disabled in settings; skipping"));
+		return true;
+	}
+
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_RowCacheTest"), 10);
+	FUDBCommandHandler Handler;
+	FUDBRowCache::Reset();
+
+	TSharedPtr<FJsonObject> RowParams = MakeShared<FJsonObject>();
+	RowParams->SetStringField(TEXT("table_path"), Table->GetPathName());
+	RowParams->SetStringField(TEXT("row_name"), TEXT("Row_3"));
+
+	auto GetRowData = [&](const TSharedPtr<FJsonObject>& Params) -> TSharedPtr<FJsonObject>
+	{
+		FUDBCommandResult Result = Handler.Execute(TEXT("get_datatable_row"), Params);
+		return Result.bSuccess ? Result.Data->GetObjectField(TEXT("row_data")) : nullptr;
+	};
+
+	// --- Test 1: Repeat reads share the cached row and splice its bytes ---
+	{
+		FUDBCommandResult First = Handler.Execute(TEXT("get_datatable_row"), RowParams);
+		TestTrue(TEXT("get_datatable_row should succeed"), First.bSuccess);
+		TestEqual(TEXT("row_data should be marked pre-serialized"), First.PreserializedObjects.Num(), 1);
+		TestEqual(TEXT("One cached row"), FUDBRowCache::Num(), 1);
+		for (const TPair<const FJsonObject*, FUDBJsonFragment>& Fragment : First.PreserializedObjects)
+		{
+			TestTrue(TEXT("Budget should charge the row DOM on top of its bytes"),
+				FUDBRowCache::GetCachedBytes() > static_cast<int64>(Fragment.Value.Num) * 2);
+		}
+
+		const TSharedPtr<FJsonObject> Second = GetRowData(RowParams);
+		TestTrue(TEXT("Repeat read should return the cached row object"),
+			Second.IsValid() && Second == First.Data->GetObjectField(TEXT("row_data")));
+	}
+
+	// --- Test 2: Projection and options are part of the key ---
+	{
+		TSharedPtr<FJsonObject> QueryParams = MakeShared<FJsonObject>();
+		QueryParams->SetStringField(TEXT("table_path"), Table->GetPathName());
+		QueryParams->SetArrayField(TEXT("fields"), { MakeShared<FJsonValueString>(TEXT("Level")) });
+		Handler.Execute(TEXT("query_datatable"), QueryParams);
+		TestEqual(TEXT("Projected rows are cached separately"), FUDBRowCache::Num(), 11);
+
+		QueryParams->SetNumberField(TEXT("float_precision"), 2);
+		Handler.Execute(TEXT("query_datatable"), QueryParams);
+		TestEqual(TEXT("float_precision is part of the key"), FUDBRowCache::Num(), 21);
+	}
+
+	// --- Test 3: Writes through the plugin invalidate the table ---
+	{
+		const TSharedPtr<FJsonObject> Before = GetRowData(RowParams);
+
+		TSharedPtr<FJsonObject> UpdateParams = MakeShared<FJsonObject>();
+		UpdateParams->SetStringField(TEXT("table_path"), Table->GetPathName());
+		UpdateParams->SetStringField(TEXT("row_name"), TEXT("Row_3"));
+		TSharedPtr<FJsonObject> UpdateData = MakeShared<FJsonObject>();
+		UpdateData->SetNumberField(TEXT("Level"), 99);
+		UpdateParams->SetObjectField(TEXT("row_data"), UpdateData);
+		TestTrue(TEXT("update_datatable_row should succeed"), Handler.Execute(TEXT("update_datatable_row"), UpdateParams).bSuccess);
+
+		const TSharedPtr<FJsonObject> After = GetRowData(RowParams);
+		TestTrue(TEXT("Read after update should not reuse the old row"), After.IsValid() && After != Before);
+		TestEqual(TEXT("Read after update should see the new value"), After.IsValid() ? After->GetIntegerField(TEXT("Level")) : 0, 99);
+	}
+
+	// --- Test 4: OnDataTableChanged from outside the plugin invalidates the table ---
+	{
+		const TSharedPtr<FJsonObject> Before = GetRowData(RowParams);
+		FUDBTestRow* Row = Table->FindRow<FUDBTestRow>(TEXT("Row_3"), TEXT("RowCacheTest"));
+		Row->Level = 7;
+		Table->HandleDataTableChanged(TEXT("Row_3"));
+
+		const TSharedPtr<FJsonObject> After = GetRowData(RowParams);
+		TestTrue(TEXT("Read after change event should not reuse the old row"), After.IsValid() && After != Before);
+		TestEqual(TEXT("Read after change event should see the new value"), After.IsValid() ? After->GetIntegerField(TEXT("Level")) : 0, 7);
+	}
+
+	// --- Test 5: Reset empties the cache ---
+	{
+		FUDBRowCache::Reset();
+		TestEqual(TEXT("Reset should empty the cache"), FUDBRowCache::Num(), 0);
+		TestEqual(TEXT("Reset should release the bytes"), FUDBRowCache::GetCachedBytes(), static_cast<int64>(0));
+	}
+
+	return true;
+}
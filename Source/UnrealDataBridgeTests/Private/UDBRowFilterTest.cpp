@@ -0,0 +1,105 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBRowFilter.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBRowFilterTest,
+	"UDB.Commands.RowFilter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBRowFilterTest::RunTest(const FString& Parameters)
+{
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_RowFilterTest"), 100);
+
+	auto CountMatches = [&](const TCHAR* Expression) -> int32
+	{
+		FString Error;
+		TSharedPtr<const FUDBRowFilter> Filter = FUDBRowFilter::Compile(FUDBTestRow::StaticStruct(), Expression, Error);
+		if (!Filter.IsValid())
+		{
+			AddError(FString::Printf(TEXT("'%s' failed to compile: %s"), Expression, *Error));
+			return INDEX_NONE;
+		}
+
+		int32 Count = 0;
+		for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+		{
+			Count += Filter->Matches(Row.Value) ? 1 : 0;
+		}
+		return Count;
+	};
+
+	// --- Test 1: comparisons and boolean logic ---
+	TestEqual(TEXT("Level >= 90"), CountMatches(TEXT("Level >= 90")), 10);
+	TestEqual(TEXT("Bare bool and enum"), CountMatches(TEXT("bIsBoss and Rarity == Epic")), 5);
+	TestEqual(TEXT("not"), CountMatches(TEXT("not bIsBoss and Level < 10")), 9);
+	TestEqual(TEXT("Symbolic operators and nested field"), CountMatches(TEXT("Stats.Damage < 12 || Level == 99")), 5);
+	TestEqual(TEXT("Parentheses"), CountMatches(TEXT("(Level < 5 or Level > 94) and !(Rarity == Common)")), 7);
+
+	// --- Test 2: in, contains, matches ---
+	TestEqual(TEXT("in over enum names"), CountMatches(TEXT("Rarity in (Epic, Legendary) and Level < 8")), 4);
+	TestEqual(TEXT("contains is a case-insensitive substring"), CountMatches(TEXT("DisplayName contains \"row 4\"")), 11);
+	TestEqual(TEXT("matches is a wildcard"), CountMatches(TEXT("DisplayName matches 'test row 9?'")), 10);
+
+	// --- Test 3: arrays hold if any element does ---
+	TestEqual(TEXT("Array of structs"), CountMatches(TEXT("Abilities.Cooldown == 2")), 33);
+	TestEqual(TEXT("Explicit [*]"), CountMatches(TEXT("Abilities[*].Cooldown == 2")), 33);
+	TestEqual(TEXT("Array of floats"), CountMatches(TEXT("Curve > 2.5")), 50);
+
+	// --- Test 4: compile errors ---
+	{
+		const TCHAR* Invalid[] = {
+			TEXT("Level >"),
+			TEXT("NoSuchField == 1"),
+			TEXT("Rarity == Mythic"),
+			TEXT("bIsBoss > 1"),
+			TEXT("Level == \"ten\""),
+			TEXT("(Level > 1"),
+			TEXT("Level > 1 Level"),
+			TEXT("SpawnOffset == 0"),
+			TEXT("Tags matches UDB.Test.NotARegisteredTag"),
+			TEXT("Level[*] == 1"),
+			TEXT("Stats[*].Damage > 1"),
+		};
+		for (const TCHAR* Expression : Invalid)
+		{
+			FString Error;
+			TestFalse(FString::Printf(TEXT("'%s' should not compile"), Expression),
+				FUDBRowFilter::Compile(FUDBTestRow::StaticStruct(), Expression, Error).IsValid());
+			TestFalse(FString::Printf(TEXT("'%s' should explain why"), Expression), Error.IsEmpty());
+		}
+	}
+
+	// --- Test 5: query_datatable filters before paging ---
+	{
+		FUDBCommandHandler Handler;
+		TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("table_path"), Table->GetPathName());
+		Params->SetStringField(TEXT("where"), TEXT("Level >= 90"));
+		Params->SetNumberField(TEXT("limit"), 5);
+
+		FUDBCommandResult Result = Handler.Execute(TEXT("query_datatable"), Params);
+		TestTrue(TEXT("Filtered query should succeed"), Result.bSuccess);
+		TestEqual(TEXT("total_count counts matching rows"), static_cast<int32>(Result.Data->GetNumberField(TEXT("total_count"))), 10);
+		TestEqual(TEXT("Page is limited"), Result.Data->GetArrayField(TEXT("rows")).Num(), 5);
+
+		TArray<TSharedPtr<FJsonValue>> RowNames;
+		RowNames.Add(MakeShared<FJsonValueString>(TEXT("Row_1")));
+		RowNames.Add(MakeShared<FJsonValueString>(TEXT("Row_95")));
+		Params->SetArrayField(TEXT("row_names"), RowNames);
+		Result = Handler.Execute(TEXT("query_datatable"), Params);
+		TestEqual(TEXT("row_names are filtered too"), Result.Data->GetArrayField(TEXT("rows")).Num(), 1);
+		TestFalse(TEXT("Filtered-out rows are not missing"), Result.Data->HasField(TEXT("missing_rows")));
+
+		Params->SetStringField(TEXT("where"), TEXT("Level >>"));
+		TestFalse(TEXT("Invalid where should fail the query"), Handler.Execute(TEXT("query_datatable"), Params).bSuccess);
+	}
+
+	return true;
+}
@@ -0,0 +1,149 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBRowNameIndex.h"
+#include "UDBSettings.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBRowNameIndexTest,
+	"UDB.Commands.RowNameIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBRowNameIndexTest::RunTest(const FString& Parameters)
+{
+	// --- Test 1: compiled patterns agree with MatchesWildcard ---
+	{
+		// Names may hold the wildcard characters themselves; in a pattern they are always wildcards
+		const TCHAR* Names[] = { TEXT("Row_1"), TEXT("Row_12"), TEXT("row_120"), TEXT("Boss_Row_1"), TEXT("R"), TEXT("Row_"),
+			TEXT("a*bc"), TEXT("a*"), TEXT("a?c"), TEXT("abc"), TEXT("*?") };
+		const TCHAR* Patterns[] = { TEXT(""), TEXT("*"), TEXT("Row_1*"), TEXT("ROW_1?"), TEXT("*Row_1"), TEXT("R*_1*0"), TEXT("?ow_*"), TEXT("Row_12"),
+			TEXT("a*"), TEXT("a*c"), TEXT("a?c"), TEXT("a?bc"), TEXT("*?"), TEXT("**") };
+		for (const TCHAR* Pattern : Patterns)
+		{
+			const FUDBRowNameIndex::FPattern Compiled(Pattern);
+			for (const TCHAR* Name : Names)
+			{
+				const bool bExpected = FCString::Strlen(Pattern) == 0 || FString(Name).MatchesWildcard(Pattern);
+				TestEqual(FString::Printf(TEXT("'%s' against '%s'"), Name, Pattern), Compiled.Matches(FName(Name)), bExpected);
+			}
+		}
+	}
+
+	const int32 PreviousMinRows = UUDBSettings::Get()->RowNameIndexMinRows;
+	GetMutableDefault<UUDBSettings>()->RowNameIndexMinRows = 100;
+	FUDBRowNameIndex::Reset();
+
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_RowNameIndexTest"), 300);
+	FUDBCommandHandler Handler;
+
+	// Row names of one page and total_count; a where clause that keeps every row forces the row scan
+	auto Query = [&](const TCHAR* Pattern, int32 Offset, int32 Limit, bool bScan, int32& OutTotal)
+	{
+		TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("table_path"), Table->GetPathName());
+		Params->SetStringField(TEXT("row_name_pattern"), Pattern);
+		Params->SetNumberField(TEXT("offset"), Offset);
+		Params->SetNumberField(TEXT("limit"), Limit);
+		if (bScan)
+		{
+			Params->SetStringField(TEXT("where"), TEXT("Level >= 0"));
+		}
+		FUDBCommandResult Result = Handler.Execute(TEXT("query_datatable"), Params);
+		TestTrue(FString::Printf(TEXT("'%s' should succeed"), Pattern), Result.bSuccess);
+
+		TArray<FString> RowNames;
+		for (const TSharedPtr<FJsonValue>& Row : Result.Data->GetArrayField(TEXT("rows")))
+		{
+			RowNames.Add(Row->AsObject()->GetStringField(TEXT("row_name")));
+		}
+		OutTotal = static_cast<int32>(Result.Data->GetNumberField(TEXT("total_count")));
+		return RowNames;
+	};
+
+	// --- Test 2: name-only pages equal the scanned ones ---
+	{
+		for (const TCHAR* Pattern : { TEXT("Row_1*"), TEXT("row_2?"), TEXT("*9"), TEXT("Row_*5*"), TEXT("Row_299"), TEXT("Nope*"), TEXT("") })
+		{
+			int32 IndexedTotal = 0;
+			int32 ScannedTotal = 0;
+			for (const int32 Offset : { 0, 20, 100 })
+			{
+				const TArray<FString> Indexed = Query(Pattern, Offset, 25, false, IndexedTotal);
+				const TArray<FString> Scanned = Query(Pattern, Offset, 25, true, ScannedTotal);
+				TestTrue(FString::Printf(TEXT("'%s' page at %d equals the scan"), Pattern, Offset), Indexed == Scanned);
+			}
+			TestEqual(FString::Printf(TEXT("'%s' total equals the scan"), Pattern), IndexedTotal, ScannedTotal);
+		}
+
+		int32 Total = 0;
+		const TArray<FString> LastPage = Query(TEXT("Row_1*"), 100, 25, false, Total);
+		TestEqual(TEXT("Row_1, Row_10..19, Row_100..199"), Total, 111);
+		TestEqual(TEXT("Short last page"), LastPage.Num(), 11);
+		TestEqual(TEXT("Table order"), Query(TEXT("Row_1*"), 0, 2, false, Total)[1], FString(TEXT("Row_10")));
+	}
+
+	// --- Test 3: added and deleted rows show up ---
+	{
+		TSharedPtr<FJsonObject> Add = MakeShared<FJsonObject>();
+		Add->SetStringField(TEXT("table_path"), Table->GetPathName());
+		Add->SetStringField(TEXT("row_name"), TEXT("Row_1New"));
+		Add->SetObjectField(TEXT("row_data"), MakeShared<FJsonObject>());
+		TestTrue(TEXT("Add should succeed"), Handler.Execute(TEXT("add_datatable_row"), Add).bSuccess);
+
+		TSharedPtr<FJsonObject> Delete = MakeShared<FJsonObject>();
+		Delete->SetStringField(TEXT("table_path"), Table->GetPathName());
+		Delete->SetStringField(TEXT("row_name"), TEXT("Row_150"));
+		TestTrue(TEXT("Delete should succeed"), Handler.Execute(TEXT("delete_datatable_row"), Delete).bSuccess);
+
+		int32 Total = 0;
+		const TArray<FString> LastPage = Query(TEXT("Row_1*"), 100, 25, false, Total);
+		TestEqual(TEXT("One in, one out"), Total, 111);
+		TestEqual(TEXT("New rows come last"), LastPage.Last(), FString(TEXT("Row_1New")));
+	}
+
+	// --- Test 4: only patterned queries on large tables are indexed, and only the recent tables stay ---
+	{
+		auto Touch = [&](const UDataTable* Target, const TCHAR* Pattern)
+		{
+			TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+			Params->SetStringField(TEXT("table_path"), Target->GetPathName());
+			Params->SetStringField(TEXT("row_name_pattern"), Pattern);
+			Params->SetNumberField(TEXT("limit"), 10);
+			TestTrue(FString::Printf(TEXT("'%s' on %s should succeed"), Pattern, *Target->GetName()), Handler.Execute(TEXT("query_datatable"), Params).bSuccess);
+		};
+
+		FUDBRowNameIndex::Reset();
+		Touch(Table, TEXT(""));
+		Touch(Table, TEXT("*"));
+		TestFalse(TEXT("No pattern, no index"), FUDBRowNameIndex::Contains(Table));
+		Touch(Table, TEXT("Row_1*"));
+		TestTrue(TEXT("Pattern on a large table is indexed"), FUDBRowNameIndex::Contains(Table));
+
+		UDataTable* Small = UDBTest::CreateTestTable(TEXT("DT_RowNameIndexSmall"), 50);
+		Touch(Small, TEXT("Row_1*"));
+		TestFalse(TEXT("Small table is scanned"), FUDBRowNameIndex::Contains(Small));
+
+		UDataTable* Newest = nullptr;
+		for (int32 Index = 0; Index < FUDBRowNameIndex::MaxTables; ++Index)
+		{
+			Newest = UDBTest::CreateTestTable(*FString::Printf(TEXT("DT_RowNameIndexLru%d"), Index), 100);
+			Touch(Newest, TEXT("Row_1*"));
+		}
+		TestFalse(TEXT("Least recently used table dropped"), FUDBRowNameIndex::Contains(Table));
+		TestTrue(TEXT("Newest table kept"), FUDBRowNameIndex::Contains(Newest));
+
+		int32 Total = 0;
+		Query(TEXT("Row_1*"), 0, 25, false, Total);
+		TestEqual(TEXT("Dropped table is indexed again"), Total, 111);
+		TestTrue(TEXT("Back in the index"), FUDBRowNameIndex::Contains(Table));
+	}
+
+	GetMutableDefault<UUDBSettings>()->RowNameIndexMinRows = PreviousMinRows;
+	FUDBRowNameIndex::Reset();
+	return true;
+}
@@ -0,0 +1,76 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBRowOrderTest,
+	"UDB.Commands.RowOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBRowOrderTest::RunTest(const FString& Parameters)
+{
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_RowOrderTest"), 100);
+	FUDBCommandHandler Handler;
+
+	// Row names of an ordered query page, joined with commas ("" on failure)
+	auto QueryNames = [&](TArray<FString> OrderBy, int32 Offset, int32 Limit, const TCHAR* Where = TEXT("")) -> FString
+	{
+		TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("table_path"), Table->GetPathName());
+		Params->SetNumberField(TEXT("offset"), Offset);
+		Params->SetNumberField(TEXT("limit"), Limit);
+		Params->SetStringField(TEXT("where"), Where);
+
+		TArray<TSharedPtr<FJsonValue>> OrderArray;
+		for (const FString& Key : OrderBy)
+		{
+			OrderArray.Add(MakeShared<FJsonValueString>(Key));
+		}
+		Params->SetArrayField(TEXT("order_by"), OrderArray);
+
+		FUDBCommandResult Result = Handler.Execute(TEXT("query_datatable"), Params);
+		if (!Result.bSuccess)
+		{
+			return FString();
+		}
+
+		TArray<FString> Names;
+		for (const TSharedPtr<FJsonValue>& Row : Result.Data->GetArrayField(TEXT("rows")))
+		{
+			Names.Add(Row->AsObject()->GetStringField(TEXT("row_name")));
+		}
+		return FString::Join(Names, TEXT(","));
+	};
+
+	// --- Test 1: multi-key order, ties broken by the second key ---
+	TestEqual(TEXT("Weight desc, Level"), QueryNames({ TEXT("Weight desc"), TEXT("Level") }, 0, 5),
+		FString(TEXT("Row_36,Row_73,Row_35,Row_72,Row_34")));
+	TestEqual(TEXT("Offset into the ordered rows"), QueryNames({ TEXT("Weight desc"), TEXT("Level asc") }, 3, 2),
+		FString(TEXT("Row_72,Row_34")));
+
+	// --- Test 2: the bounded heap agrees with a full sort ---
+	{
+		const FString TopK = QueryNames({ TEXT("Stats.Damage"), TEXT("Level desc") }, 0, 10);
+		const FString Full = QueryNames({ TEXT("Stats.Damage"), TEXT("Level desc") }, 0, 1000);
+		TestTrue(TEXT("Top 10 is the head of the full order"), Full.StartsWith(TopK + TEXT(",")));
+	}
+
+	// --- Test 3: strings compare case-insensitively and lexically ---
+	TestEqual(TEXT("DisplayName desc"), QueryNames({ TEXT("DisplayName desc") }, 0, 1), FString(TEXT("Row_99")));
+
+	// --- Test 4: order applies after where; total_count is unchanged ---
+	TestEqual(TEXT("Filtered and ordered"), QueryNames({ TEXT("Level desc") }, 0, 3, TEXT("bIsBoss")),
+		FString(TEXT("Row_90,Row_80,Row_70")));
+
+	// --- Test 5: invalid keys fail the query ---
+	TestTrue(TEXT("Array field"), QueryNames({ TEXT("Curve") }, 0, 5).IsEmpty());
+	TestTrue(TEXT("Unknown direction"), QueryNames({ TEXT("Level sideways") }, 0, 5).IsEmpty());
+	TestTrue(TEXT("Unknown field"), QueryNames({ TEXT("NoSuchField") }, 0, 5).IsEmpty());
+
+	return true;
+}
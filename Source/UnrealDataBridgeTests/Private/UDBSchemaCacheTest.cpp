@@ -0,0 +1,103 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBSchemaCache.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Kismet2/StructureEditorUtils.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBSchemaCacheTest,
+	"UDB.Commands.SchemaCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBSchemaCacheTest::RunTest(const FString& Parameters)
+{
+	const UScriptStruct* TransformStruct = TBaseStructure<FTransform>::Get();
+
+	// --- Test 1: Repeat lookups share the cached schema ---
+	{
+		FUDBSchemaCache::Reset();
+		const FUDBCachedSchema First = FUDBSchemaCache::Get(TransformStruct);
+		const FUDBCachedSchema Second = FUDBSchemaCache::Get(TransformStruct);
+
+		TestTrue(TEXT("Schema should be cached"), First.Schema.IsValid());
+		TestTrue(TEXT("Repeat lookup should return the same schema object"), First.Schema == Second.Schema);
+		TestTrue(TEXT("Repeat lookup should return the same serialized bytes"), First.Utf8 == Second.Utf8);
+		TestEqual(TEXT("Hash should be stable"), First.Hash, Second.Hash);
+		TestEqual(TEXT("One entry per struct and options"), FUDBSchemaCache::Num(), 1);
+
+		FUDBSchemaCache::Get(TransformStruct, false);
+		TestEqual(TEXT("include_inherited is part of the key"), FUDBSchemaCache::Num(), 2);
+	}
+
+	// --- Test 2: Reset rebuilds with an identical hash ---
+	{
+		const FString HashBefore = FUDBSchemaCache::Get(TransformStruct).Hash;
+		FUDBSchemaCache::Reset();
+		TestEqual(TEXT("Reset should empty the cache"), FUDBSchemaCache::Num(), 0);
+		TestEqual(TEXT("Rebuilt schema should hash the same"), FUDBSchemaCache::Get(TransformStruct).Hash, HashBefore);
+	}
+
+	// --- Test 3: get_struct_schema response splices the cached bytes into valid JSON ---
+	{
+		FUDBCommandHandler Handler;
+		TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("struct_name"), TEXT("Transform"));
+
+		FUDBCommandResult Result = Handler.Execute(TEXT("get_struct_schema"), Params);
+		TestTrue(TEXT("get_struct_schema should succeed"), Result.bSuccess);
+		TestEqual(TEXT("Schema object should be marked pre-serialized"), Result.PreserializedObjects.Num(), 1);
+
+		const FString ResponseString = FUDBCommandHandler::ResultToJson(Result, 0.0);
+		TSharedPtr<FJsonObject> Parsed;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseString);
+		TestTrue(TEXT("Response should be valid JSON"), FJsonSerializer::Deserialize(Reader, Parsed) && Parsed.IsValid());
+
+		if (Parsed.IsValid())
+		{
+			const TSharedPtr<FJsonObject>* DataObj = nullptr;
+			const TSharedPtr<FJsonObject>* SchemaObj = nullptr;
+			TestTrue(TEXT("Response should contain data.schema"),
+				Parsed->TryGetObjectField(TEXT("data"), DataObj) && DataObj != nullptr
+				&& (*DataObj)->TryGetObjectField(TEXT("schema"), SchemaObj) && SchemaObj != nullptr);
+
+			if (SchemaObj != nullptr)
+			{
+				TestEqual(TEXT("Spliced schema should name the struct"),
+					(*SchemaObj)->GetStringField(TEXT("struct_name")), FString(TEXT("Transform")));
+			}
+		}
+	}
+
+	// --- Test 4: Editing a user-defined struct drops its cached schema ---
+	{
+		UUserDefinedStruct* UserStruct = FStructureEditorUtils::CreateUserDefinedStruct(
+			GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UUserDefinedStruct::StaticClass(), TEXT("UDBSchemaCacheTestStruct")), RF_Transient);
+		TestNotNull(TEXT("Test struct should be created"), UserStruct);
+
+		if (UserStruct != nullptr)
+		{
+			FUDBSchemaCache::Reset();
+			const FString HashBefore = FUDBSchemaCache::Get(UserStruct).Hash;
+			TestEqual(TEXT("Struct schema should be cached"), FUDBSchemaCache::Num(), 1);
+
+			// Recompiles the struct in place; the object and its address stay the same
+			FEdGraphPinType IntPinType;
+			IntPinType.PinCategory = TEXT("int");
+			TestTrue(TEXT("Variable should be added"), FStructureEditorUtils::AddVariable(UserStruct, IntPinType));
+
+			TestEqual(TEXT("Struct edit should clear the cache"), FUDBSchemaCache::Num(), 0);
+			TestNotEqual(TEXT("Schema of the edited struct should hash differently"), FUDBSchemaCache::Get(UserStruct).Hash, HashBefore);
+
+			UserStruct->MarkAsGarbage();
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,70 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBSettings.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBSearchAllContentTest,
+	"UDB.Commands.SearchAllContent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBSearchAllContentTest::RunTest(const FString& Parameters)
+{
+	UDataTable* TableA = UDBTest::CreateTestTable(TEXT("DT_SearchAllA"), 50);
+	UDataTable* TableB = UDBTest::CreateTestTable(TEXT("DT_SearchAllB"), 30);
+	FUDBCommandHandler Handler;
+
+	auto SearchAll = [&](const TCHAR* RowStruct, int32 Limit)
+	{
+		TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("search_text"), TEXT("row 2"));
+		Params->SetStringField(TEXT("path_filter"), TEXT("/Temp/UDBTest_DT_SearchAll"));
+		Params->SetStringField(TEXT("row_struct"), RowStruct);
+		Params->SetNumberField(TEXT("limit"), Limit);
+		Params->SetBoolField(TEXT("load_unloaded"), false);
+		return Handler.Execute(TEXT("search_all_content"), Params);
+	};
+
+	// --- Test 1: results grouped by table with exact counts and a global limit ---
+	{
+		FUDBCommandResult Result = SearchAll(TEXT("UDBTestRow"), 15);
+		TestTrue(TEXT("search_all_content should succeed"), Result.bSuccess);
+		TestEqual(TEXT("Both tables searched"), Result.Data->GetNumberField(TEXT("tables_searched")), 2.0);
+		TestEqual(TEXT("Every row checked"), Result.Data->GetNumberField(TEXT("rows_checked")), 80.0);
+		TestEqual(TEXT("Exact total"), Result.Data->GetNumberField(TEXT("total_matches")), 22.0);
+		TestEqual(TEXT("Global limit"), Result.Data->GetNumberField(TEXT("returned")), 15.0);
+
+		const TArray<TSharedPtr<FJsonValue>>& Tables = Result.Data->GetArrayField(TEXT("tables"));
+		if (TestEqual(TEXT("Two tables with matches"), Tables.Num(), 2))
+		{
+			const TSharedPtr<FJsonObject> First = Tables[0]->AsObject();
+			const TSharedPtr<FJsonObject> Second = Tables[1]->AsObject();
+			TestEqual(TEXT("Path order"), First->GetStringField(TEXT("table_path")), TableA->GetPathName());
+			TestEqual(TEXT("First table count"), First->GetNumberField(TEXT("total_matches")), 11.0);
+			TestEqual(TEXT("First table results"), First->GetArrayField(TEXT("results")).Num(), 11);
+			TestEqual(TEXT("Second table count stays exact"), Second->GetNumberField(TEXT("total_matches")), 11.0);
+			TestEqual(TEXT("Second table gets the rest of the limit"), Second->GetArrayField(TEXT("results")).Num(), 4);
+			TestTrue(TEXT("Per-table timing"), Second->HasField(TEXT("search_ms")));
+		}
+	}
+
+	// --- Test 2: parallel scan agrees, filters exclude tables ---
+	{
+		const int32 PreviousParallelRows = UUDBSettings::Get()->ParallelSerializeMinRows;
+		GetMutableDefault<UUDBSettings>()->ParallelSerializeMinRows = 1;
+		FUDBCommandResult Parallel = SearchAll(TEXT("UDBTestRow"), 100);
+		GetMutableDefault<UUDBSettings>()->ParallelSerializeMinRows = PreviousParallelRows;
+		TestEqual(TEXT("Parallel total"), Parallel.Data->GetNumberField(TEXT("total_matches")), 22.0);
+
+		FUDBCommandResult Filtered = SearchAll(TEXT("NoSuchRowStruct"), 100);
+		TestTrue(TEXT("Unmatched filter still succeeds"), Filtered.bSuccess);
+		TestEqual(TEXT("No table has that struct"), Filtered.Data->GetNumberField(TEXT("tables_searched")), 0.0);
+	}
+
+	return true;
+}
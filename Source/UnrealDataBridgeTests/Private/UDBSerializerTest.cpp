@@ -5,6 +5,7 @@
 #include "Dom/JsonValue.h"
 #include "GameplayTagContainer.h"
 #include "StructUtils/InstancedStruct.h"
+#include "UDBTestRow.h"
 
 // ============================================================================
 // Test: FVector serialization (numeric properties - doubles)
@@ -267,3 +268,229 @@ bool FUDBSerializerNullInputTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+// ============================================================================
+// Test: Nested field-path projection
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBSerializerFieldPathTest,
+	"UDB.Serializer.FieldPathProjection",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBSerializerFieldPathTest::RunTest(const FString& Parameters)
+{
+	FUDBTestRow Row;
+	Row.Level = 7;
+	Row.Stats.Damage = 12.5f;
+	Row.Stats.Cooldown = 3.0f;
+	Row.Abilities.AddDefaulted_GetRef().Cooldown = 1.0f;
+	Row.Abilities.AddDefaulted_GetRef().Cooldown = 2.0f;
+
+	TArray<FString> Errors;
+	const FUDBFieldProjection Projection = FUDBFieldProjection::FromStrings(
+		{ TEXT("Level"), TEXT("Stats.Damage"), TEXT("Abilities[*].Cooldown"), TEXT("Bad[0]") }, Errors);
+	TestEqual(TEXT("Malformed path should be reported"), Errors.Num(), 1);
+
+	TSharedPtr<FJsonObject> Result = FUDBSerializer::StructToJson(FUDBTestRow::StaticStruct(), &Row, Projection);
+	if (!Result.IsValid())
+	{
+		AddError(TEXT("Result should not be null"));
+		return true;
+	}
+
+	TestEqual(TEXT("Only the three selected top-level fields"), Result->Values.Num(), 3);
+	TestEqual(TEXT("Level should be kept"), static_cast<int32>(Result->GetNumberField(TEXT("Level"))), 7);
+
+	const TSharedPtr<FJsonObject> Stats = Result->GetObjectField(TEXT("Stats"));
+	TestEqual(TEXT("Stats should only contain Damage"), Stats->Values.Num(), 1);
+	TestEqual(TEXT("Stats.Damage should be 12.5"), Stats->GetNumberField(TEXT("Damage")), 12.5);
+
+	const TArray<TSharedPtr<FJsonValue>>& Abilities = Result->GetArrayField(TEXT("Abilities"));
+	TestEqual(TEXT("Every ability should be projected"), Abilities.Num(), 2);
+	if (Abilities.Num() == 2)
+	{
+		TestEqual(TEXT("Ability should only contain Cooldown"), Abilities[1]->AsObject()->Values.Num(), 1);
+		TestEqual(TEXT("Second cooldown should be 2"), Abilities[1]->AsObject()->GetNumberField(TEXT("Cooldown")), 2.0);
+	}
+
+	// A whole-value path wins over a narrower one regardless of order
+	const FUDBFieldProjection Widened = FUDBFieldProjection::FromStrings({ TEXT("Stats.Damage"), TEXT("Stats") }, Errors);
+	TSharedPtr<FJsonObject> WidenedResult = FUDBSerializer::StructToJson(FUDBTestRow::StaticStruct(), &Row, Widened);
+	TestEqual(TEXT("Whole Stats should be serialized"), WidenedResult->GetObjectField(TEXT("Stats"))->Values.Num(), 2);
+
+	// [*] must address an array or set
+	TArray<FString> ElementErrors;
+	const FUDBFieldProjection ScalarElements = FUDBFieldProjection::FromStrings({ TEXT("Stats[*].Damage"), TEXT("Level") }, ElementErrors);
+	TestEqual(TEXT("[*] should parse"), ElementErrors.Num(), 0);
+	ScalarElements.Validate(FUDBTestRow::StaticStruct(), ElementErrors);
+	TestEqual(TEXT("[*] on a struct field should be rejected"), ElementErrors.Num(), 1);
+	TestTrue(TEXT("Rejection should say the field is not an array"),
+		ElementErrors.Num() == 1 && ElementErrors[0].Contains(TEXT("not an array")));
+	TestEqual(TEXT("The rejected path should select nothing"),
+		FUDBCompiledProjection::Compile(FUDBTestRow::StaticStruct(), ScalarElements)->Fields.Num(), 1);
+
+	ElementErrors.Reset();
+	Projection.Validate(FUDBTestRow::StaticStruct(), ElementErrors);
+	TestEqual(TEXT("[*] on an array field should be accepted"), ElementErrors.Num(), 0);
+
+	return true;
+}
+
+// ============================================================================
+// Test: Compiled projections resolve names once and match the uncompiled result
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBSerializerCompiledProjectionTest,
+	"UDB.Serializer.CompiledProjection",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBSerializerCompiledProjectionTest::RunTest(const FString& Parameters)
+{
+	TArray<FString> Errors;
+	const FUDBFieldProjection Projection = FUDBFieldProjection::FromStrings(
+		{ TEXT("Stats.Damage"), TEXT("DisplayName"), TEXT("NotAField") }, Errors);
+
+	const TSharedRef<const FUDBCompiledProjection> Compiled = FUDBCompiledProjection::Compile(FUDBTestRow::StaticStruct(), Projection);
+	TestEqual(TEXT("Unknown names should be dropped at compile time"), Compiled->Fields.Num(), 2);
+
+	for (const FUDBCompiledProjection::FField& Field : Compiled->Fields)
+	{
+		if (Field.Name == TEXT("Stats"))
+		{
+			TestTrue(TEXT("Stats should have a compiled child"), Field.Child.IsValid());
+			TestEqual(TEXT("Stats child should select one field"), Field.Child.IsValid() ? Field.Child->Fields.Num() : 0, 1);
+		}
+		else
+		{
+			TestFalse(TEXT("DisplayName is selected whole"), Field.Child.IsValid() || Field.Source.IsValid());
+		}
+	}
+
+	FUDBTestRow Row;
+	Row.DisplayName = TEXT("Compiled");
+	Row.Stats.Damage = 4.0f;
+	TSharedPtr<FJsonObject> FromCompiled = FUDBSerializer::StructToJson(FUDBTestRow::StaticStruct(), &Row, *Compiled);
+	TSharedPtr<FJsonObject> FromPaths = FUDBSerializer::StructToJson(FUDBTestRow::StaticStruct(), &Row, Projection);
+	TestTrue(TEXT("Compiled and path projections should serialize identically"),
+		FUDBJsonWriter::ToBytes(FromCompiled) == FUDBJsonWriter::ToBytes(FromPaths));
+
+	// Search semantics: inside a selected struct, bare names also select same-named nested fields
+	const FUDBFieldProjection SearchFilter = FUDBFieldProjection::FromStrings({ TEXT("Stats.Cooldown"), TEXT("Damage") }, Errors);
+	const TSharedRef<const FUDBCompiledProjection> AnyDepth = FUDBCompiledProjection::Compile(FUDBTestRow::StaticStruct(), SearchFilter, true);
+	TestEqual(TEXT("Only Stats is selected at the top level"), AnyDepth->Fields.Num(), 1);
+	if (AnyDepth->Fields.Num() == 1 && AnyDepth->Fields[0].Child.IsValid())
+	{
+		TestEqual(TEXT("Stats.Cooldown and bare Damage should both be selected"), AnyDepth->Fields[0].Child->Fields.Num(), 2);
+	}
+
+	return true;
+}
+
+// ============================================================================
+// Test: omit_defaults skips fields identical to the struct defaults
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBSerializerOmitDefaultsTest,
+	"UDB.Serializer.OmitDefaults",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBSerializerOmitDefaultsTest::RunTest(const FString& Parameters)
+{
+	FUDBTestRow Row;
+	Row.Level = 3;
+	Row.Stats.Damage = 9.0f;
+
+	FUDBSerializeOptions Options;
+	Options.DefaultData = FUDBSerializer::GetStructDefaults(FUDBTestRow::StaticStruct());
+	TestNotNull(TEXT("Defaults should be available"), Options.DefaultData);
+	TestEqual(TEXT("Defaults should be cached"), Options.DefaultData, FUDBSerializer::GetStructDefaults(FUDBTestRow::StaticStruct()));
+
+	TSharedPtr<FJsonObject> Result = FUDBSerializer::StructToJson(FUDBTestRow::StaticStruct(), &Row, nullptr, Options);
+	TestEqual(TEXT("Only changed fields should be written"), Result->Values.Num(), 2);
+	TestEqual(TEXT("Level should be written"), static_cast<int32>(Result->GetNumberField(TEXT("Level"))), 3);
+
+	const TSharedPtr<FJsonObject>* Stats = nullptr;
+	TestTrue(TEXT("Changed nested struct should be written"), Result->TryGetObjectField(TEXT("Stats"), Stats));
+	if (Stats != nullptr)
+	{
+		TestEqual(TEXT("Nested struct should only contain its changed field"), (*Stats)->Values.Num(), 1);
+		TestTrue(TEXT("Stats.Damage should be written"), (*Stats)->HasField(TEXT("Damage")));
+	}
+
+	// The elided JSON round-trips onto a default row
+	FUDBTestRow RoundTrip;
+	TArray<FString> Warnings;
+	TestTrue(TEXT("Elided JSON should deserialize"), FUDBSerializer::JsonToStruct(Result, FUDBTestRow::StaticStruct(), &RoundTrip, Warnings));
+	TestTrue(TEXT("Round-tripped row should be identical"), FUDBTestRow::StaticStruct()->CompareScriptStruct(&Row, &RoundTrip, PPF_None));
+
+	return true;
+}
+
+// ============================================================================
+// Test: Numeric fast path (POD arrays, FVector-like structs, float formatting)
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBSerializerNumericFastPathTest,
+	"UDB.Serializer.NumericFastPath",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBSerializerNumericFastPathTest::RunTest(const FString& Parameters)
+{
+	FUDBTestRow Row;
+	Row.Weight = 0.1f;
+	Row.SpawnOffset = FVector(1.23456, -2.5, 1e20);
+	Row.Curve = { 0.1f, 2.5f, -3.75f, 1.0f / 3.0f };
+
+	// --- Test 1: Floats serialize as their shortest decimal and still round-trip exactly ---
+	{
+		TSharedPtr<FJsonObject> Result = FUDBSerializer::StructToJson(FUDBTestRow::StaticStruct(), &Row);
+		TestTrue(TEXT("0.1f should be sent as 0.1"), Result->GetNumberField(TEXT("Weight")) == 0.1);
+
+		const TArray<TSharedPtr<FJsonValue>>& Curve = Result->GetArrayField(TEXT("Curve"));
+		TestEqual(TEXT("Curve should keep every sample"), Curve.Num(), 4);
+		if (Curve.Num() == 4)
+		{
+			TestTrue(TEXT("Curve[0]"), Curve[0]->AsNumber() == 0.1);
+			TestTrue(TEXT("Curve[2]"), Curve[2]->AsNumber() == -3.75);
+		}
+
+		const FUDBJsonBytes Bytes = FUDBJsonWriter::ToBytes(Result);
+		const FString Json(Bytes.Num(), Bytes.GetData());
+		TestTrue(TEXT("Output should use shortest float text"), Json.Contains(TEXT("\"Weight\":0.1,")));
+
+		FUDBTestRow RoundTrip;
+		TArray<FString> Warnings;
+		TestTrue(TEXT("JSON should deserialize"), FUDBSerializer::JsonToStruct(Result, FUDBTestRow::StaticStruct(), &RoundTrip, Warnings));
+		TestTrue(TEXT("Round-tripped row should be identical"), FUDBTestRow::StaticStruct()->CompareScriptStruct(&Row, &RoundTrip, PPF_None));
+	}
+
+	// --- Test 2: FVector-like structs match the generic struct path ---
+	{
+		TSharedPtr<FJsonObject> Fast = FUDBSerializer::StructToJson(FUDBTestRow::StaticStruct(), &Row)->GetObjectField(TEXT("SpawnOffset"));
+		TSharedPtr<FJsonObject> Generic = FUDBSerializer::StructToJson(TBaseStructure<FVector>::Get(), &Row.SpawnOffset);
+		TestEqual(TEXT("Same member count"), Fast->Values.Num(), Generic->Values.Num());
+		TestEqual(TEXT("X"), Fast->GetNumberField(TEXT("X")), Generic->GetNumberField(TEXT("X")));
+		TestEqual(TEXT("Z"), Fast->GetNumberField(TEXT("Z")), 1e20);
+	}
+
+	// --- Test 3: float_precision rounds floats and doubles, leaves integers alone ---
+	{
+		TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetNumberField(TEXT("float_precision"), 1);
+		const FUDBSerializeOptions Options = FUDBSerializeOptions::FromParams(Params, FUDBTestRow::StaticStruct());
+		TestEqual(TEXT("Precision should be read from params"), Options.FloatPrecision, 1);
+
+		Row.Level = 12345;
+		TSharedPtr<FJsonObject> Result = FUDBSerializer::StructToJson(FUDBTestRow::StaticStruct(), &Row, nullptr, Options);
+		TestTrue(TEXT("Curve[3] rounded"), Result->GetArrayField(TEXT("Curve"))[3]->AsNumber() == 0.3);
+		TestTrue(TEXT("SpawnOffset.X rounded"), Result->GetObjectField(TEXT("SpawnOffset"))->GetNumberField(TEXT("X")) == 1.2);
+		TestTrue(TEXT("Huge values pass through"), Result->GetObjectField(TEXT("SpawnOffset"))->GetNumberField(TEXT("Z")) == 1e20);
+		TestEqual(TEXT("Integers untouched"), Result->GetNumberField(TEXT("Level")), 12345.0);
+	}
+
+	return true;
+}
@@ -0,0 +1,110 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBTableIndexes.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBTableIndexTest,
+	"UDB.Commands.TableIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBTableIndexTest::RunTest(const FString& Parameters)
+{
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_TableIndexTest"), 200);
+	FUDBCommandHandler Handler;
+
+	FString IndexType;
+	FString IndexField;
+
+	// Each query records the index that served it in IndexType / IndexField
+	auto Query = [&](const TCHAR* Where)
+	{
+		return UDBTest::QueryIndexed(*this, Handler, Table, Where, IndexType, IndexField);
+	};
+
+	// --- Test 1: hash index serves equality and matches a scan ---
+	{
+		const int32 Scanned = UDBTest::GetTotalCount(Query(TEXT("Rarity == Epic and Level < 50")));
+		TestTrue(TEXT("No index yet"), IndexField.IsEmpty());
+
+		FUDBCommandResult Created = UDBTest::CreateIndex(Handler, Table, TEXT("Rarity"), TEXT("hash"));
+		TestTrue(TEXT("create_index should succeed"), Created.bSuccess);
+		TestEqual(TEXT("One key per rarity"), static_cast<int32>(Created.Data->GetNumberField(TEXT("key_count"))), 4);
+
+		TestEqual(TEXT("Indexed result equals scan"), UDBTest::GetTotalCount(Query(TEXT("Rarity == Epic and Level < 50"))), Scanned);
+		TestEqual(TEXT("Scan count"), Scanned, 24);
+		TestEqual(TEXT("Rarity index served the query"), IndexField, FString(TEXT("Rarity")));
+
+		Query(TEXT("Rarity == Epic or Level < 50"));
+		TestTrue(TEXT("An or of conditions cannot use the index"), IndexField.IsEmpty());
+	}
+
+	// --- Test 2: sorted index serves ranges ---
+	{
+		TestTrue(TEXT("Sorted index on Level"), UDBTest::CreateIndex(Handler, Table, TEXT("Level"), TEXT("sorted")).bSuccess);
+		TestEqual(TEXT("Level >= 95"), UDBTest::GetTotalCount(Query(TEXT("Level >= 95"))), 10);
+		TestEqual(TEXT("Level index served the range"), IndexField, FString(TEXT("Level")));
+		TestEqual(TEXT("Most selective index wins"), UDBTest::GetTotalCount(Query(TEXT("Rarity == Legendary and Level > 98"))), 2);
+		TestEqual(TEXT("Level is more selective than Rarity"), IndexField, FString(TEXT("Level")));
+	}
+
+	// --- Test 3: plugin writes update the index in place ---
+	{
+		TSharedPtr<FJsonObject> RowData = MakeShared<FJsonObject>();
+		RowData->SetNumberField(TEXT("Level"), 97);
+
+		TSharedPtr<FJsonObject> Update = UDBTest::MakeQueryParams(Table);
+		Update->SetStringField(TEXT("row_name"), TEXT("Row_0"));
+		Update->SetObjectField(TEXT("row_data"), RowData);
+		TestTrue(TEXT("Update should succeed"), Handler.Execute(TEXT("update_datatable_row"), Update).bSuccess);
+		TestEqual(TEXT("Updated row joins the range"), UDBTest::GetTotalCount(Query(TEXT("Level >= 95"))), 11);
+
+		TSharedPtr<FJsonObject> Delete = UDBTest::MakeQueryParams(Table);
+		Delete->SetStringField(TEXT("row_name"), TEXT("Row_195"));
+		TestTrue(TEXT("Delete should succeed"), Handler.Execute(TEXT("delete_datatable_row"), Delete).bSuccess);
+		TestEqual(TEXT("Deleted row leaves the range"), UDBTest::GetTotalCount(Query(TEXT("Level >= 95"))), 10);
+
+		TSharedPtr<FJsonObject> Add = UDBTest::MakeQueryParams(Table);
+		Add->SetStringField(TEXT("row_name"), TEXT("Row_New"));
+		Add->SetObjectField(TEXT("row_data"), RowData);
+		TestTrue(TEXT("Add should succeed"), Handler.Execute(TEXT("add_datatable_row"), Add).bSuccess);
+		TestEqual(TEXT("Added row joins the range"), UDBTest::GetTotalCount(Query(TEXT("Level >= 95"))), 11);
+
+		// The new row takes the slot the deleted one freed, so it is not last in table order
+		const TArray<FString> Indexed = UDBTest::GetRowNames(Query(TEXT("Level >= 95")));
+		TestEqual(TEXT("Level index served the page"), IndexField, FString(TEXT("Level")));
+		const TArray<FString> Scanned = UDBTest::GetRowNames(Query(TEXT("Level >= 95 or Level > 1000")));
+		TestTrue(TEXT("The or scanned"), IndexField.IsEmpty());
+		TestTrue(TEXT("Index page has the scan's order"), Indexed == Scanned);
+	}
+
+	// --- Test 4: changes made outside the plugin rebuild the index ---
+	{
+		Table->FindRow<FUDBTestRow>(TEXT("Row_1"), TEXT("TableIndexTest"))->Level = 96;
+		Table->HandleDataTableChanged(TEXT("Row_1"));
+		TestEqual(TEXT("Editor edit is picked up"), UDBTest::GetTotalCount(Query(TEXT("Level >= 95"))), 12);
+		TestEqual(TEXT("Still served by the index"), IndexField, FString(TEXT("Level")));
+	}
+
+	// --- Test 5: invalid indexes and drop_index ---
+	{
+		TestFalse(TEXT("Array paths cannot be indexed"), UDBTest::CreateIndex(Handler, Table, TEXT("Abilities.Cooldown"), TEXT("hash")).bSuccess);
+		TestFalse(TEXT("Tag containers cannot be indexed"), UDBTest::CreateIndex(Handler, Table, TEXT("Tags"), TEXT("hash")).bSuccess);
+		TestFalse(TEXT("Unknown type"), UDBTest::CreateIndex(Handler, Table, TEXT("Weight"), TEXT("btree")).bSuccess);
+
+		TSharedPtr<FJsonObject> Drop = UDBTest::MakeQueryParams(Table);
+		Drop->SetStringField(TEXT("field"), TEXT("Level"));
+		FUDBCommandResult Dropped = Handler.Execute(TEXT("drop_index"), Drop);
+		TestTrue(TEXT("drop_index should report the removal"), Dropped.bSuccess && Dropped.Data->GetBoolField(TEXT("dropped")));
+		TestEqual(TEXT("Same result without the index"), UDBTest::GetTotalCount(Query(TEXT("Level >= 95"))), 12);
+		TestTrue(TEXT("No index after drop"), IndexField.IsEmpty());
+	}
+
+	FUDBTableIndexes::Reset();
+	return true;
+}
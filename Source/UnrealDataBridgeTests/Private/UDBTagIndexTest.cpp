@@ -0,0 +1,140 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBTagIndex.h"
+#include "UDBTestRow.h"
+#include "NativeGameplayTags.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UDBTest_Element, "UDBTest.Element");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UDBTest_Element_Fire, "UDBTest.Element.Fire");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_UDBTest_Element_Ice, "UDBTest.Element.Ice");
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBTagIndexTest,
+	"UDB.Commands.TagIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBTagIndexTest::RunTest(const FString& Parameters)
+{
+	// Every third row is Fire, every fifth Ice: 34 Fire, 20 Ice, 7 both
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_TagIndexTest"), 100);
+	for (int32 Index = 0; Index < 100; ++Index)
+	{
+		FUDBTestRow* Row = Table->FindRow<FUDBTestRow>(*FString::Printf(TEXT("Row_%d"), Index), TEXT("TagIndexTest"));
+		if (Index % 3 == 0)
+		{
+			Row->Tags.AddTag(TAG_UDBTest_Element_Fire);
+		}
+		if (Index % 5 == 0)
+		{
+			Row->Tags.AddTag(TAG_UDBTest_Element_Ice);
+		}
+	}
+	Table->HandleDataTableChanged();
+
+	FUDBCommandHandler Handler;
+
+	auto Resolve = [&](const TArray<FString>& Tags, const TCHAR* MatchMode)
+	{
+		TSharedPtr<FJsonObject> Params = UDBTest::MakeQueryParams(Table);
+		Params->SetStringField(TEXT("tag_field"), TEXT("Tags"));
+		Params->SetStringField(TEXT("match_mode"), MatchMode);
+		TArray<TSharedPtr<FJsonValue>> TagValues;
+		for (const FString& Tag : Tags)
+		{
+			TagValues.Add(MakeShared<FJsonValueString>(Tag));
+		}
+		Params->SetArrayField(TEXT("tags"), TagValues);
+		return Handler.Execute(TEXT("resolve_tags"), Params);
+	};
+
+	auto ResolvedCount = [](const FUDBCommandResult& Result)
+	{
+		return Result.bSuccess ? static_cast<int32>(Result.Data->GetNumberField(TEXT("resolved_count"))) : -1;
+	};
+
+	// --- Test 1: exact matches compare whole tags ---
+	{
+		FUDBCommandResult Result = Resolve({ TEXT("UDBTest.Element.Fire") }, TEXT("exact"));
+		TestEqual(TEXT("Fire rows"), ResolvedCount(Result), 34);
+		TestEqual(TEXT("Table order"), Result.Data->GetArrayField(TEXT("resolved"))[1]->AsObject()->GetStringField(TEXT("row_name")), FString(TEXT("Row_3")));
+
+		TestEqual(TEXT("Either tag"), ResolvedCount(Resolve({ TEXT("UDBTest.Element.Fire"), TEXT("UDBTest.Element.Ice") }, TEXT("exact"))), 47);
+
+		FUDBCommandResult Parent = Resolve({ TEXT("UDBTest.Element"), TEXT("UDBTest.Unknown") }, TEXT("exact"));
+		TestEqual(TEXT("A parent is not an exact match"), ResolvedCount(Parent), 0);
+		TestEqual(TEXT("Both tags unresolved"), Parent.Data->GetArrayField(TEXT("unresolved_tags")).Num(), 2);
+	}
+
+	// --- Test 2: hierarchical matches include child tags ---
+	{
+		FUDBCommandResult Result = Resolve({ TEXT("UDBTest.Element") }, TEXT("hierarchical"));
+		TestEqual(TEXT("Fire or Ice rows"), ResolvedCount(Result), 47);
+		TestEqual(TEXT("Parent is resolved"), Result.Data->GetArrayField(TEXT("unresolved_tags")).Num(), 0);
+
+		const TSharedPtr<FJsonObject> Row0 = Result.Data->GetArrayField(TEXT("resolved"))[0]->AsObject();
+		TestEqual(TEXT("Row_0 first"), Row0->GetStringField(TEXT("row_name")), FString(TEXT("Row_0")));
+		TestEqual(TEXT("Both child tags reported"), Row0->GetArrayField(TEXT("matched_tags")).Num(), 2);
+
+		TestEqual(TEXT("A leaf matches itself"), ResolvedCount(Resolve({ TEXT("UDBTest.Element.Ice") }, TEXT("hierarchical"))), 20);
+		TestFalse(TEXT("Unknown match_mode"), Resolve({ TEXT("UDBTest.Element") }, TEXT("prefix")).bSuccess);
+	}
+
+	// --- Test 3: plugin writes patch the index ---
+	{
+		TSharedPtr<FJsonObject> RowData = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> IceOnly;
+		IceOnly.Add(MakeShared<FJsonValueString>(TEXT("UDBTest.Element.Ice")));
+		RowData->SetArrayField(TEXT("Tags"), IceOnly);
+
+		TSharedPtr<FJsonObject> Update = UDBTest::MakeQueryParams(Table);
+		Update->SetStringField(TEXT("row_name"), TEXT("Row_3"));
+		Update->SetObjectField(TEXT("row_data"), RowData);
+		TestTrue(TEXT("Update should succeed"), Handler.Execute(TEXT("update_datatable_row"), Update).bSuccess);
+		TestEqual(TEXT("Updated row leaves Fire"), ResolvedCount(Resolve({ TEXT("UDBTest.Element.Fire") }, TEXT("exact"))), 33);
+		TestEqual(TEXT("Updated row joins Ice"), ResolvedCount(Resolve({ TEXT("UDBTest.Element.Ice") }, TEXT("exact"))), 21);
+
+		TSharedPtr<FJsonObject> Delete = UDBTest::MakeQueryParams(Table);
+		Delete->SetStringField(TEXT("row_name"), TEXT("Row_0"));
+		TestTrue(TEXT("Delete should succeed"), Handler.Execute(TEXT("delete_datatable_row"), Delete).bSuccess);
+		TestEqual(TEXT("Deleted row leaves"), ResolvedCount(Resolve({ TEXT("UDBTest.Element") }, TEXT("hierarchical"))), 46);
+
+		TSharedPtr<FJsonObject> Add = UDBTest::MakeQueryParams(Table);
+		Add->SetStringField(TEXT("row_name"), TEXT("Row_New"));
+		Add->SetObjectField(TEXT("row_data"), RowData);
+		TestTrue(TEXT("Add should succeed"), Handler.Execute(TEXT("add_datatable_row"), Add).bSuccess);
+		FUDBCommandResult Result = Resolve({ TEXT("UDBTest.Element.Ice") }, TEXT("exact"));
+		TestEqual(TEXT("Added row joins"), ResolvedCount(Result), 21);
+
+		// Row_New takes the slot Row_0 freed; resolved rows must follow the row map, not insertion
+		TArray<FString> Expected;
+		for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+		{
+			if (reinterpret_cast<const FUDBTestRow*>(Row.Value)->Tags.HasTagExact(TAG_UDBTest_Element_Ice))
+			{
+				Expected.Add(Row.Key.ToString());
+			}
+		}
+		TArray<FString> Resolved;
+		for (const TSharedPtr<FJsonValue>& Entry : Result.Data->GetArrayField(TEXT("resolved")))
+		{
+			Resolved.Add(Entry->AsObject()->GetStringField(TEXT("row_name")));
+		}
+		TestEqual(TEXT("Resolved rows are in table order"), Resolved, Expected);
+		TestEqual(TEXT("Row_New is where Row_0 was"), Resolved.Num() > 0 ? Resolved[0] : FString(), FString(TEXT("Row_New")));
+	}
+
+	// --- Test 4: editor edits rebuild the index ---
+	{
+		Table->FindRow<FUDBTestRow>(TEXT("Row_1"), TEXT("TagIndexTest"))->Tags.AddTag(TAG_UDBTest_Element_Fire);
+		Table->HandleDataTableChanged(TEXT("Row_1"));
+		TestEqual(TEXT("Editor edit is picked up"), ResolvedCount(Resolve({ TEXT("UDBTest.Element.Fire") }, TEXT("exact"))), 33);
+	}
+
+	FUDBTagIndex::Reset();
+	return true;
+}
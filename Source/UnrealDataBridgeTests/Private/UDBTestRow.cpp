@@ -0,0 +1,99 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "UDBTestRow.h"
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UObject/Package.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+UDataTable* UDBTest::CreateTestTable(const FString& TableName, int32 NumRows)
+{
+	UPackage* TestPackage = CreatePackage(*FString::Printf(TEXT("/Temp/UDBTest_%s"), *TableName));
+	UDataTable* Table = NewObject<UDataTable>(TestPackage, FName(*TableName), RF_Public | RF_Standalone | RF_Transactional);
+	Table->RowStruct = FUDBTestRow::StaticStruct();
+
+	for (int32 Index = 0; Index < NumRows; ++Index)
+	{
+		FUDBTestRow Row;
+		Row.DisplayName = FString::Printf(TEXT("Test Row %d"), Index);
+		Row.Level = Index % 100;
+		Row.Weight = 0.5f + static_cast<float>(Index % 37) * 0.25f;
+		Row.bIsBoss = (Index % 10) == 0;
+		Row.Rarity = static_cast<EUDBTestRarity>(Index % 4);
+		Row.SpawnOffset = FVector(Index, Index * 0.5, -Index);
+		Row.Stats.Damage = 10.0f + static_cast<float>(Index % 50);
+		Row.Stats.Cooldown = 1.0f + static_cast<float>(Index % 5);
+		for (int32 Ability = 0; Ability < Index % 3; ++Ability)
+		{
+			FUDBTestStats& Stats = Row.Abilities.AddDefaulted_GetRef();
+			Stats.Damage = static_cast<float>(Ability * 5);
+			Stats.Cooldown = static_cast<float>(Ability + 1);
+		}
+		for (int32 Sample = 0; Sample < 8; ++Sample)
+		{
+			Row.Curve.Add(static_cast<float>(Index % 10) * 0.1f + static_cast<float>(Sample) * 0.3f);
+		}
+
+		Table->AddRow(FName(*FString::Printf(TEXT("Row_%d"), Index)), Row);
+	}
+
+	return Table;
+}
+
+TSharedPtr<FJsonObject> UDBTest::MakeQueryParams(const UDataTable* Table, int32 Limit)
+{
+	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetStringField(TEXT("table_path"), Table->GetPathName());
+	if (Limit > 0)
+	{
+		Params->SetNumberField(TEXT("limit"), Limit);
+	}
+	return Params;
+}
+
+FUDBCommandResult UDBTest::CreateIndex(FUDBCommandHandler& Handler, const UDataTable* Table, const TCHAR* Field, const TCHAR* Type)
+{
+	TSharedPtr<FJsonObject> Params = MakeQueryParams(Table);
+	Params->SetStringField(TEXT("field"), Field);
+	Params->SetStringField(TEXT("type"), Type);
+	return Handler.Execute(TEXT("create_index"), Params);
+}
+
+FUDBCommandResult UDBTest::QueryIndexed(FAutomationTestBase& Test, FUDBCommandHandler& Handler, const UDataTable* Table,
+	const FString& Where, FString& OutIndexType, FString& OutIndexField)
+{
+	TSharedPtr<FJsonObject> Params = MakeQueryParams(Table, 1000);
+	Params->SetStringField(TEXT("where"), Where);
+	FUDBCommandResult Result = Handler.Execute(TEXT("query_datatable"), Params);
+	Test.TestTrue(FString::Printf(TEXT("'%s' should succeed"), *Where), Result.bSuccess);
+
+	OutIndexType.Reset();
+	OutIndexField.Reset();
+	const TSharedPtr<FJsonObject>* IndexUsed = nullptr;
+	if (Result.bSuccess && Result.Data->TryGetObjectField(TEXT("index_used"), IndexUsed))
+	{
+		OutIndexType = (*IndexUsed)->GetStringField(TEXT("type"));
+		OutIndexField = (*IndexUsed)->GetStringField(TEXT("field"));
+	}
+	return Result;
+}
+
+int32 UDBTest::GetTotalCount(const FUDBCommandResult& Result)
+{
+	return Result.bSuccess ? static_cast<int32>(Result.Data->GetNumberField(TEXT("total_count"))) : INDEX_NONE;
+}
+
+TArray<FString> UDBTest::GetRowNames(const FUDBCommandResult& Result)
+{
+	TArray<FString> RowNames;
+	const TArray<TSharedPtr<FJsonValue>>* Rows = nullptr;
+	if (Result.bSuccess && Result.Data->TryGetArrayField(TEXT("rows"), Rows))
+	{
+		for (const TSharedPtr<FJsonValue>& Row : *Rows)
+		{
+			RowNames.Add(Row->AsObject()->GetStringField(TEXT("row_name")));
+		}
+	}
+	return RowNames;
+}
@@ -0,0 +1,96 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagContainer.h"
+#include "UDBTestRow.generated.h"
+
+UENUM()
+enum class EUDBTestRarity : uint8
+{
+	Common,
+	Rare,
+	Epic,
+	Legendary,
+};
+
+USTRUCT()
+struct FUDBTestStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	float Damage = 0.0f;
+
+	UPROPERTY()
+	float Cooldown = 0.0f;
+};
+
+/** Row struct with one field of each common kind, used by tests and benchmarks that need a real table */
+USTRUCT()
+struct FUDBTestRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString DisplayName;
+
+	UPROPERTY()
+	int32 Level = 0;
+
+	UPROPERTY()
+	float Weight = 0.0f;
+
+	UPROPERTY()
+	bool bIsBoss = false;
+
+	UPROPERTY()
+	EUDBTestRarity Rarity = EUDBTestRarity::Common;
+
+	UPROPERTY()
+	FGameplayTagContainer Tags;
+
+	UPROPERTY()
+	FVector SpawnOffset = FVector::ZeroVector;
+
+	UPROPERTY()
+	FUDBTestStats Stats;
+
+	UPROPERTY()
+	TArray<FUDBTestStats> Abilities;
+
+	UPROPERTY()
+	TArray<float> Curve;
+};
+
+class FAutomationTestBase;
+class FJsonObject;
+class FUDBCommandHandler;
+struct FUDBCommandResult;
+
+namespace UDBTest
+{
+	/** Create a transient DataTable with NumRows deterministic FUDBTestRow rows named Row_0..Row_N-1 */
+	UDataTable* CreateTestTable(const FString& TableName, int32 NumRows);
+
+	/** Command params naming Table, with "limit" set when Limit is positive */
+	TSharedPtr<FJsonObject> MakeQueryParams(const UDataTable* Table, int32 Limit = 0);
+
+	/** Run create_index for one field of Table */
+	FUDBCommandResult CreateIndex(FUDBCommandHandler& Handler, const UDataTable* Table, const TCHAR* Field, const TCHAR* Type);
+
+	/**
+	 * Run query_datatable on Table with a where expression and up to 1000 rows, reporting a failed
+	 * command to Test. OutIndexType and OutIndexField name the index that served it, empty when it scanned.
+	 */
+	FUDBCommandResult QueryIndexed(FAutomationTestBase& Test, FUDBCommandHandler& Handler, const UDataTable* Table,
+		const FString& Where, FString& OutIndexType, FString& OutIndexField);
+
+	/** total_count of a query_datatable response, or INDEX_NONE if the command failed */
+	int32 GetTotalCount(const FUDBCommandResult& Result);
+
+	/** Row names of a query_datatable response in response order */
+	TArray<FString> GetRowNames(const FUDBCommandResult& Result);
+}
@@ -0,0 +1,157 @@
+// Copyright Mavka Games. All Rights Reserved. https://www.mavka.games/
+
+#include "Misc/AutomationTest.h"
+#include "UDBCommandHandler.h"
+#include "UDBTextIndex.h"
+#include "UDBSettings.h"
+#include "UDBTestRow.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUDBTextIndexTest,
+	"UDB.Commands.TextIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+
+bool FUDBTextIndexTest::RunTest(const FString& Parameters)
+{
+	const int32 PreviousMinRows = UUDBSettings::Get()->SearchIndexMinRows;
+	GetMutableDefault<UUDBSettings>()->SearchIndexMinRows = 100;
+
+	UDataTable* Table = UDBTest::CreateTestTable(TEXT("DT_TextIndexTest"), 300);
+	FUDBCommandHandler Handler;
+
+	// Matching row names in result order; OutCandidates is -1 when the search scanned
+	auto Search = [&](const TCHAR* SearchText, int32& OutCandidates)
+	{
+		TSharedPtr<FJsonObject> Params = UDBTest::MakeQueryParams(Table);
+		Params->SetStringField(TEXT("search_text"), SearchText);
+		Params->SetNumberField(TEXT("limit"), 1000);
+		FUDBCommandResult Result = Handler.Execute(TEXT("search_datatable_content"), Params);
+		TestTrue(FString::Printf(TEXT("'%s' should succeed"), SearchText), Result.bSuccess);
+
+		TArray<FString> RowNames;
+		for (const TSharedPtr<FJsonValue>& Entry : Result.Data->GetArrayField(TEXT("results")))
+		{
+			RowNames.Add(Entry->AsObject()->GetStringField(TEXT("row_name")));
+		}
+
+		OutCandidates = -1;
+		const TSharedPtr<FJsonObject>* IndexUsed = nullptr;
+		if (Result.Data->TryGetObjectField(TEXT("index_used"), IndexUsed))
+		{
+			OutCandidates = static_cast<int32>((*IndexUsed)->GetNumberField(TEXT("candidates")));
+		}
+		return RowNames;
+	};
+
+	int32 Candidates = 0;
+
+	// --- Test 1: indexed searches return what a scan returns ---
+	{
+		for (const TCHAR* SearchText : { TEXT("row 12"), TEXT("TEST ROW 299"), TEXT("w 7"), TEXT("zzz") })
+		{
+			const TArray<FString> Indexed = Search(SearchText, Candidates);
+			TestTrue(FString::Printf(TEXT("'%s' used the index"), SearchText), Candidates >= Indexed.Num());
+
+			GetMutableDefault<UUDBSettings>()->SearchIndexMinRows = 0;
+			const TArray<FString> Scanned = Search(SearchText, Candidates);
+			GetMutableDefault<UUDBSettings>()->SearchIndexMinRows = 100;
+			TestEqual(FString::Printf(TEXT("'%s' disabled index scans"), SearchText), Candidates, -1);
+			TestEqual(FString::Printf(TEXT("'%s' same rows in the same order"), SearchText), Indexed, Scanned);
+		}
+
+		TestEqual(TEXT("Case-insensitive substring"), Search(TEXT("row 12"), Candidates).Num(), 11);
+		Search(TEXT("zzz"), Candidates);
+		TestEqual(TEXT("No candidates for an absent trigram"), Candidates, 0);
+		TestEqual(TEXT("Short search text"), Search(TEXT("Ro"), Candidates).Num(), 300);
+		TestEqual(TEXT("Short search text scans"), Candidates, -1);
+	}
+
+	// --- Test 2: plugin writes reach the index ---
+	{
+		TSharedPtr<FJsonObject> RowData = MakeShared<FJsonObject>();
+		RowData->SetStringField(TEXT("DisplayName"), TEXT("Dragon Slayer"));
+
+		TSharedPtr<FJsonObject> Update = UDBTest::MakeQueryParams(Table);
+		Update->SetStringField(TEXT("row_name"), TEXT("Row_5"));
+		Update->SetObjectField(TEXT("row_data"), RowData);
+		TestTrue(TEXT("Update should succeed"), Handler.Execute(TEXT("update_datatable_row"), Update).bSuccess);
+		TestEqual(TEXT("New text is found"), Search(TEXT("dragon"), Candidates), TArray<FString>{ TEXT("Row_5") });
+		TestEqual(TEXT("Old text no longer matches"), Search(TEXT("Row 5"), Candidates).Num(), 10);
+
+		TSharedPtr<FJsonObject> Delete = UDBTest::MakeQueryParams(Table);
+		Delete->SetStringField(TEXT("row_name"), TEXT("Row_50"));
+		TestTrue(TEXT("Delete should succeed"), Handler.Execute(TEXT("delete_datatable_row"), Delete).bSuccess);
+		TestEqual(TEXT("Deleted row is gone"), Search(TEXT("Row 5"), Candidates).Num(), 9);
+
+		// The added row reuses the slot Row_2 frees, so table order puts it before Row_5
+		Delete->SetStringField(TEXT("row_name"), TEXT("Row_2"));
+		TestTrue(TEXT("Second delete should succeed"), Handler.Execute(TEXT("delete_datatable_row"), Delete).bSuccess);
+
+		RowData->SetStringField(TEXT("DisplayName"), TEXT("Dragon Keeper"));
+		TSharedPtr<FJsonObject> Add = UDBTest::MakeQueryParams(Table);
+		Add->SetStringField(TEXT("row_name"), TEXT("Row_New"));
+		Add->SetObjectField(TEXT("row_data"), RowData);
+		TestTrue(TEXT("Add should succeed"), Handler.Execute(TEXT("add_datatable_row"), Add).bSuccess);
+
+		const TArray<FString> Indexed = Search(TEXT("dragon"), Candidates);
+		TestTrue(TEXT("Served by the patched index"), Candidates >= 0);
+		GetMutableDefault<UUDBSettings>()->SearchIndexMinRows = 0;
+		const TArray<FString> Scanned = Search(TEXT("dragon"), Candidates);
+		GetMutableDefault<UUDBSettings>()->SearchIndexMinRows = 100;
+		TestEqual(TEXT("Added row is found in scan order"), Indexed, Scanned);
+		TestEqual(TEXT("Scan order"), Scanned, TArray<FString>{ TEXT("Row_New"), TEXT("Row_5") });
+	}
+
+	// --- Test 3: edits made elsewhere rebuild the index ---
+	{
+		Table->FindRow<FUDBTestRow>(TEXT("Row_7"), TEXT("TextIndexTest"))->DisplayName = TEXT("Wyvern Rider");
+		Table->HandleDataTableChanged(TEXT("Row_7"));
+		TestEqual(TEXT("Editor edit is picked up"), Search(TEXT("wyvern"), Candidates), TArray<FString>{ TEXT("Row_7") });
+		TestEqual(TEXT("Served by the rebuilt index"), Candidates, 1);
+	}
+
+	// --- Test 4: exact totals past the limit, parallel scan equals serial ---
+	{
+		GetMutableDefault<UUDBSettings>()->SearchIndexMinRows = 0;
+		const int32 PreviousParallelRows = UUDBSettings::Get()->ParallelSerializeMinRows;
+
+		auto SearchPage = [&](int32 ParallelMinRows)
+		{
+			GetMutableDefault<UUDBSettings>()->ParallelSerializeMinRows = ParallelMinRows;
+			TSharedPtr<FJsonObject> Params = UDBTest::MakeQueryParams(Table);
+			Params->SetStringField(TEXT("search_text"), TEXT("ROW 1"));
+			Params->SetNumberField(TEXT("limit"), 5);
+			return Handler.Execute(TEXT("search_datatable_content"), Params);
+		};
+
+		FUDBCommandResult Serial = SearchPage(0);
+		FUDBCommandResult Parallel = SearchPage(1);
+		GetMutableDefault<UUDBSettings>()->ParallelSerializeMinRows = PreviousParallelRows;
+
+		// "Test Row 1", 10-19 and 100-199; the renamed rows 5 and 7 never matched
+		TestEqual(TEXT("Total counts every match"), Serial.Data->GetNumberField(TEXT("total_matches")), 111.0);
+		TestEqual(TEXT("Parallel total"), Parallel.Data->GetNumberField(TEXT("total_matches")), 111.0);
+
+		const TArray<TSharedPtr<FJsonValue>>& SerialRows = Serial.Data->GetArrayField(TEXT("results"));
+		const TArray<TSharedPtr<FJsonValue>>& ParallelRows = Parallel.Data->GetArrayField(TEXT("results"));
+		TestEqual(TEXT("Results stop at the limit"), SerialRows.Num(), 5);
+		TestEqual(TEXT("Parallel results stop at the limit"), ParallelRows.Num(), 5);
+		for (int32 Index = 0; Index < SerialRows.Num() && Index < ParallelRows.Num(); ++Index)
+		{
+			TestEqual(TEXT("Same first rows in row order"),
+				ParallelRows[Index]->AsObject()->GetStringField(TEXT("row_name")),
+				SerialRows[Index]->AsObject()->GetStringField(TEXT("row_name")));
+		}
+		if (SerialRows.Num() > 0)
+		{
+			TestEqual(TEXT("First match"), SerialRows[0]->AsObject()->GetStringField(TEXT("row_name")), FString(TEXT("Row_1")));
+		}
+	}
+
+	GetMutableDefault<UUDBSettings>()->SearchIndexMinRows = PreviousMinRows;
+	FUDBTextIndex::Reset();
+	return true;
+}